@@ -0,0 +1,61 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <nlohmann/json.hpp>
+#include "config.hpp"
+#include "utils.hpp"
+#include "goldilocks_base_field.hpp"
+#include "statedb_test_perf.hpp"
+
+using namespace std;
+using json = nlohmann::json;
+
+/*
+    zkStateDBBench measures the StateDB get and set operations under a configurable workload
+
+    Usage: zkStateDBBench <config.json> [<workload.json>] [<result.json>]
+
+    The config selects the database (databaseURL=local for the in-memory one, file://<directory> for
+    the embedded node store, statedb://<host>:<port> for the nodes of a StateDB server, or a PostgreSQL
+    URL) and the client (stateDBURL=local, or the URL of a
+    running StateDB server), and the workload file (see StateDBPerfWorkload) sets the tree size,
+    operations, threads, read ratio and key distribution; any missing workload field takes its
+    default value
+
+    The result, including throughput and latency percentiles, is written as JSON to stdout and,
+    if provided, to the result file, so that it can be compared across versions
+*/
+
+int main (int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        cerr << "Usage: zkStateDBBench <config.json> [<workload.json>] [<result.json>]" << endl;
+        return -1;
+    }
+
+    json configJson;
+    file2json(argv[1], configJson);
+    Config config;
+    config.load(configJson);
+
+    StateDBPerfWorkload workload;
+    if (argc > 2)
+    {
+        json workloadJson;
+        file2json(argv[2], workloadJson);
+        workload.load(workloadJson);
+    }
+
+    Goldilocks fr;
+    json result;
+    stateDBPerfTest(fr, config, workload, result);
+
+    cout << result.dump(4) << endl;
+    if (argc > 3)
+    {
+        json2file(result, argv[3]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sys/time.h>
+#include <nlohmann/json.hpp>
+#include "config.hpp"
+#include "utils.hpp"
+#include "timer.hpp"
+#include "goldilocks_base_field.hpp"
+#include "poseidon_goldilocks.hpp"
+#include "sm/pols_generated/commit_pols.hpp"
+#include "sm/main/main_exec_required.hpp"
+#include "executor/executor.hpp"
+
+using namespace std;
+using json = nlohmann::json;
+
+/*
+    zkProverBench replays the secondary state machines inputs saved by the prover when
+    config.mainExecRequiredFile is set, without running the main executor
+
+    Usage: zkProverBench <config.json> <required file> [<sm>|all] [warm-ups] [repetitions]
+
+    Every repetition starts from a fresh copy of the loaded inputs. A single state machine is
+    measured on its own, after executing out of the measured time the state machines that
+    generate its inputs (e.g. PaddingKK for PaddingKKBit). With all, every state machine is
+    measured on its own, sequentially and in dependency order, and then the total is measured
+    again through Executor::executeSecondary(), as the prover executes them, in parallel if
+    executeInParallel
+*/
+
+// State machines, in the same order used by Executor::execute(), which respects their dependencies
+const vector<string> smNames = { "padding_pg", "storage", "byte4", "arith", "binary", "mem_align", "memory",
+                                 "padding_kk", "padding_kk_bit", "nine2one", "keccak_f", "norm_gate9", "poseidon_g" };
+
+// Executes one state machine and returns the number of inputs it processed
+uint64_t executeSM (const string &sm, Executor &e, MainExecRequired &required, CommitPols &cmPols)
+{
+    if (sm == "padding_pg") { e.paddingPGExecutor.execute(required.PaddingPG, cmPols.PaddingPG, required.PoseidonG); return required.PaddingPG.size(); }
+    if (sm == "storage") { e.storageExecutor.execute(required.Storage, cmPols.Storage, required.PoseidonG); return required.Storage.size(); }
+    if (sm == "byte4") { e.byte4Executor.execute(required.Byte4, cmPols.Byte4); return required.Byte4.size(); }
+    if (sm == "arith") { e.arithExecutor.execute(required.Arith, cmPols.Arith); return required.Arith.size(); }
+    if (sm == "binary") { e.binaryExecutor.execute(required.Binary, cmPols.Binary); return required.Binary.size(); }
+    if (sm == "mem_align") { e.memAlignExecutor.execute(required.MemAlign, cmPols.MemAlign); return required.MemAlign.size(); }
+    if (sm == "memory") { e.memoryExecutor.execute(required.Memory, cmPols.Mem); return required.Memory.size(); }
+    if (sm == "padding_kk") { e.paddingKKExecutor.execute(required.PaddingKK, cmPols.PaddingKK, required.PaddingKKBit); return required.PaddingKK.size(); }
+    if (sm == "padding_kk_bit") { e.paddingKKBitExecutor.execute(required.PaddingKKBit, cmPols.PaddingKKBit, required.Nine2One); return required.PaddingKKBit.size(); }
+    if (sm == "nine2one") { e.nine2OneExecutor.execute(required.Nine2One, cmPols.Nine2One, required.KeccakF); return required.Nine2One.size(); }
+    if (sm == "keccak_f") { e.keccakFExecutor.execute(required.KeccakF, cmPols.KeccakF, required.NormGate9); return required.KeccakF.size()/1600; }
+    if (sm == "norm_gate9") { e.normGate9Executor.execute(required.NormGate9, cmPols.NormGate9); return required.NormGate9.size(); }
+    if (sm == "poseidon_g") { e.poseidonGExecutor.execute(required.PoseidonG, cmPols.PoseidonG); return required.PoseidonG.size(); }
+    cerr << "Error: executeSM() found invalid state machine name " << sm << endl;
+    exitProcess();
+    return 0;
+}
+
+// Returns true if the output of sm is (directly or indirectly) an input of target
+bool isPrerequisite (const string &sm, const string &target)
+{
+    if (target == "poseidon_g") return (sm == "padding_pg") || (sm == "storage");
+    const vector<string> keccakChain = { "padding_kk", "padding_kk_bit", "nine2one", "keccak_f", "norm_gate9" };
+    int64_t smPos = -1;
+    int64_t targetPos = -1;
+    for (uint64_t i=0; i<keccakChain.size(); i++)
+    {
+        if (keccakChain[i] == sm) smPos = i;
+        if (keccakChain[i] == target) targetPos = i;
+    }
+    return (smPos >= 0) && (targetPos >= 0) && (smPos < targetPos);
+}
+
+int main (int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        cerr << "Usage: zkProverBench <config.json> <required file> [<sm>|all] [warm-ups] [repetitions]" << endl;
+        return -1;
+    }
+    string target = (argc > 3) ? argv[3] : "all";
+    uint64_t warmUps = (argc > 4) ? strtoull(argv[4], NULL, 10) : 1;
+    uint64_t repetitions = (argc > 5) ? strtoull(argv[5], NULL, 10) : 5;
+    if (repetitions == 0) repetitions = 1;
+
+    json configJson;
+    file2json(argv[1], configJson);
+    Config config;
+    config.load(configJson);
+
+    Goldilocks fr;
+    PoseidonGoldilocks poseidon;
+
+    TimerStart(BENCH_LOAD_REQUIRED);
+    MainExecRequired loaded;
+    loaded.load(argv[2]);
+    TimerStopAndLog(BENCH_LOAD_REQUIRED);
+
+    TimerStart(BENCH_CREATE_EXECUTORS);
+    Executor executor(fr, config, poseidon);
+    TimerStopAndLog(BENCH_CREATE_EXECUTORS);
+
+    // The Keccak-f executor only loads its script by itself when the process generates proofs
+    if (!config.generateProof())
+    {
+        TimerStart(BENCH_LOAD_KECCAK_SCRIPT);
+        json keccakScript;
+        file2json(config.keccakScriptFile, keccakScript);
+        executor.keccakFExecutor.loadScript(keccakScript);
+        TimerStopAndLog(BENCH_LOAD_KECCAK_SCRIPT);
+    }
+
+    // Allocate the committed polynomials, as the prover does
+    void * pAddress = calloc(CommitPols::pilSize(), 1);
+    if (pAddress == NULL)
+    {
+        cerr << "Error: zkProverBench failed calling calloc(" << CommitPols::pilSize() << ")" << endl;
+        exitProcess();
+    }
+    CommitPols cmPols(pAddress, CommitPols::pilDegree());
+
+    // Select the state machines to measure
+    vector<string> measured;
+    for (uint64_t i=0; i<smNames.size(); i++)
+    {
+        if ((target == "all") || (target == smNames[i])) measured.push_back(smNames[i]);
+    }
+    if (measured.size() == 0)
+    {
+        cerr << "Error: zkProverBench found invalid state machine name " << target << endl;
+        exitProcess();
+    }
+
+    vector<uint64_t> totalTime(smNames.size(), 0); // us, added over all measured repetitions
+    vector<uint64_t> minTime(smNames.size(), UINT64_MAX);
+    vector<uint64_t> inputs(smNames.size(), 0);
+    uint64_t totalAllTime = 0;
+    uint64_t minAllTime = UINT64_MAX;
+
+    for (uint64_t rep=0; rep<warmUps+repetitions; rep++)
+    {
+        bool bMeasure = (rep >= warmUps);
+
+        // Use the inputs of the executor, so that only one copy of them is kept
+        executor.required = loaded;
+        for (uint64_t i=0; i<smNames.size(); i++)
+        {
+            bool bTimed = (target == "all") || (target == smNames[i]);
+            if (!bTimed && !isPrerequisite(smNames[i], target)) continue;
+
+            struct timeval start;
+            gettimeofday(&start, NULL);
+            uint64_t n = executeSM(smNames[i], executor, executor.required, cmPols);
+            uint64_t elapsed = TimeDiff(start);
+
+            if (bTimed && bMeasure)
+            {
+                totalTime[i] += elapsed;
+                if (elapsed < minTime[i]) minTime[i] = elapsed;
+                inputs[i] = n;
+            }
+        }
+
+        // Measure all of them together, as the prover executes them
+        if (target == "all")
+        {
+            executor.required = loaded;
+            struct timeval start;
+            gettimeofday(&start, NULL);
+            executor.executeSecondary(cmPols);
+            uint64_t elapsed = TimeDiff(start);
+            if (bMeasure)
+            {
+                totalAllTime += elapsed;
+                if (elapsed < minAllTime) minAllTime = elapsed;
+            }
+        }
+    }
+
+    // Report, one line per state machine, in a format easy to parse
+    cout << "sm,inputs,avg_ms,min_ms,inputs_per_s" << endl;
+    for (uint64_t i=0; i<smNames.size(); i++)
+    {
+        if (minTime[i] == UINT64_MAX) continue;
+        double avg = double(totalTime[i]) / repetitions;
+        cout << smNames[i] << "," << inputs[i] << "," << avg/1000 << "," << double(minTime[i])/1000 << "," << (avg == 0 ? 0 : inputs[i]*1000000/avg) << endl;
+    }
+    if (target == "all")
+    {
+        cout << "all,," << double(totalAllTime)/repetitions/1000 << "," << double(minAllTime)/1000 << "," << endl;
+    }
+
+    free(pAddress);
+    return 0;
+}
@@ -5,6 +5,9 @@ typedef unsigned char u8;
 typedef unsigned long long int u64;
 typedef unsigned int ui;
 
+// Keccak-f[1600] permutation over a 200-byte state, i.e. 25 lanes of 64 bits in little endian
+void KeccakF1600(void *s);
+
 void Keccak(ui r, ui c, const u8 *in, u64 inLen, u8 sfx, u8 *out, u64 outLen);
 
 void FIPS202_SHAKE128(const u8 *in, u64 inLen, u8 *out, u64 outLen);
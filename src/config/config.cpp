@@ -49,6 +49,12 @@ void Config::load(json &config)
     {
         runStateDBTest = config["runStateDBTest"];
     }
+    runMetricsServer = false;
+    if (config.contains("runMetricsServer") && 
+        config["runMetricsServer"].is_boolean())
+    {
+        runMetricsServer = config["runMetricsServer"];
+    }
     runFile = false;
     if (config.contains("runFile") && 
         config["runFile"].is_boolean())
@@ -91,6 +97,18 @@ void Config::load(json &config)
     {
         runMemAlignSMTest = config["runMemAlignSMTest"];
     }
+    runMainSMTest = false;
+    if (config.contains("runMainSMTest") && 
+        config["runMainSMTest"].is_boolean())
+    {
+        runMainSMTest = config["runMainSMTest"];
+    }
+    runDatabaseTest = false;
+    if (config.contains("runDatabaseTest") && 
+        config["runDatabaseTest"].is_boolean())
+    {
+        runDatabaseTest = config["runDatabaseTest"];
+    }
     runStarkTest = false;
     if (config.contains("runStarkTest") && 
         config["runStarkTest"].is_boolean())
@@ -151,23 +169,119 @@ void Config::load(json &config)
     {
         executorClientHost = config["executorClientHost"];
     }
+    executorPoolSize = 1;
+    if (config.contains("executorPoolSize") && 
+        config["executorPoolSize"].is_number())
+    {
+        executorPoolSize = config["executorPoolSize"];
+    }
+    executorPoolTimeout = 60000;
+    if (config.contains("executorPoolTimeout") && 
+        config["executorPoolTimeout"].is_number())
+    {
+        executorPoolTimeout = config["executorPoolTimeout"];
+    }
+    executorStreamChunkSteps = 1000;
+    if (config.contains("executorStreamChunkSteps") && 
+        config["executorStreamChunkSteps"].is_number())
+    {
+        executorStreamChunkSteps = config["executorStreamChunkSteps"];
+    }
+    executorStreamQueueSize = 1000;
+    if (config.contains("executorStreamQueueSize") && 
+        config["executorStreamQueueSize"].is_number())
+    {
+        executorStreamQueueSize = config["executorStreamQueueSize"];
+    }
+    executorClientLoadThreads = 0;
+    if (config.contains("executorClientLoadThreads") && 
+        config["executorClientLoadThreads"].is_number())
+    {
+        executorClientLoadThreads = config["executorClientLoadThreads"];
+    }
+    executorClientLoadRequests = 100;
+    if (config.contains("executorClientLoadRequests") && 
+        config["executorClientLoadRequests"].is_number())
+    {
+        executorClientLoadRequests = config["executorClientLoadRequests"];
+    }
     stateDBServerPort = 50061;
     if (config.contains("stateDBServerPort") && 
         config["stateDBServerPort"].is_number())
     {
         stateDBServerPort = config["stateDBServerPort"];
     }    
+    metricsServerPort = 50091;
+    if (config.contains("metricsServerPort") && 
+        config["metricsServerPort"].is_number())
+    {
+        metricsServerPort = config["metricsServerPort"];
+    }
+    asyncServers = false;
+    if (config.contains("asyncServers") && 
+        config["asyncServers"].is_boolean())
+    {
+        asyncServers = config["asyncServers"];
+    }
+    asyncServerPollingThreads = 2;
+    if (config.contains("asyncServerPollingThreads") && 
+        config["asyncServerPollingThreads"].is_number())
+    {
+        asyncServerPollingThreads = config["asyncServerPollingThreads"];
+    }
+    asyncServerWorkerThreads = 16;
+    if (config.contains("asyncServerWorkerThreads") && 
+        config["asyncServerWorkerThreads"].is_number())
+    {
+        asyncServerWorkerThreads = config["asyncServerWorkerThreads"];
+    }
+    asyncServerMaxInFlight = 256;
+    if (config.contains("asyncServerMaxInFlight") && 
+        config["asyncServerMaxInFlight"].is_number())
+    {
+        asyncServerMaxInFlight = config["asyncServerMaxInFlight"];
+    }
     stateDBURL = "local";
     if (config.contains("stateDBURL") && 
         config["stateDBURL"].is_string())
     {
         stateDBURL = config["stateDBURL"];
     }    
+    programCacheSize = 64;
+    if (config.contains("programCacheSize") && 
+        config["programCacheSize"].is_number())
+    {
+        programCacheSize = config["programCacheSize"];
+    }
     if (config.contains("inputFile") && 
         config["inputFile"].is_string())
     {
         inputFile = config["inputFile"];
     }
+    saveInputPolicy = "always";
+    if (config.contains("saveInputPolicy") && 
+        config["saveInputPolicy"].is_string())
+    {
+        saveInputPolicy = config["saveInputPolicy"];
+    }
+    saveInputSampleRate = 100;
+    if (config.contains("saveInputSampleRate") && 
+        config["saveInputSampleRate"].is_number())
+    {
+        saveInputSampleRate = config["saveInputSampleRate"];
+    }
+    saveInputQueueSize = 16;
+    if (config.contains("saveInputQueueSize") && 
+        config["saveInputQueueSize"].is_number())
+    {
+        saveInputQueueSize = config["saveInputQueueSize"];
+    }
+    saveInputBinary = false;
+    if (config.contains("saveInputBinary") && 
+        config["saveInputBinary"].is_boolean())
+    {
+        saveInputBinary = config["saveInputBinary"];
+    }
     if (config.contains("romFile") && 
         config["romFile"].is_string())
     {
@@ -183,6 +297,11 @@ void Config::load(json &config)
     {
         cmPolsFile = config["cmPolsFile"];
     }
+    if (config.contains("mainExecRequiredFile") && 
+        config["mainExecRequiredFile"].is_string())
+    {
+        mainExecRequiredFile = config["mainExecRequiredFile"];
+    }
     if (config.contains("constPolsFile") && 
         config["constPolsFile"].is_string())
     {
@@ -205,6 +324,21 @@ void Config::load(json &config)
     {
         mapConstantsTreeFile = config["mapConstantsTreeFile"];
     }
+    if (config.contains("constPolsSharedMemory") && 
+        config["constPolsSharedMemory"].is_string())
+    {
+        constPolsSharedMemory = config["constPolsSharedMemory"];
+    }
+    if (config.contains("hugePagesPath") && 
+        config["hugePagesPath"].is_string())
+    {
+        hugePagesPath = config["hugePagesPath"];
+    }
+    if (config.contains("domainCachePath") && 
+        config["domainCachePath"].is_string())
+    {
+        domainCachePath = config["domainCachePath"];
+    }
     if (config.contains("starkFile") && 
         config["starkFile"].is_string())
     {
@@ -265,6 +399,12 @@ void Config::load(json &config)
     {
         storagePolsFile = config["storagePolsFile"];
     }
+    storageHashCheckPeriod = 0;
+    if (config.contains("storageHashCheckPeriod") && 
+        config["storageHashCheckPeriod"].is_number())
+    {
+        storageHashCheckPeriod = config["storageHashCheckPeriod"];
+    }
     if (config.contains("memoryPilFile") && 
         config["memoryPilFile"].is_string())
     {
@@ -310,12 +450,42 @@ void Config::load(json &config)
     {
         dbTableName = config["dbTableName"];
     }
+    dbProgramTableName = "state.program";
+    if (config.contains("dbProgramTableName") && 
+        config["dbProgramTableName"].is_string())
+    {
+        dbProgramTableName = config["dbProgramTableName"];
+    }
     dbAsyncWrite = false;
     if (config.contains("dbAsyncWrite") && 
         config["dbAsyncWrite"].is_boolean())
     {
         dbAsyncWrite = config["dbAsyncWrite"];
     }    
+    dbNodeStoreCommitPeriod = 1000;
+    if (config.contains("dbNodeStoreCommitPeriod") && 
+        config["dbNodeStoreCommitPeriod"].is_number())
+    {
+        dbNodeStoreCommitPeriod = config["dbNodeStoreCommitPeriod"];
+    }
+    dbCacheSnapshotFile = "";
+    if (config.contains("dbCacheSnapshotFile") && 
+        config["dbCacheSnapshotFile"].is_string())
+    {
+        dbCacheSnapshotFile = config["dbCacheSnapshotFile"];
+    }
+    dbCacheSnapshotPeriod = 600;
+    if (config.contains("dbCacheSnapshotPeriod") && 
+        config["dbCacheSnapshotPeriod"].is_number())
+    {
+        dbCacheSnapshotPeriod = config["dbCacheSnapshotPeriod"];
+    }
+    dbNodeClientBatchSize = 1000;
+    if (config.contains("dbNodeClientBatchSize") && 
+        config["dbNodeClientBatchSize"].is_number())
+    {
+        dbNodeClientBatchSize = config["dbNodeClientBatchSize"];
+    }
     if (config.contains("cleanerPollingPeriod") && 
         config["cleanerPollingPeriod"].is_number())
     {
@@ -338,6 +508,7 @@ void Config::print (void)
     if (runExecutorClient) cout << "runExecutorClient=true" << endl;
     if (runStateDBServer) cout << "runStateDBServer=true" << endl;
     if (runStateDBTest) cout << "runStateDBTest=true" << endl;
+    if (runMetricsServer) cout << "runMetricsServer=true" << endl;
     if (runFile) cout << "runFile=true" << endl;
     if (runFileFast) cout << "runFileFast=true" << endl;
     if (runKeccakScriptGenerator) cout << "runKeccakScriptGenerator=true" << endl;
@@ -345,6 +516,8 @@ void Config::print (void)
     if (runStorageSMTest) cout << "runStorageSMTest=true" << endl;
     if (runBinarySMTest) cout << "runBinarySMTest=true" << endl;
     if (runMemAlignSMTest) cout << "runMemAlignSMTest=true" << endl;
+    if (runMainSMTest) cout << "runMainSMTest=true" << endl;
+    if (runDatabaseTest) cout << "runDatabaseTest=true" << endl;
     if (runStarkTest) cout << "runStarkTest=true" << endl;
     if (executeInParallel) cout << "executeInParallel=true" << endl;
     if (useMainExecGenerated) cout << "useMainExecGenerated=true" << endl;
@@ -355,16 +528,36 @@ void Config::print (void)
     cout << "executorServerPort=" << to_string(executorServerPort) << endl;
     cout << "executorClientPort=" << to_string(executorClientPort) << endl;
     cout << "executorClientHost=" << executorClientHost << endl;
+    cout << "executorPoolSize=" << executorPoolSize << endl;
+    cout << "executorPoolTimeout=" << executorPoolTimeout << endl;
+    cout << "executorStreamChunkSteps=" << executorStreamChunkSteps << endl;
+    cout << "executorStreamQueueSize=" << executorStreamQueueSize << endl;
+    cout << "executorClientLoadThreads=" << executorClientLoadThreads << endl;
+    cout << "executorClientLoadRequests=" << executorClientLoadRequests << endl;
     cout << "stateDBServerPort=" << to_string(stateDBServerPort) << endl;
+    cout << "metricsServerPort=" << to_string(metricsServerPort) << endl;
+    if (asyncServers) cout << "asyncServers=true" << endl;
+    cout << "asyncServerPollingThreads=" << asyncServerPollingThreads << endl;
+    cout << "asyncServerWorkerThreads=" << asyncServerWorkerThreads << endl;
+    cout << "asyncServerMaxInFlight=" << asyncServerMaxInFlight << endl;
     cout << "stateDBURL=" << stateDBURL << endl;
+    cout << "programCacheSize=" << programCacheSize << endl;
     cout << "inputFile=" << inputFile << endl;
+    cout << "saveInputPolicy=" << saveInputPolicy << endl;
+    cout << "saveInputSampleRate=" << saveInputSampleRate << endl;
+    cout << "saveInputQueueSize=" << saveInputQueueSize << endl;
+    if (saveInputBinary) cout << "saveInputBinary=true" << endl;
     cout << "outputPath=" << outputPath << endl;
     cout << "romFile=" << romFile << endl;
     cout << "cmPolsFile=" << cmPolsFile << endl;
+    cout << "mainExecRequiredFile=" << mainExecRequiredFile << endl;
     cout << "constPolsFile=" << constPolsFile << endl;
     if (mapConstPolsFile) cout << "mapConstPolsFile=true" << endl;
     cout << "constantsTreeFile=" << constantsTreeFile << endl;
     if (mapConstantsTreeFile) cout << "mapConstantsTreeFile=true" << endl;
+    cout << "constPolsSharedMemory=" << constPolsSharedMemory << endl;
+    cout << "hugePagesPath=" << hugePagesPath << endl;
+    cout << "domainCachePath=" << domainCachePath << endl;
     cout << "starkFile=" << starkFile << endl;
     cout << "verifierFile=" << verifierFile << endl;
     cout << "witnessFile=" << witnessFile << endl;
@@ -377,6 +570,7 @@ void Config::print (void)
     cout << "storageRomFile=" << storageRomFile << endl;
     cout << "storagePilFile=" << storagePilFile << endl;
     cout << "storagePolsFile=" << storagePolsFile << endl;
+    cout << "storageHashCheckPeriod=" << storageHashCheckPeriod << endl;
     cout << "memoryPilFile=" << memoryPilFile << endl;
     cout << "memoryPolsFile=" << memoryPolsFile << endl;
     cout << "binaryPilFile=" << binaryPilFile << endl;
@@ -385,7 +579,12 @@ void Config::print (void)
     cout << "starkInfoFile=" << starkInfoFile << endl;
     cout << "databaseURL=" << databaseURL << endl;
     cout << "dbTableName=" << dbTableName << endl;
+    cout << "dbProgramTableName=" << dbProgramTableName << endl;
     cout << "dbAsyncWrite=" << to_string(dbAsyncWrite) << endl;
+    cout << "dbNodeStoreCommitPeriod=" << dbNodeStoreCommitPeriod << endl;
+    cout << "dbCacheSnapshotFile=" << dbCacheSnapshotFile << endl;
+    cout << "dbCacheSnapshotPeriod=" << dbCacheSnapshotPeriod << endl;
+    cout << "dbNodeClientBatchSize=" << dbNodeClientBatchSize << endl;
     cout << "cleanerPollingPeriod=" << cleanerPollingPeriod << endl;
     cout << "requestsPersistence=" << requestsPersistence << endl;
 }
\ No newline at end of file
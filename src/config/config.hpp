@@ -19,6 +19,7 @@ public:
     bool runExecutorClient;
     bool runStateDBServer;
     bool runStateDBTest;
+    bool runMetricsServer;
     bool runFile;
     bool runFileFast;
     bool runKeccakScriptGenerator;
@@ -26,6 +27,8 @@ public:
     bool runStorageSMTest;
     bool runBinarySMTest;
     bool runMemAlignSMTest;
+    bool runMainSMTest;
+    bool runDatabaseTest;
     bool runStarkTest;
     bool executeInParallel;
     bool useMainExecGenerated;
@@ -36,16 +39,36 @@ public:
     uint16_t executorServerPort;
     uint16_t executorClientPort;
     string executorClientHost;
+    uint64_t executorPoolSize;
+    uint64_t executorPoolTimeout;
+    uint64_t executorStreamChunkSteps;
+    uint64_t executorStreamQueueSize;
+    uint64_t executorClientLoadThreads;
+    uint64_t executorClientLoadRequests;
     uint16_t stateDBServerPort;
+    uint16_t metricsServerPort;
+    bool asyncServers;
+    uint64_t asyncServerPollingThreads;
+    uint64_t asyncServerWorkerThreads;
+    uint64_t asyncServerMaxInFlight;
     string stateDBURL;
+    uint64_t programCacheSize;
     string inputFile;
+    string saveInputPolicy;
+    uint64_t saveInputSampleRate;
+    uint64_t saveInputQueueSize;
+    bool saveInputBinary;
     string outputPath;
     string romFile;
     string cmPolsFile;
+    string mainExecRequiredFile;
     string constPolsFile;
     bool mapConstPolsFile;
     string constantsTreeFile;
     bool mapConstantsTreeFile;
+    string constPolsSharedMemory;
+    string hugePagesPath;
+    string domainCachePath;
     string starkFile;
     string verifierFile;
     string witnessFile;
@@ -58,6 +81,7 @@ public:
     string storageRomFile;
     string storagePilFile;
     string storagePolsFile;
+    uint64_t storageHashCheckPeriod;
     string memoryPilFile;
     string memoryPolsFile;
     string binaryPilFile;
@@ -66,7 +90,12 @@ public:
     string starkInfoFile;
     string databaseURL;
     string dbTableName;
+    string dbProgramTableName;
     bool dbAsyncWrite;
+    uint64_t dbNodeStoreCommitPeriod;
+    string dbCacheSnapshotFile;
+    uint64_t dbCacheSnapshotPeriod;
+    uint64_t dbNodeClientBatchSize;
     uint64_t cleanerPollingPeriod;
     uint64_t requestsPersistence;
     void load (json &config);
@@ -1,3 +1,4 @@
+#include <cstddef>
 #include "zkresult.hpp"
 
 struct {
@@ -18,7 +19,11 @@ struct {
     { ZKR_SM_MAIN_MEMORY, "Main state machine executor memory condition failed" },
     { ZKR_SM_MAIN_MEMALIGN, "Main state machine executor memalign condition failed" },
     { ZKR_SM_MAIN_ADDRESS, "Main state machine executor address condition failed" },
-    { ZKR_SMT_INVALID_DATA_SIZE, "Invalid size data for a MT node"}
+    { ZKR_SMT_INVALID_DATA_SIZE, "Invalid size data for a MT node"},
+    { ZKR_EXECUTOR_BUSY, "All executor contexts are busy"},
+    { ZKR_SM_MAIN_OUT_OF_COUNTERS, "Main state machine executor out of counters"},
+    { ZKR_SM_MAIN_CANCELLED, "Main state machine executor cancelled"},
+    { 0, NULL }
 };
 
 const char* zkresult2string (int code)
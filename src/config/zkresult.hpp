@@ -17,7 +17,10 @@ typedef enum : int
     ZKR_SM_MAIN_MEMORY = 11, // Main state machine executor memory condition failed
     ZKR_SM_MAIN_MEMALIGN = 12, // Main state machine executor memalign condition failed
     ZKR_SM_MAIN_ADDRESS = 13, // Main state machine executor address condition failed
-    ZKR_SMT_INVALID_DATA_SIZE = 14 // Invalid size data for a MT node
+    ZKR_SMT_INVALID_DATA_SIZE = 14, // Invalid size data for a MT node
+    ZKR_EXECUTOR_BUSY = 15, // All executor contexts are in use; the client should retry later
+    ZKR_SM_MAIN_OUT_OF_COUNTERS = 16, // Main state machine executor exceeded the capacity of a secondary state machine
+    ZKR_SM_MAIN_CANCELLED = 17 // Main state machine executor was cancelled, e.g. because the client is gone
 } zkresult;
 
 const char* zkresult2string (int code);
@@ -72,12 +72,14 @@ public:
     Executor * pExecutor;
     MainExecRequired * pRequired;
     CommitPols * pCommitPols;
+    string metricsPath; // Metrics span of the caller, parent of the threads spans
 };
 
 void* Byte4Thread (void* arg)
 {
     // Get the context
     ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
+    metrics.setSpanPath(pExecutorContext->metricsPath);
     
     // Execute the Byte4 State Machine
     TimerStart(BYTE4_SM_EXECUTE_THREAD);
@@ -91,6 +93,7 @@ void* BinaryThread (void* arg)
 {
     // Get the context
     ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
+    metrics.setSpanPath(pExecutorContext->metricsPath);
     
     // Execute the Binary State Machine
     TimerStart(BINARY_SM_EXECUTE_THREAD);
@@ -104,6 +107,7 @@ void* MemAlignThread (void* arg)
 {
     // Get the context
     ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
+    metrics.setSpanPath(pExecutorContext->metricsPath);
     
     // Execute the MemAlign State Machine
     TimerStart(MEM_ALIGN_SM_EXECUTE_THREAD);
@@ -117,6 +121,7 @@ void* MemoryThread (void* arg)
 {
     // Get the context
     ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
+    metrics.setSpanPath(pExecutorContext->metricsPath);
     
     // Execute the Binary State Machine
     TimerStart(MEMORY_SM_EXECUTE_THREAD);
@@ -130,6 +135,7 @@ void* ArithThread (void* arg)
 {
     // Get the context
     ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
+    metrics.setSpanPath(pExecutorContext->metricsPath);
     
     // Execute the Binary State Machine
     TimerStart(ARITH_SM_EXECUTE_THREAD);
@@ -143,6 +149,7 @@ void* PoseidonThread (void* arg)
 {
     // Get the context
     ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
+    metrics.setSpanPath(pExecutorContext->metricsPath);
     
     // Execute the Padding PG State Machine
     TimerStart(PADDING_PG_SM_EXECUTE_THREAD);
@@ -166,6 +173,7 @@ void* KeccakThread (void* arg)
 {
     // Get the context
     ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
+    metrics.setSpanPath(pExecutorContext->metricsPath);
     
     // Execute the Padding KK State Machine
     TimerStart(PADDING_KK_SM_EXECUTE_THREAD);
@@ -198,28 +206,44 @@ void* KeccakThread (void* arg)
 // Full version: all polynomials are evaluated, in all evaluations
 void Executor::execute (ProverRequest &proverRequest, CommitPols & commitPols)
 {
-    if (!config.executeInParallel)
+    // This instance will store all data required to execute the rest of State Machines; reserve
+    // room for the largest execution that fits, once, since clear() keeps the buffers afterwards
+    required.clear();
+    required.reserve(mainExecutor.countersLimits);
+
+    // Execute the Main State Machine
+    TimerStart(MAIN_EXECUTOR_EXECUTE);
+    if (config.useMainExecGenerated)
     {
-        // This instance will store all data required to execute the rest of State Machines
-        MainExecRequired required;
+        //main_exec_generated(fr, proverRequest.input, commitPols.Main, proverRequest.db, proverRequest.counters, required);
+    }
+    else
+    {
+        mainExecutor.execute(proverRequest, commitPols.Main, required);
+    }
+    TimerStopAndLog(MAIN_EXECUTOR_EXECUTE);
 
-        // Execute the Main State Machine
-        TimerStart(MAIN_EXECUTOR_EXECUTE);
-        if (config.useMainExecGenerated)
-        {
-            //main_exec_generated(fr, proverRequest.input, commitPols.Main, proverRequest.db, proverRequest.counters, required);
-        }
-        else
-        {
-            mainExecutor.execute(proverRequest, commitPols.Main, required);
-        }
-        TimerStopAndLog(MAIN_EXECUTOR_EXECUTE);
+    if (proverRequest.result != ZKR_SUCCESS)
+    {
+        return;
+    }
 
-        if (proverRequest.result != ZKR_SUCCESS)
-        {
-            return;
-        }
+    // Save the secondary state machines inputs, to replay them with zkProverBench
+    if (config.mainExecRequiredFile.size() > 0)
+    {
+        TimerStart(SAVE_MAIN_EXEC_REQUIRED);
+        required.save(config.mainExecRequiredFile);
+        TimerStopAndLog(SAVE_MAIN_EXEC_REQUIRED);
+    }
 
+    executeSecondary(commitPols);
+}
+
+// Executes the secondary State Machines over the data in required, in parallel if configured
+void Executor::executeSecondary (CommitPols & commitPols)
+{
+    if (!config.executeInParallel)
+    {
         // Execute the Padding PG State Machine
         TimerStart(PADDING_PG_SM_EXECUTE);
         paddingPGExecutor.execute(required.PaddingPG, commitPols.PaddingPG, required.PoseidonG);
@@ -287,30 +311,11 @@ void Executor::execute (ProverRequest &proverRequest, CommitPols & commitPols)
     }
     else
     {
-
-        // This instance will store all data required to execute the rest of State Machines
-        MainExecRequired required;
         ExecutorContext executorContext;
         executorContext.pExecutor = this;
         executorContext.pCommitPols = &commitPols;
         executorContext.pRequired = &required;
-
-        // Execute the Main State Machine
-        TimerStart(MAIN_EXECUTOR_EXECUTE);
-        if (config.useMainExecGenerated)
-        {
-            //main_exec_generated(fr, proverRequest.input, commitPols.Main, proverRequest.db, proverRequest.counters, required);
-        }
-        else
-        {
-            mainExecutor.execute(proverRequest, commitPols.Main, required);
-        }
-        TimerStopAndLog(MAIN_EXECUTOR_EXECUTE);
-
-        if (proverRequest.result != ZKR_SUCCESS)
-        {
-            return;
-        }
+        executorContext.metricsPath = metrics.getSpanPath();
 
         // Execute the Padding PG, Storage and Poseidon G State Machines
         pthread_t poseidonThread;
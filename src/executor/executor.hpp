@@ -41,6 +41,10 @@ public:
     PoseidonGExecutor poseidonGExecutor;
     MemAlignExecutor memAlignExecutor;
 
+    // Data required to execute the secondary State Machines, reused across full executions so that
+    // its buffers are allocated once per executor context instead of grown again for every proof
+    MainExecRequired required;
+
     Executor(Goldilocks &fr, const Config &config, PoseidonGoldilocks &poseidon) :
         fr(fr),
         config(config),
@@ -63,6 +67,9 @@ public:
     // Full version: all polynomials are evaluated, in all evaluations
     void execute (ProverRequest &proverRequest, CommitPols & commitPols);
 
+    // Executes only the secondary State Machines, over the data already in required
+    void executeSecondary (CommitPols & commitPols);
+
     // Fast version: only 2 evaluations are allocated, and only MainCommitPols are evaluated
     void execute_fast (ProverRequest &proverRequest);
 
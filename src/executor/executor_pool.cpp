@@ -0,0 +1,92 @@
+#include <time.h>
+#include "executor_pool.hpp"
+#include "utils.hpp"
+#include "timer.hpp"
+#include "zkassert.hpp"
+
+ExecutorPool::ExecutorPool (Goldilocks &fr, const Config &config, PoseidonGoldilocks &poseidon)
+{
+    if (config.executorPoolSize == 0)
+    {
+        cerr << "Error: ExecutorPool::ExecutorPool() found executorPoolSize=0" << endl;
+        exitProcess();
+    }
+
+    pthread_mutex_init(&mutex, NULL);
+    pthread_cond_init(&freeCond, 0);
+
+    TimerStart(EXECUTOR_POOL_CREATE);
+    for (uint64_t i=0; i<config.executorPoolSize; i++)
+    {
+        Executor * pExecutor = new Executor(fr, config, poseidon);
+        if (pExecutor == NULL)
+        {
+            cerr << "Error: ExecutorPool::ExecutorPool() failed calling new Executor()" << endl;
+            exitProcess();
+        }
+        executors.push_back(pExecutor);
+        freeExecutors.push_back(pExecutor);
+    }
+    TimerStopAndLog(EXECUTOR_POOL_CREATE);
+    cout << "ExecutorPool::ExecutorPool() created " << executors.size() << " executor contexts" << endl;
+}
+
+ExecutorPool::~ExecutorPool ()
+{
+    for (uint64_t i=0; i<executors.size(); i++)
+    {
+        delete executors[i];
+    }
+    pthread_mutex_destroy(&mutex);
+    pthread_cond_destroy(&freeCond);
+}
+
+Executor * ExecutorPool::acquire (uint64_t timeoutMs)
+{
+    pthread_mutex_lock(&mutex);
+
+    if ((freeExecutors.size() == 0) && (timeoutMs > 0))
+    {
+        if (timeoutMs == EXECUTOR_POOL_WAIT_FOREVER)
+        {
+            while (freeExecutors.size() == 0) pthread_cond_wait(&freeCond, &mutex);
+        }
+        else
+        {
+            // Calculate the absolute deadline, as required by pthread_cond_timedwait()
+            timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_sec += timeoutMs / 1000;
+            deadline.tv_nsec += (timeoutMs % 1000) * 1000000;
+            if (deadline.tv_nsec >= 1000000000)
+            {
+                deadline.tv_sec += 1;
+                deadline.tv_nsec -= 1000000000;
+            }
+            while (freeExecutors.size() == 0)
+            {
+                if (pthread_cond_timedwait(&freeCond, &mutex, &deadline) != 0) break;
+            }
+        }
+    }
+
+    Executor * pExecutor = NULL;
+    if (freeExecutors.size() > 0)
+    {
+        pExecutor = freeExecutors.back();
+        freeExecutors.pop_back();
+    }
+
+    pthread_mutex_unlock(&mutex);
+    return pExecutor;
+}
+
+void ExecutorPool::release (Executor * pExecutor)
+{
+    zkassert(pExecutor != NULL);
+
+    pthread_mutex_lock(&mutex);
+    freeExecutors.push_back(pExecutor);
+    pthread_cond_signal(&freeCond);
+    pthread_mutex_unlock(&mutex);
+}
@@ -0,0 +1,40 @@
+#ifndef EXECUTOR_POOL_HPP
+#define EXECUTOR_POOL_HPP
+
+#include <pthread.h>
+#include <vector>
+#include "config.hpp"
+#include "goldilocks_base_field.hpp"
+#include "poseidon_goldilocks.hpp"
+#include "executor.hpp"
+
+#define EXECUTOR_POOL_WAIT_FOREVER 0xFFFFFFFFFFFFFFFF
+
+/*
+    Pool of independent executor contexts, sized by config.executorPoolSize
+    Every context owns its own MainExecutor (ROM, RawFec/RawFnec, StateDB client) and secondary
+    state machine executors, so up to executorPoolSize requests can be executed concurrently;
+    a context is used by a single request at a time, between acquire() and release()
+*/
+class ExecutorPool
+{
+    vector<Executor *> executors; // All the contexts, owned by the pool
+    vector<Executor *> freeExecutors; // Contexts not currently in use
+    pthread_mutex_t mutex; // Mutex to protect freeExecutors
+    pthread_cond_t freeCond; // Cond to signal when a context has been released
+
+public:
+    ExecutorPool(Goldilocks &fr, const Config &config, PoseidonGoldilocks &poseidon);
+    ~ExecutorPool();
+
+    // Returns a free context, waiting up to timeoutMs milliseconds for one to be released,
+    // or NULL if all contexts are still busy after that time; 0 means do not wait
+    Executor * acquire (uint64_t timeoutMs);
+
+    // Returns a context obtained through acquire() to the pool
+    void release (Executor * pExecutor);
+
+    uint64_t size (void) { return executors.size(); };
+};
+
+#endif
@@ -8,6 +8,8 @@ class Curve {
 
     void mulByA(typename BaseField::Element &r, typename BaseField::Element &ab);
 public:
+    typedef BaseField Field;
+
     struct Point {
         typename BaseField::Element x;
         typename BaseField::Element y;
@@ -117,7 +119,17 @@ public:
 
     void multiMulByScalar(Point &r, PointAffine *bases, uint8_t* scalars, unsigned int scalarSize, unsigned int n, unsigned int nThreads=0) {
         ParallelMultiexp<Curve<BaseField>> pm(*this);
-        pm.multiexp(r, bases, scalars, scalarSize, n);
+        pm.multiexp(r, bases, scalars, scalarSize, n, nThreads);
+    }
+
+    void multiMulByScalar(Point &r, MultiexpTable<Curve<BaseField>> &table, uint8_t* scalars, unsigned int scalarSize, unsigned int n, unsigned int nThreads=0) {
+        ParallelMultiexp<Curve<BaseField>> pm(*this);
+        pm.multiexp(r, table, scalars, scalarSize, n, nThreads);
+    }
+
+    void precomputeMultiMulByScalar(MultiexpTable<Curve<BaseField>> &table, PointAffine *bases, unsigned int scalarSize, unsigned int n) {
+        ParallelMultiexp<Curve<BaseField>> pm(*this);
+        pm.precompute(table, bases, scalarSize, n);
     }
 
 #ifdef COUNT_OPS
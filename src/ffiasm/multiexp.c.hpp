@@ -1,5 +1,6 @@
 #include <omp.h>
 #include <memory.h>
+#include <stdexcept>
 #include "misc.hpp"
 /*
 template <typename Curve>
@@ -19,30 +20,163 @@ void ParallelMultiexp<Curve>::initAccs() {
     }
 }
 
+template <typename Curve>
+void ParallelMultiexp<Curve>::setChunkSize(uint32_t _n, uint32_t _scalarSize) {
+    bitsPerChunk = log2(_n / PME2_PACK_FACTOR);
+    if (bitsPerChunk > PME2_MAX_CHUNK_SIZE_BITS) bitsPerChunk = PME2_MAX_CHUNK_SIZE_BITS;
+    if (bitsPerChunk < PME2_MIN_CHUNK_SIZE_BITS) bitsPerChunk = PME2_MIN_CHUNK_SIZE_BITS;
+    nChunks = ((_scalarSize*8) / bitsPerChunk)+1; // The last chunk absorbs the carry of the signed digits
+    accsPerChunk = (1 << (bitsPerChunk-1)) + 1; // Signed digits only need buckets 1..2^(bitsPerChunk-1)
+}
+
 template <typename Curve>
 uint32_t ParallelMultiexp<Curve>::getChunk(uint32_t scalarIdx, uint32_t chunkIdx) {
     uint32_t bitStart = chunkIdx*bitsPerChunk;
+    if (bitStart >= scalarSize*8) return 0;
     uint32_t byteStart = bitStart/8;
     uint32_t efectiveBitsPerChunk = bitsPerChunk;
     if (byteStart > scalarSize-8) byteStart = scalarSize - 8;
     if (bitStart + bitsPerChunk > scalarSize*8) efectiveBitsPerChunk = scalarSize*8 - bitStart;
     uint32_t shift = bitStart - byteStart*8;
-    uint64_t v = *(uint64_t *)(scalars + scalarIdx*scalarSize + byteStart);
+    uint64_t v = *(uint64_t *)(scalars + (uint64_t)scalarIdx*scalarSize + byteStart);
     v = v >> shift;
     v = v & ( (1 << efectiveBitsPerChunk) - 1);
     return uint32_t(v);
 }
 
+// Returns the chunk as a signed digit in [-2^(bitsPerChunk-1)+1, 2^(bitsPerChunk-1)], carrying into the next chunk;
+// chunks of every scalar must be requested in increasing order
+template <typename Curve>
+int32_t ParallelMultiexp<Curve>::getSignedChunk(uint32_t scalarIdx, uint32_t chunkIdx) {
+    int32_t half = 1 << (bitsPerChunk-1);
+    int32_t d = getChunk(scalarIdx, chunkIdx) + carries[scalarIdx];
+    if (d > half) {
+        carries[scalarIdx] = 1;
+        return d - (1 << bitsPerChunk);
+    }
+    carries[scalarIdx] = 0;
+    return d;
+}
+
+/*
+    Adds batchPoints[j] to buckets[batchIdx[j]] in affine coordinates, sharing a single inversion for the
+    whole batch (Montgomery's trick). Callers guarantee that every bucket appears at most once, that no
+    bucket is zero and that no bucket has the same x as the point added to it.
+*/
+template <typename Curve>
+void ParallelMultiexp<Curve>::batchAddAffine(typename Curve::PointAffine *buckets, uint32_t *batchIdx, typename Curve::PointAffine *batchPoints, typename Curve::Field::Element *batchInv, uint32_t batchSize) {
+    if (batchSize == 0) return;
+
+    typename Curve::Field::Element acc;
+    typename Curve::Field::Element dx;
+    typename Curve::Field::Element lambda;
+    typename Curve::Field::Element x3;
+    typename Curve::Field::Element tmp;
+
+    // batchInv[j] = dx_0 * ... * dx_(j-1)
+    g.F.copy(acc, g.F.one());
+    for (uint32_t j=0; j<batchSize; j++) {
+        g.F.copy(batchInv[j], acc);
+        g.F.sub(dx, batchPoints[j].x, buckets[batchIdx[j]].x);
+        g.F.mul(acc, acc, dx);
+    }
+
+    g.F.inv(acc, acc);
+
+    for (int64_t j=batchSize-1; j>=0; j--) {
+        typename Curve::PointAffine &b = buckets[batchIdx[j]];
+        typename Curve::PointAffine &p = batchPoints[j];
+
+        // 1/dx_j = (dx_0 * ... * dx_(j-1)) / (dx_0 * ... * dx_j)
+        g.F.mul(batchInv[j], batchInv[j], acc);
+        g.F.sub(dx, p.x, b.x);
+        g.F.mul(acc, acc, dx);
+
+        // lambda = (y2-y1)/(x2-x1)
+        g.F.sub(tmp, p.y, b.y);
+        g.F.mul(lambda, tmp, batchInv[j]);
+
+        // x3 = lambda^2 - x1 - x2
+        g.F.square(x3, lambda);
+        g.F.sub(x3, x3, b.x);
+        g.F.sub(x3, x3, p.x);
+
+        // y3 = lambda*(x1 - x3) - y1
+        g.F.sub(tmp, b.x, x3);
+        g.F.mul(tmp, tmp, lambda);
+        g.F.sub(b.y, tmp, b.y);
+        g.F.copy(b.x, x3);
+    }
+}
+
 template <typename Curve>
 void ParallelMultiexp<Curve>::processChunk(uint32_t idChunk) {
-    #pragma omp parallel for
-    for(uint32_t i=0; i<n; i++) {
-        if (g.isZero(bases[i])) continue;
-        int idThread = omp_get_thread_num();
-        uint32_t chunkValue = getChunk(i, idChunk);
-        if (chunkValue) {
-            g.add(accs[idThread*accsPerChunk+chunkValue].p, accs[idThread*accsPerChunk+chunkValue].p, bases[i]);
+    #pragma omp parallel num_threads(nThreads)
+    {
+        uint32_t idThread = omp_get_thread_num();
+        uint32_t nWorkers = omp_get_num_threads();
+        PaddedPoint *threadAccs = &accs[idThread*accsPerChunk];
+
+        // Every thread takes a contiguous block of bases, so they are streamed in order, and keeps
+        // its buckets in affine coordinates to add them in batches
+        typename Curve::PointAffine *buckets = new typename Curve::PointAffine[accsPerChunk];
+        uint32_t *stamps = new uint32_t[accsPerChunk];
+        uint32_t batchIdx[PME2_BATCH_SIZE];
+        typename Curve::PointAffine *batchPoints = new typename Curve::PointAffine[PME2_BATCH_SIZE];
+        typename Curve::Field::Element *batchInv = new typename Curve::Field::Element[PME2_BATCH_SIZE];
+        for (uint64_t k=0; k<accsPerChunk; k++) {
+            g.copy(buckets[k], g.zeroAffine());
+            stamps[k] = 0;
         }
+        uint32_t batchId = 1;
+        uint32_t batchSize = 0;
+
+        uint32_t start = uint64_t(n)*idThread/nWorkers;
+        uint32_t end = uint64_t(n)*(idThread+1)/nWorkers;
+        for (uint32_t i=start; i<end; i++) {
+            if (g.isZero(bases[i])) continue;
+            int32_t digit = getSignedChunk(i, idChunk);
+            if (digit == 0) continue;
+
+            uint32_t k;
+            typename Curve::PointAffine p;
+            if (digit > 0) {
+                k = digit;
+                g.copy(p, bases[i]);
+            } else {
+                k = -digit;
+                g.neg(p, bases[i]);
+            }
+
+            if (g.isZero(buckets[k])) {
+                g.copy(buckets[k], p);
+            } else if ((stamps[k] == batchId) || g.F.eq(buckets[k].x, p.x)) {
+                // Bucket already pending in this batch, or a doubling/cancellation: fall back to the projective accumulator
+                g.add(threadAccs[k].p, threadAccs[k].p, p);
+            } else {
+                stamps[k] = batchId;
+                batchIdx[batchSize] = k;
+                g.copy(batchPoints[batchSize], p);
+                batchSize++;
+                if (batchSize == PME2_BATCH_SIZE) {
+                    batchAddAffine(buckets, batchIdx, batchPoints, batchInv, batchSize);
+                    batchSize = 0;
+                    batchId++;
+                }
+            }
+        }
+        batchAddAffine(buckets, batchIdx, batchPoints, batchInv, batchSize);
+
+        for (uint64_t k=1; k<accsPerChunk; k++) {
+            if (!g.isZero(buckets[k])) {
+                g.add(threadAccs[k].p, threadAccs[k].p, buckets[k]);
+            }
+        }
+
+        delete[] batchInv;
+        delete[] batchPoints;
+        delete[] stamps;
+        delete[] buckets;
     }
 }
 
@@ -59,40 +193,43 @@ void ParallelMultiexp<Curve>::packThreads() {
     }
 }
 
+// res = sum(k*accs[k]), computed as running sums over contiguous segments of buckets in parallel
 template <typename Curve>
-void ParallelMultiexp<Curve>::reduce(typename Curve::Point &res, uint32_t nBits) {
-    if (nBits==1) {
-        g.copy(res, accs[1].p);
-        g.copy(accs[1].p, g.zero());
-        return;
-    }
-    uint32_t ndiv2 = 1 << (nBits-1);
-
+void ParallelMultiexp<Curve>::reduce(typename Curve::Point &res) {
+    uint64_t nBuckets = accsPerChunk - 1;
+    uint32_t nSegments = nThreads;
+    if (nSegments > nBuckets) nSegments = nBuckets;
 
-    PaddedPoint *sall = new PaddedPoint[nThreads];
-    memset(sall, 0, sizeof(PaddedPoint)*nThreads);
+    PaddedPoint *segments = new PaddedPoint[nSegments];
 
-    //typename Curve::Point p;
     #pragma omp parallel for
-    for (uint32_t i = 1; i<ndiv2; i++) {
-        int idThread = omp_get_thread_num();
-        if (!g.isZero(accs[ndiv2 + i].p)) {
-            g.add(accs[i].p, accs[i].p, accs[ndiv2 + i].p);
-            g.add(sall[idThread].p, sall[idThread].p, accs[ndiv2 + i].p);
-            g.copy(accs[ndiv2 + i].p, g.zero());
+    for (uint32_t s=0; s<nSegments; s++) {
+        uint64_t lo = 1 + (nBuckets*s)/nSegments;
+        uint64_t hi = (nBuckets*(s+1))/nSegments;
+        typename Curve::Point running;
+        typename Curve::Point sum;
+        g.copy(running, g.zero());
+        g.copy(sum, g.zero());
+        for (uint64_t k=hi; k>=lo; k--) {
+            g.add(running, running, accs[k].p);
+            g.add(sum, sum, running);
+            g.copy(accs[k].p, g.zero());
         }
+        // sum holds (k-lo+1)*accs[k]; add the missing (lo-1) times the segment total
+        uint64_t w = lo-1;
+        if (w > 0) {
+            typename Curve::Point p;
+            g.mulByScalar(p, running, (uint8_t *)&w, sizeof(w));
+            g.add(sum, sum, p);
+        }
+        g.copy(segments[s].p, sum);
     }
-    for (u_int32_t i=0; i<nThreads; i++) {
-        g.add(accs[ndiv2].p, accs[ndiv2].p, sall[i].p);
-    }
-
-    typename Curve::Point p1;
-    reduce(p1, nBits-1);
 
-    for (u_int32_t i=0; i<nBits-1; i++) g.dbl(accs[ndiv2].p, accs[ndiv2].p);
-    g.add(res, p1, accs[ndiv2].p);
-    g.copy(accs[ndiv2].p, g.zero());
-    delete[] sall;
+    g.copy(res, g.zero());
+    for (uint32_t s=0; s<nSegments; s++) {
+        g.add(res, res, segments[s].p);
+    }
+    delete[] segments;
 }
 
 template <typename Curve>
@@ -112,26 +249,25 @@ void ParallelMultiexp<Curve>::multiexp(typename Curve::Point &r, typename Curve:
         g.mulByScalar(r, bases[0], scalars, scalarSize);
         return;
     }
-    bitsPerChunk = log2(n / PME2_PACK_FACTOR);
-    if (bitsPerChunk > PME2_MAX_CHUNK_SIZE_BITS) bitsPerChunk = PME2_MAX_CHUNK_SIZE_BITS;
-    if (bitsPerChunk < PME2_MIN_CHUNK_SIZE_BITS) bitsPerChunk = PME2_MIN_CHUNK_SIZE_BITS;
-    nChunks = ((scalarSize*8 - 1 ) / bitsPerChunk)+1;
-    accsPerChunk = 1 << bitsPerChunk;  // In the chunks last bit is always zero.
+    setChunkSize(n, scalarSize);
 
     typename Curve::Point *chunkResults = new typename Curve::Point[nChunks];
     accs = new PaddedPoint[nThreads*accsPerChunk];
-    // std::cout << "InitTrees " << "\n"; 
+    carries = new uint8_t[n];
+    memset(carries, 0, n);
+    // std::cout << "InitTrees " << "\n";
     initAccs();
 
     for (uint32_t i=0; i<nChunks; i++) {
-        // std::cout << "process chunks " << i << "\n"; 
+        // std::cout << "process chunks " << i << "\n";
         processChunk(i);
-        // std::cout << "pack " << i << "\n"; 
+        // std::cout << "pack " << i << "\n";
         packThreads();
-        // std::cout << "reduce " << i << "\n"; 
-        reduce(chunkResults[i], bitsPerChunk);
+        // std::cout << "reduce " << i << "\n";
+        reduce(chunkResults[i]);
     }
 
+    delete[] carries;
     delete[] accs;
 
     g.copy(r, chunkResults[nChunks-1]);
@@ -140,5 +276,68 @@ void ParallelMultiexp<Curve>::multiexp(typename Curve::Point &r, typename Curve:
         g.add(r, r, chunkResults[j]);
     }
 
-    delete[] chunkResults; 
+    delete[] chunkResults;
+}
+
+template <typename Curve>
+void ParallelMultiexp<Curve>::multiexp(typename Curve::Point &r, MultiexpTable<Curve> &table, uint8_t* _scalars, uint32_t _scalarSize, uint32_t _n, uint32_t _nThreads) {
+    if ((table.points == NULL) || (_n > table.n)) {
+        throw std::invalid_argument("ParallelMultiexp::multiexp() table does not hold enough bases");
+    }
+    if (_scalarSize > table.scalarSize) {
+        // Row 0 of the table holds the bases themselves
+        multiexp(r, table.points, _scalars, _scalarSize, _n, _nThreads);
+        return;
+    }
+
+    nThreads = _nThreads==0 ? omp_get_max_threads() : _nThreads;
+    scalars = _scalars;
+    scalarSize = _scalarSize;
+    n = _n;
+
+    if (n==0) {
+        g.copy(r, g.zero());
+        return;
+    }
+    bitsPerChunk = table.bitsPerChunk;
+    nChunks = table.nChunks;
+    accsPerChunk = (1 << (bitsPerChunk-1)) + 1;
+
+    accs = new PaddedPoint[nThreads*accsPerChunk];
+    carries = new uint8_t[n];
+    memset(carries, 0, n);
+    initAccs();
+
+    // Chunk i of the scalars multiplies row i of the table, so all chunks share the same buckets
+    for (uint32_t i=0; i<nChunks; i++) {
+        bases = table.points + uint64_t(i)*table.n;
+        processChunk(i);
+    }
+    packThreads();
+    reduce(r);
+
+    delete[] carries;
+    delete[] accs;
+}
+
+template <typename Curve>
+void ParallelMultiexp<Curve>::precompute(MultiexpTable<Curve> &table, typename Curve::PointAffine *_bases, uint32_t _scalarSize, uint32_t _n) {
+    if (table.points != NULL) delete[] table.points;
+
+    setChunkSize(_n, _scalarSize);
+    table.n = _n;
+    table.scalarSize = _scalarSize;
+    table.bitsPerChunk = bitsPerChunk;
+    table.nChunks = nChunks;
+    table.points = new typename Curve::PointAffine[uint64_t(nChunks)*_n];
+
+    #pragma omp parallel for
+    for (uint32_t i=0; i<_n; i++) {
+        typename Curve::Point p;
+        g.copy(p, _bases[i]);
+        for (uint32_t j=0; j<nChunks; j++) {
+            g.copy(table.points[uint64_t(j)*_n + i], p);
+            for (uint32_t k=0; k<bitsPerChunk; k++) g.dbl(p, p);
+        }
+    }
 }
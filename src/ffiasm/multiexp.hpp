@@ -4,6 +4,25 @@
 #define PME2_PACK_FACTOR 2
 #define PME2_MAX_CHUNK_SIZE_BITS 16
 #define PME2_MIN_CHUNK_SIZE_BITS 2
+#define PME2_BATCH_SIZE 256 // Affine additions sharing one field inversion (Montgomery's trick)
+
+/*
+    Precomputed multiples of a fixed set of bases: points[j*n + i] = 2^(j*bitsPerChunk) * bases[i]
+    With a table, all the chunks are accumulated into the same buckets and reduced only once,
+    at the cost of nChunks times the memory of the bases
+*/
+template <typename Curve>
+class MultiexpTable {
+public:
+    typename Curve::PointAffine *points;
+    uint32_t n;
+    uint32_t scalarSize;
+    uint32_t bitsPerChunk;
+    uint32_t nChunks;
+
+    MultiexpTable() : points(NULL), n(0), scalarSize(0), bitsPerChunk(0), nChunks(0) {}
+    ~MultiexpTable() { if (points != NULL) delete[] points; }
+};
 
 template <typename Curve>
 class ParallelMultiexp {
@@ -23,17 +42,23 @@ class ParallelMultiexp {
     uint32_t nChunks;
     Curve &g;
     PaddedPoint *accs;
+    uint8_t *carries; // Signed-digit carry of every scalar into the next chunk
 
     void initAccs();
 
+    void setChunkSize(uint32_t _n, uint32_t _scalarSize);
     uint32_t getChunk(uint32_t scalarIdx, uint32_t chunkIdx);
+    int32_t getSignedChunk(uint32_t scalarIdx, uint32_t chunkIdx);
     void processChunk(uint32_t idxChunk);
+    void batchAddAffine(typename Curve::PointAffine *buckets, uint32_t *batchIdx, typename Curve::PointAffine *batchPoints, typename Curve::Field::Element *batchInv, uint32_t batchSize);
     void packThreads();
-    void reduce(typename Curve::Point &res, uint32_t nBits);
+    void reduce(typename Curve::Point &res);
 
 public:
     ParallelMultiexp(Curve &_g): g(_g) {}
     void multiexp(typename Curve::Point &r, typename Curve::PointAffine *_bases, uint8_t* _scalars, uint32_t _scalarSize, uint32_t _n, uint32_t _nThreads=0);
+    void multiexp(typename Curve::Point &r, MultiexpTable<Curve> &table, uint8_t* _scalars, uint32_t _scalarSize, uint32_t _n, uint32_t _nThreads=0);
+    void precompute(MultiexpTable<Curve> &table, typename Curve::PointAffine *_bases, uint32_t _scalarSize, uint32_t _n);
 
 };
 
@@ -24,6 +24,7 @@ namespace v1 {
 
 static const char* ExecutorService_method_names[] = {
   "/executor.v1.ExecutorService/ProcessBatch",
+  "/executor.v1.ExecutorService/ProcessBatchStream",
 };
 
 std::unique_ptr< ExecutorService::Stub> ExecutorService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -34,6 +35,7 @@ std::unique_ptr< ExecutorService::Stub> ExecutorService::NewStub(const std::shar
 
 ExecutorService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel)
   : channel_(channel), rpcmethod_ProcessBatch_(ExecutorService_method_names[0], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ProcessBatchStream_(ExecutorService_method_names[1], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
   {}
 
 ::grpc::Status ExecutorService::Stub::ProcessBatch(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::executor::v1::ProcessBatchResponse* response) {
@@ -64,6 +66,22 @@ void ExecutorService::Stub::experimental_async::ProcessBatch(::grpc::ClientConte
   return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::executor::v1::ProcessBatchResponse>::Create(channel_.get(), cq, rpcmethod_ProcessBatch_, context, request, false);
 }
 
+::grpc::ClientReader< ::executor::v1::ProcessBatchResponse>* ExecutorService::Stub::ProcessBatchStreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request) {
+  return ::grpc_impl::internal::ClientReaderFactory< ::executor::v1::ProcessBatchResponse>::Create(channel_.get(), rpcmethod_ProcessBatchStream_, context, request);
+}
+
+void ExecutorService::Stub::experimental_async::ProcessBatchStream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequest* request, ::grpc::experimental::ClientReadReactor< ::executor::v1::ProcessBatchResponse>* reactor) {
+  ::grpc_impl::internal::ClientCallbackReaderFactory< ::executor::v1::ProcessBatchResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_ProcessBatchStream_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponse>* ExecutorService::Stub::AsyncProcessBatchStreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc_impl::internal::ClientAsyncReaderFactory< ::executor::v1::ProcessBatchResponse>::Create(channel_.get(), cq, rpcmethod_ProcessBatchStream_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponse>* ExecutorService::Stub::PrepareAsyncProcessBatchStreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncReaderFactory< ::executor::v1::ProcessBatchResponse>::Create(channel_.get(), cq, rpcmethod_ProcessBatchStream_, context, request, false, nullptr);
+}
+
 ExecutorService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       ExecutorService_method_names[0],
@@ -75,6 +93,16 @@ ExecutorService::Service::Service() {
              ::executor::v1::ProcessBatchResponse* resp) {
                return service->ProcessBatch(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ExecutorService_method_names[1],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< ExecutorService::Service, ::executor::v1::ProcessBatchRequest, ::executor::v1::ProcessBatchResponse>(
+          [](ExecutorService::Service* service,
+             ::grpc_impl::ServerContext* ctx,
+             const ::executor::v1::ProcessBatchRequest* req,
+             ::grpc_impl::ServerWriter<::executor::v1::ProcessBatchResponse>* writer) {
+               return service->ProcessBatchStream(ctx, req, writer);
+             }, this)));
 }
 
 ExecutorService::Service::~Service() {
@@ -87,6 +115,13 @@ ExecutorService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status ExecutorService::Service::ProcessBatchStream(::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequest* request, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace executor
 }  // namespace v1
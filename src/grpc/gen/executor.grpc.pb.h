@@ -45,6 +45,23 @@ class ExecutorService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponse>> PrepareAsyncProcessBatch(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponse>>(PrepareAsyncProcessBatchRaw(context, request, cq));
     }
+    // / Processes a batch, streaming the responses as they are produced:
+    // / - one or more messages per transaction, every one with a single entry in responses;
+    // /   the first one carries all the transaction fields, and the next ones only its tx_hash
+    // /   plus the next chunk of execution_trace and call_trace steps
+    // / - in execution_trace, memory only contains the bytes from the first one that changed
+    // /   since the previous step of the same transaction up to memory_size, i.e. the memory
+    // /   is the first memory_size - len(memory) bytes of the previous step memory followed by memory
+    // / - a last message with all the batch fields and no responses
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::executor::v1::ProcessBatchResponse>> ProcessBatchStream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::executor::v1::ProcessBatchResponse>>(ProcessBatchStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchResponse>> AsyncProcessBatchStream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchResponse>>(AsyncProcessBatchStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchResponse>> PrepareAsyncProcessBatchStream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchResponse>>(PrepareAsyncProcessBatchStreamRaw(context, request, cq));
+    }
     class experimental_async_interface {
      public:
       virtual ~experimental_async_interface() {}
@@ -61,6 +78,19 @@ class ExecutorService final {
       #else
       virtual void ProcessBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::executor::v1::ProcessBatchResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
       #endif
+      // / Processes a batch, streaming the responses as they are produced:
+      // / - one or more messages per transaction, every one with a single entry in responses;
+      // /   the first one carries all the transaction fields, and the next ones only its tx_hash
+      // /   plus the next chunk of execution_trace and call_trace steps
+      // / - in execution_trace, memory only contains the bytes from the first one that changed
+      // /   since the previous step of the same transaction up to memory_size, i.e. the memory
+      // /   is the first memory_size - len(memory) bytes of the previous step memory followed by memory
+      // / - a last message with all the batch fields and no responses
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void ProcessBatchStream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequest* request, ::grpc::ClientReadReactor< ::executor::v1::ProcessBatchResponse>* reactor) = 0;
+      #else
+      virtual void ProcessBatchStream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequest* request, ::grpc::experimental::ClientReadReactor< ::executor::v1::ProcessBatchResponse>* reactor) = 0;
+      #endif
     };
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     typedef class experimental_async_interface async_interface;
@@ -72,6 +102,9 @@ class ExecutorService final {
   private:
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponse>* AsyncProcessBatchRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponse>* PrepareAsyncProcessBatchRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::executor::v1::ProcessBatchResponse>* ProcessBatchStreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchResponse>* AsyncProcessBatchStreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchResponse>* PrepareAsyncProcessBatchStreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -83,6 +116,15 @@ class ExecutorService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponse>> PrepareAsyncProcessBatch(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponse>>(PrepareAsyncProcessBatchRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReader< ::executor::v1::ProcessBatchResponse>> ProcessBatchStream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::executor::v1::ProcessBatchResponse>>(ProcessBatchStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponse>> AsyncProcessBatchStream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponse>>(AsyncProcessBatchStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponse>> PrepareAsyncProcessBatchStream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponse>>(PrepareAsyncProcessBatchStreamRaw(context, request, cq));
+    }
     class experimental_async final :
       public StubInterface::experimental_async_interface {
      public:
@@ -98,6 +140,11 @@ class ExecutorService final {
       #else
       void ProcessBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::executor::v1::ProcessBatchResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
       #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void ProcessBatchStream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequest* request, ::grpc::ClientReadReactor< ::executor::v1::ProcessBatchResponse>* reactor) override;
+      #else
+      void ProcessBatchStream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequest* request, ::grpc::experimental::ClientReadReactor< ::executor::v1::ProcessBatchResponse>* reactor) override;
+      #endif
      private:
       friend class Stub;
       explicit experimental_async(Stub* stub): stub_(stub) { }
@@ -111,7 +158,11 @@ class ExecutorService final {
     class experimental_async async_stub_{this};
     ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponse>* AsyncProcessBatchRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponse>* PrepareAsyncProcessBatchRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::executor::v1::ProcessBatchResponse>* ProcessBatchStreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request) override;
+    ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponse>* AsyncProcessBatchStreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponse>* PrepareAsyncProcessBatchStreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_ProcessBatch_;
+    const ::grpc::internal::RpcMethod rpcmethod_ProcessBatchStream_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -121,6 +172,15 @@ class ExecutorService final {
     virtual ~Service();
     // / Processes a batch
     virtual ::grpc::Status ProcessBatch(::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequest* request, ::executor::v1::ProcessBatchResponse* response);
+    // / Processes a batch, streaming the responses as they are produced:
+    // / - one or more messages per transaction, every one with a single entry in responses;
+    // /   the first one carries all the transaction fields, and the next ones only its tx_hash
+    // /   plus the next chunk of execution_trace and call_trace steps
+    // / - in execution_trace, memory only contains the bytes from the first one that changed
+    // /   since the previous step of the same transaction up to memory_size, i.e. the memory
+    // /   is the first memory_size - len(memory) bytes of the previous step memory followed by memory
+    // / - a last message with all the batch fields and no responses
+    virtual ::grpc::Status ProcessBatchStream(::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequest* request, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse>* writer);
   };
   template <class BaseClass>
   class WithAsyncMethod_ProcessBatch : public BaseClass {
@@ -142,7 +202,27 @@ class ExecutorService final {
       ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_ProcessBatch<Service > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_ProcessBatchStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ProcessBatchStream() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_ProcessBatchStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchStream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequest* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestProcessBatchStream(::grpc::ServerContext* context, ::executor::v1::ProcessBatchRequest* request, ::grpc::ServerAsyncWriter< ::executor::v1::ProcessBatchResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(1, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_ProcessBatch<WithAsyncMethod_ProcessBatchStream<Service > > AsyncService;
   template <class BaseClass>
   class ExperimentalWithCallbackMethod_ProcessBatch : public BaseClass {
    private:
@@ -190,11 +270,49 @@ class ExecutorService final {
     #endif
       { return nullptr; }
   };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_ProcessBatchStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_ProcessBatchStream() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(1,
+          new ::grpc_impl::internal::CallbackServerStreamingHandler< ::executor::v1::ProcessBatchRequest, ::executor::v1::ProcessBatchResponse>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::executor::v1::ProcessBatchRequest* request) { return this->ProcessBatchStream(context, request); }));
+    }
+    ~ExperimentalWithCallbackMethod_ProcessBatchStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchStream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequest* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerWriteReactor< ::executor::v1::ProcessBatchResponse>* ProcessBatchStream(
+      ::grpc::CallbackServerContext* /*context*/, const ::executor::v1::ProcessBatchRequest* /*request*/)
+    #else
+    virtual ::grpc::experimental::ServerWriteReactor< ::executor::v1::ProcessBatchResponse>* ProcessBatchStream(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::executor::v1::ProcessBatchRequest* /*request*/)
+    #endif
+      { return nullptr; }
+  };
   #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-  typedef ExperimentalWithCallbackMethod_ProcessBatch<Service > CallbackService;
+  typedef ExperimentalWithCallbackMethod_ProcessBatch<ExperimentalWithCallbackMethod_ProcessBatchStream<Service > > CallbackService;
   #endif
 
-  typedef ExperimentalWithCallbackMethod_ProcessBatch<Service > ExperimentalCallbackService;
+  typedef ExperimentalWithCallbackMethod_ProcessBatch<ExperimentalWithCallbackMethod_ProcessBatchStream<Service > > ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_ProcessBatch : public BaseClass {
    private:
@@ -213,6 +331,23 @@ class ExecutorService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_ProcessBatchStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ProcessBatchStream() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_ProcessBatchStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchStream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequest* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_ProcessBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -233,6 +368,26 @@ class ExecutorService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_ProcessBatchStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ProcessBatchStream() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_ProcessBatchStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchStream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequest* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestProcessBatchStream(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(1, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class ExperimentalWithRawCallbackMethod_ProcessBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -271,6 +426,44 @@ class ExecutorService final {
       { return nullptr; }
   };
   template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_ProcessBatchStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_ProcessBatchStream() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(1,
+          new ::grpc_impl::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const::grpc::ByteBuffer* request) { return this->ProcessBatchStream(context, request); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_ProcessBatchStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchStream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequest* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* ProcessBatchStream(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)
+    #else
+    virtual ::grpc::experimental::ServerWriteReactor< ::grpc::ByteBuffer>* ProcessBatchStream(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_ProcessBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -298,8 +491,35 @@ class ExecutorService final {
     virtual ::grpc::Status StreamedProcessBatch(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::executor::v1::ProcessBatchRequest,::executor::v1::ProcessBatchResponse>* server_unary_streamer) = 0;
   };
   typedef WithStreamedUnaryMethod_ProcessBatch<Service > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_ProcessBatch<Service > StreamedService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_ProcessBatchStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_ProcessBatchStream() {
+      ::grpc::Service::MarkMethodStreamed(1,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::executor::v1::ProcessBatchRequest, ::executor::v1::ProcessBatchResponse>(
+            [this](::grpc_impl::ServerContext* context,
+                   ::grpc_impl::ServerSplitStreamer<
+                     ::executor::v1::ProcessBatchRequest, ::executor::v1::ProcessBatchResponse>* streamer) {
+                       return this->StreamedProcessBatchStream(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_ProcessBatchStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ProcessBatchStream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequest* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedProcessBatchStream(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::executor::v1::ProcessBatchRequest,::executor::v1::ProcessBatchResponse>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_ProcessBatchStream<Service > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_ProcessBatch<WithSplitStreamingMethod_ProcessBatchStream<Service > > StreamedService;
 };
 
 }  // namespace v1
@@ -770,6 +770,7 @@ class ProcessBatchResponse PROTOBUF_FINAL :
     kCntArithmeticsFieldNumber = 9,
     kCntBinariesFieldNumber = 10,
     kCntStepsFieldNumber = 11,
+    kErrorFieldNumber = 12,
   };
   // repeated .executor.v1.ProcessTransactionResponse responses = 2;
   int responses_size() const;
@@ -911,6 +912,15 @@ class ProcessBatchResponse PROTOBUF_FINAL :
   void _internal_set_cnt_steps(::PROTOBUF_NAMESPACE_ID::uint32 value);
   public:
 
+  // .executor.v1.Error error = 12;
+  void clear_error();
+  ::executor::v1::Error error() const;
+  void set_error(::executor::v1::Error value);
+  private:
+  ::executor::v1::Error _internal_error() const;
+  void _internal_set_error(::executor::v1::Error value);
+  public:
+
   // @@protoc_insertion_point(class_scope:executor.v1.ProcessBatchResponse)
  private:
   class _Internal;
@@ -929,6 +939,7 @@ class ProcessBatchResponse PROTOBUF_FINAL :
   ::PROTOBUF_NAMESPACE_ID::uint32 cnt_arithmetics_;
   ::PROTOBUF_NAMESPACE_ID::uint32 cnt_binaries_;
   ::PROTOBUF_NAMESPACE_ID::uint32 cnt_steps_;
+  int error_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_executor_2eproto;
 };
@@ -4193,6 +4204,26 @@ inline void ProcessBatchResponse::set_cnt_steps(::PROTOBUF_NAMESPACE_ID::uint32
   // @@protoc_insertion_point(field_set:executor.v1.ProcessBatchResponse.cnt_steps)
 }
 
+// .executor.v1.Error error = 12;
+inline void ProcessBatchResponse::clear_error() {
+  error_ = 0;
+}
+inline ::executor::v1::Error ProcessBatchResponse::_internal_error() const {
+  return static_cast< ::executor::v1::Error >(error_);
+}
+inline ::executor::v1::Error ProcessBatchResponse::error() const {
+  // @@protoc_insertion_point(field_get:executor.v1.ProcessBatchResponse.error)
+  return _internal_error();
+}
+inline void ProcessBatchResponse::_internal_set_error(::executor::v1::Error value) {
+  
+  error_ = value;
+}
+inline void ProcessBatchResponse::set_error(::executor::v1::Error value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:executor.v1.ProcessBatchResponse.error)
+}
+
 // -------------------------------------------------------------------
 
 // CallTrace
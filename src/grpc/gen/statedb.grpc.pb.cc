@@ -28,6 +28,8 @@ static const char* StateDBService_method_names[] = {
   "/statedb.v1.StateDBService/SetProgram",
   "/statedb.v1.StateDBService/GetProgram",
   "/statedb.v1.StateDBService/Flush",
+  "/statedb.v1.StateDBService/GetNodes",
+  "/statedb.v1.StateDBService/PutNodes",
 };
 
 std::unique_ptr< StateDBService::Stub> StateDBService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -42,6 +44,8 @@ StateDBService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& cha
   , rpcmethod_SetProgram_(StateDBService_method_names[2], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetProgram_(StateDBService_method_names[3], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_Flush_(StateDBService_method_names[4], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetNodes_(StateDBService_method_names[5], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_PutNodes_(StateDBService_method_names[6], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status StateDBService::Stub::Set(::grpc::ClientContext* context, const ::statedb::v1::SetRequest& request, ::statedb::v1::SetResponse* response) {
@@ -184,6 +188,62 @@ void StateDBService::Stub::experimental_async::Flush(::grpc::ClientContext* cont
   return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::google::protobuf::Empty>::Create(channel_.get(), cq, rpcmethod_Flush_, context, request, false);
 }
 
+::grpc::Status StateDBService::Stub::GetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest& request, ::statedb::v1::GetNodesResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_GetNodes_, context, request, response);
+}
+
+void StateDBService::Stub::experimental_async::GetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest* request, ::statedb::v1::GetNodesResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetNodes_, context, request, response, std::move(f));
+}
+
+void StateDBService::Stub::experimental_async::GetNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::GetNodesResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetNodes_, context, request, response, std::move(f));
+}
+
+void StateDBService::Stub::experimental_async::GetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest* request, ::statedb::v1::GetNodesResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_GetNodes_, context, request, response, reactor);
+}
+
+void StateDBService::Stub::experimental_async::GetNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::GetNodesResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_GetNodes_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::statedb::v1::GetNodesResponse>* StateDBService::Stub::AsyncGetNodesRaw(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::statedb::v1::GetNodesResponse>::Create(channel_.get(), cq, rpcmethod_GetNodes_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::statedb::v1::GetNodesResponse>* StateDBService::Stub::PrepareAsyncGetNodesRaw(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::statedb::v1::GetNodesResponse>::Create(channel_.get(), cq, rpcmethod_GetNodes_, context, request, false);
+}
+
+::grpc::Status StateDBService::Stub::PutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest& request, ::statedb::v1::PutNodesResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_PutNodes_, context, request, response);
+}
+
+void StateDBService::Stub::experimental_async::PutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest* request, ::statedb::v1::PutNodesResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_PutNodes_, context, request, response, std::move(f));
+}
+
+void StateDBService::Stub::experimental_async::PutNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::PutNodesResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_PutNodes_, context, request, response, std::move(f));
+}
+
+void StateDBService::Stub::experimental_async::PutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest* request, ::statedb::v1::PutNodesResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_PutNodes_, context, request, response, reactor);
+}
+
+void StateDBService::Stub::experimental_async::PutNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::PutNodesResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_PutNodes_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::statedb::v1::PutNodesResponse>* StateDBService::Stub::AsyncPutNodesRaw(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::statedb::v1::PutNodesResponse>::Create(channel_.get(), cq, rpcmethod_PutNodes_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::statedb::v1::PutNodesResponse>* StateDBService::Stub::PrepareAsyncPutNodesRaw(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::statedb::v1::PutNodesResponse>::Create(channel_.get(), cq, rpcmethod_PutNodes_, context, request, false);
+}
+
 StateDBService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       StateDBService_method_names[0],
@@ -235,6 +295,26 @@ StateDBService::Service::Service() {
              ::google::protobuf::Empty* resp) {
                return service->Flush(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      StateDBService_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< StateDBService::Service, ::statedb::v1::GetNodesRequest, ::statedb::v1::GetNodesResponse>(
+          [](StateDBService::Service* service,
+             ::grpc_impl::ServerContext* ctx,
+             const ::statedb::v1::GetNodesRequest* req,
+             ::statedb::v1::GetNodesResponse* resp) {
+               return service->GetNodes(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      StateDBService_method_names[6],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< StateDBService::Service, ::statedb::v1::PutNodesRequest, ::statedb::v1::PutNodesResponse>(
+          [](StateDBService::Service* service,
+             ::grpc_impl::ServerContext* ctx,
+             const ::statedb::v1::PutNodesRequest* req,
+             ::statedb::v1::PutNodesResponse* resp) {
+               return service->PutNodes(ctx, req, resp);
+             }, this)));
 }
 
 StateDBService::Service::~Service() {
@@ -275,6 +355,20 @@ StateDBService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status StateDBService::Service::GetNodes(::grpc::ServerContext* context, const ::statedb::v1::GetNodesRequest* request, ::statedb::v1::GetNodesResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status StateDBService::Service::PutNodes(::grpc::ServerContext* context, const ::statedb::v1::PutNodesRequest* request, ::statedb::v1::PutNodesResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace statedb
 }  // namespace v1
@@ -38,6 +38,8 @@ namespace v1 {
 // SetProgram: set the byte data for a specific key
 // GetProgram: get the byte data for a specific key
 // Flush: wait for all the pendings writes to the DB are done
+// GetNodes: get the data of a list of tree nodes, by hash
+// PutNodes: store the data of a list of tree nodes
 class StateDBService final {
  public:
   static constexpr char const* service_full_name() {
@@ -81,6 +83,20 @@ class StateDBService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> PrepareAsyncFlush(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(PrepareAsyncFlushRaw(context, request, cq));
     }
+    virtual ::grpc::Status GetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest& request, ::statedb::v1::GetNodesResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::statedb::v1::GetNodesResponse>> AsyncGetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::statedb::v1::GetNodesResponse>>(AsyncGetNodesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::statedb::v1::GetNodesResponse>> PrepareAsyncGetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::statedb::v1::GetNodesResponse>>(PrepareAsyncGetNodesRaw(context, request, cq));
+    }
+    virtual ::grpc::Status PutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest& request, ::statedb::v1::PutNodesResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::statedb::v1::PutNodesResponse>> AsyncPutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::statedb::v1::PutNodesResponse>>(AsyncPutNodesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::statedb::v1::PutNodesResponse>> PrepareAsyncPutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::statedb::v1::PutNodesResponse>>(PrepareAsyncPutNodesRaw(context, request, cq));
+    }
     class experimental_async_interface {
      public:
       virtual ~experimental_async_interface() {}
@@ -144,6 +160,30 @@ class StateDBService final {
       #else
       virtual void Flush(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::google::protobuf::Empty* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
       #endif
+      virtual void GetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest* request, ::statedb::v1::GetNodesResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::GetNodesResponse* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void GetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest* request, ::statedb::v1::GetNodesResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void GetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest* request, ::statedb::v1::GetNodesResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void GetNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::GetNodesResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void GetNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::GetNodesResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      virtual void PutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest* request, ::statedb::v1::PutNodesResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void PutNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::PutNodesResponse* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void PutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest* request, ::statedb::v1::PutNodesResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void PutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest* request, ::statedb::v1::PutNodesResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void PutNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::PutNodesResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void PutNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::PutNodesResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
     };
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     typedef class experimental_async_interface async_interface;
@@ -163,6 +203,10 @@ class StateDBService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::statedb::v1::GetProgramResponse>* PrepareAsyncGetProgramRaw(::grpc::ClientContext* context, const ::statedb::v1::GetProgramRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncFlushRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncFlushRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::statedb::v1::GetNodesResponse>* AsyncGetNodesRaw(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::statedb::v1::GetNodesResponse>* PrepareAsyncGetNodesRaw(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::statedb::v1::PutNodesResponse>* AsyncPutNodesRaw(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::statedb::v1::PutNodesResponse>* PrepareAsyncPutNodesRaw(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -202,6 +246,20 @@ class StateDBService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> PrepareAsyncFlush(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(PrepareAsyncFlushRaw(context, request, cq));
     }
+    ::grpc::Status GetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest& request, ::statedb::v1::GetNodesResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::statedb::v1::GetNodesResponse>> AsyncGetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::statedb::v1::GetNodesResponse>>(AsyncGetNodesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::statedb::v1::GetNodesResponse>> PrepareAsyncGetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::statedb::v1::GetNodesResponse>>(PrepareAsyncGetNodesRaw(context, request, cq));
+    }
+    ::grpc::Status PutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest& request, ::statedb::v1::PutNodesResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::statedb::v1::PutNodesResponse>> AsyncPutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::statedb::v1::PutNodesResponse>>(AsyncPutNodesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::statedb::v1::PutNodesResponse>> PrepareAsyncPutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::statedb::v1::PutNodesResponse>>(PrepareAsyncPutNodesRaw(context, request, cq));
+    }
     class experimental_async final :
       public StubInterface::experimental_async_interface {
      public:
@@ -265,6 +323,30 @@ class StateDBService final {
       #else
       void Flush(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::google::protobuf::Empty* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
       #endif
+      void GetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest* request, ::statedb::v1::GetNodesResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::GetNodesResponse* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void GetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest* request, ::statedb::v1::GetNodesResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void GetNodes(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest* request, ::statedb::v1::GetNodesResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void GetNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::GetNodesResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void GetNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::GetNodesResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      void PutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest* request, ::statedb::v1::PutNodesResponse* response, std::function<void(::grpc::Status)>) override;
+      void PutNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::PutNodesResponse* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void PutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest* request, ::statedb::v1::PutNodesResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void PutNodes(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest* request, ::statedb::v1::PutNodesResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void PutNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::PutNodesResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void PutNodes(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::statedb::v1::PutNodesResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
      private:
       friend class Stub;
       explicit experimental_async(Stub* stub): stub_(stub) { }
@@ -286,11 +368,17 @@ class StateDBService final {
     ::grpc::ClientAsyncResponseReader< ::statedb::v1::GetProgramResponse>* PrepareAsyncGetProgramRaw(::grpc::ClientContext* context, const ::statedb::v1::GetProgramRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncFlushRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncFlushRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::statedb::v1::GetNodesResponse>* AsyncGetNodesRaw(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::statedb::v1::GetNodesResponse>* PrepareAsyncGetNodesRaw(::grpc::ClientContext* context, const ::statedb::v1::GetNodesRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::statedb::v1::PutNodesResponse>* AsyncPutNodesRaw(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::statedb::v1::PutNodesResponse>* PrepareAsyncPutNodesRaw(::grpc::ClientContext* context, const ::statedb::v1::PutNodesRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_Set_;
     const ::grpc::internal::RpcMethod rpcmethod_Get_;
     const ::grpc::internal::RpcMethod rpcmethod_SetProgram_;
     const ::grpc::internal::RpcMethod rpcmethod_GetProgram_;
     const ::grpc::internal::RpcMethod rpcmethod_Flush_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetNodes_;
+    const ::grpc::internal::RpcMethod rpcmethod_PutNodes_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -303,6 +391,8 @@ class StateDBService final {
     virtual ::grpc::Status SetProgram(::grpc::ServerContext* context, const ::statedb::v1::SetProgramRequest* request, ::statedb::v1::SetProgramResponse* response);
     virtual ::grpc::Status GetProgram(::grpc::ServerContext* context, const ::statedb::v1::GetProgramRequest* request, ::statedb::v1::GetProgramResponse* response);
     virtual ::grpc::Status Flush(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response);
+    virtual ::grpc::Status GetNodes(::grpc::ServerContext* context, const ::statedb::v1::GetNodesRequest* request, ::statedb::v1::GetNodesResponse* response);
+    virtual ::grpc::Status PutNodes(::grpc::ServerContext* context, const ::statedb::v1::PutNodesRequest* request, ::statedb::v1::PutNodesResponse* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_Set : public BaseClass {
@@ -404,7 +494,47 @@ class StateDBService final {
       ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_Set<WithAsyncMethod_Get<WithAsyncMethod_SetProgram<WithAsyncMethod_GetProgram<WithAsyncMethod_Flush<Service > > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_GetNodes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetNodes() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_GetNodes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetNodes(::grpc::ServerContext* /*context*/, const ::statedb::v1::GetNodesRequest* /*request*/, ::statedb::v1::GetNodesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetNodes(::grpc::ServerContext* context, ::statedb::v1::GetNodesRequest* request, ::grpc::ServerAsyncResponseWriter< ::statedb::v1::GetNodesResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_PutNodes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_PutNodes() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_PutNodes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PutNodes(::grpc::ServerContext* /*context*/, const ::statedb::v1::PutNodesRequest* /*request*/, ::statedb::v1::PutNodesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPutNodes(::grpc::ServerContext* context, ::statedb::v1::PutNodesRequest* request, ::grpc::ServerAsyncResponseWriter< ::statedb::v1::PutNodesResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Set<WithAsyncMethod_Get<WithAsyncMethod_SetProgram<WithAsyncMethod_GetProgram<WithAsyncMethod_Flush<WithAsyncMethod_GetNodes<WithAsyncMethod_PutNodes<Service > > > > > > > AsyncService;
   template <class BaseClass>
   class ExperimentalWithCallbackMethod_Set : public BaseClass {
    private:
@@ -640,11 +770,105 @@ class StateDBService final {
     #endif
       { return nullptr; }
   };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_GetNodes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_GetNodes() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(5,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::statedb::v1::GetNodesRequest, ::statedb::v1::GetNodesResponse>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::statedb::v1::GetNodesRequest* request, ::statedb::v1::GetNodesResponse* response) { return this->GetNodes(context, request, response); }));}
+    void SetMessageAllocatorFor_GetNodes(
+        ::grpc::experimental::MessageAllocator< ::statedb::v1::GetNodesRequest, ::statedb::v1::GetNodesResponse>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(5);
+    #endif
+      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::statedb::v1::GetNodesRequest, ::statedb::v1::GetNodesResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~ExperimentalWithCallbackMethod_GetNodes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetNodes(::grpc::ServerContext* /*context*/, const ::statedb::v1::GetNodesRequest* /*request*/, ::statedb::v1::GetNodesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* GetNodes(
+      ::grpc::CallbackServerContext* /*context*/, const ::statedb::v1::GetNodesRequest* /*request*/, ::statedb::v1::GetNodesResponse* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* GetNodes(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::statedb::v1::GetNodesRequest* /*request*/, ::statedb::v1::GetNodesResponse* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_PutNodes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_PutNodes() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(6,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::statedb::v1::PutNodesRequest, ::statedb::v1::PutNodesResponse>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::statedb::v1::PutNodesRequest* request, ::statedb::v1::PutNodesResponse* response) { return this->PutNodes(context, request, response); }));}
+    void SetMessageAllocatorFor_PutNodes(
+        ::grpc::experimental::MessageAllocator< ::statedb::v1::PutNodesRequest, ::statedb::v1::PutNodesResponse>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(6);
+    #endif
+      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::statedb::v1::PutNodesRequest, ::statedb::v1::PutNodesResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~ExperimentalWithCallbackMethod_PutNodes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PutNodes(::grpc::ServerContext* /*context*/, const ::statedb::v1::PutNodesRequest* /*request*/, ::statedb::v1::PutNodesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* PutNodes(
+      ::grpc::CallbackServerContext* /*context*/, const ::statedb::v1::PutNodesRequest* /*request*/, ::statedb::v1::PutNodesResponse* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* PutNodes(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::statedb::v1::PutNodesRequest* /*request*/, ::statedb::v1::PutNodesResponse* /*response*/)
+    #endif
+      { return nullptr; }
+  };
   #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-  typedef ExperimentalWithCallbackMethod_Set<ExperimentalWithCallbackMethod_Get<ExperimentalWithCallbackMethod_SetProgram<ExperimentalWithCallbackMethod_GetProgram<ExperimentalWithCallbackMethod_Flush<Service > > > > > CallbackService;
+  typedef ExperimentalWithCallbackMethod_Set<ExperimentalWithCallbackMethod_Get<ExperimentalWithCallbackMethod_SetProgram<ExperimentalWithCallbackMethod_GetProgram<ExperimentalWithCallbackMethod_Flush<ExperimentalWithCallbackMethod_GetNodes<ExperimentalWithCallbackMethod_PutNodes<Service > > > > > > > CallbackService;
   #endif
 
-  typedef ExperimentalWithCallbackMethod_Set<ExperimentalWithCallbackMethod_Get<ExperimentalWithCallbackMethod_SetProgram<ExperimentalWithCallbackMethod_GetProgram<ExperimentalWithCallbackMethod_Flush<Service > > > > > ExperimentalCallbackService;
+  typedef ExperimentalWithCallbackMethod_Set<ExperimentalWithCallbackMethod_Get<ExperimentalWithCallbackMethod_SetProgram<ExperimentalWithCallbackMethod_GetProgram<ExperimentalWithCallbackMethod_Flush<ExperimentalWithCallbackMethod_GetNodes<ExperimentalWithCallbackMethod_PutNodes<Service > > > > > > > ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_Set : public BaseClass {
    private:
@@ -731,6 +955,40 @@ class StateDBService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_GetNodes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetNodes() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_GetNodes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetNodes(::grpc::ServerContext* /*context*/, const ::statedb::v1::GetNodesRequest* /*request*/, ::statedb::v1::GetNodesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_PutNodes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_PutNodes() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_PutNodes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PutNodes(::grpc::ServerContext* /*context*/, const ::statedb::v1::PutNodesRequest* /*request*/, ::statedb::v1::PutNodesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Set : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -831,6 +1089,46 @@ class StateDBService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_GetNodes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetNodes() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_GetNodes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetNodes(::grpc::ServerContext* /*context*/, const ::statedb::v1::GetNodesRequest* /*request*/, ::statedb::v1::GetNodesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetNodes(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_PutNodes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_PutNodes() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_PutNodes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PutNodes(::grpc::ServerContext* /*context*/, const ::statedb::v1::PutNodesRequest* /*request*/, ::statedb::v1::PutNodesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPutNodes(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class ExperimentalWithRawCallbackMethod_Set : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -1021,6 +1319,82 @@ class StateDBService final {
       { return nullptr; }
   };
   template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_GetNodes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_GetNodes() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(5,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetNodes(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_GetNodes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetNodes(::grpc::ServerContext* /*context*/, const ::statedb::v1::GetNodesRequest* /*request*/, ::statedb::v1::GetNodesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* GetNodes(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* GetNodes(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_PutNodes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_PutNodes() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(6,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->PutNodes(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_PutNodes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PutNodes(::grpc::ServerContext* /*context*/, const ::statedb::v1::PutNodesRequest* /*request*/, ::statedb::v1::PutNodesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* PutNodes(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* PutNodes(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Set : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -1155,9 +1529,63 @@ class StateDBService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedFlush(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::google::protobuf::Empty,::google::protobuf::Empty>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_Set<WithStreamedUnaryMethod_Get<WithStreamedUnaryMethod_SetProgram<WithStreamedUnaryMethod_GetProgram<WithStreamedUnaryMethod_Flush<Service > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetNodes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetNodes() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::statedb::v1::GetNodesRequest, ::statedb::v1::GetNodesResponse>(
+            [this](::grpc_impl::ServerContext* context,
+                   ::grpc_impl::ServerUnaryStreamer<
+                     ::statedb::v1::GetNodesRequest, ::statedb::v1::GetNodesResponse>* streamer) {
+                       return this->StreamedGetNodes(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetNodes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetNodes(::grpc::ServerContext* /*context*/, const ::statedb::v1::GetNodesRequest* /*request*/, ::statedb::v1::GetNodesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetNodes(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::statedb::v1::GetNodesRequest,::statedb::v1::GetNodesResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_PutNodes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_PutNodes() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::statedb::v1::PutNodesRequest, ::statedb::v1::PutNodesResponse>(
+            [this](::grpc_impl::ServerContext* context,
+                   ::grpc_impl::ServerUnaryStreamer<
+                     ::statedb::v1::PutNodesRequest, ::statedb::v1::PutNodesResponse>* streamer) {
+                       return this->StreamedPutNodes(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_PutNodes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status PutNodes(::grpc::ServerContext* /*context*/, const ::statedb::v1::PutNodesRequest* /*request*/, ::statedb::v1::PutNodesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedPutNodes(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::statedb::v1::PutNodesRequest,::statedb::v1::PutNodesResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_Set<WithStreamedUnaryMethod_Get<WithStreamedUnaryMethod_SetProgram<WithStreamedUnaryMethod_GetProgram<WithStreamedUnaryMethod_Flush<WithStreamedUnaryMethod_GetNodes<WithStreamedUnaryMethod_PutNodes<Service > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_Set<WithStreamedUnaryMethod_Get<WithStreamedUnaryMethod_SetProgram<WithStreamedUnaryMethod_GetProgram<WithStreamedUnaryMethod_Flush<Service > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_Set<WithStreamedUnaryMethod_Get<WithStreamedUnaryMethod_SetProgram<WithStreamedUnaryMethod_GetProgram<WithStreamedUnaryMethod_Flush<WithStreamedUnaryMethod_GetNodes<WithStreamedUnaryMethod_PutNodes<Service > > > > > > > StreamedService;
 };
 
 }  // namespace v1
@@ -77,6 +77,22 @@ class ResultCodeDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ResultCode> _instance;
 } _ResultCode_default_instance_;
+class GetNodesRequestDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetNodesRequest> _instance;
+} _GetNodesRequest_default_instance_;
+class GetNodesResponseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetNodesResponse> _instance;
+} _GetNodesResponse_default_instance_;
+class PutNodesRequestDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PutNodesRequest> _instance;
+} _PutNodesRequest_default_instance_;
+class PutNodesResponseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PutNodesResponse> _instance;
+} _PutNodesResponse_default_instance_;
 }  // namespace v1
 }  // namespace statedb
 static void InitDefaultsscc_info_Fea_statedb_2eproto() {
@@ -93,6 +109,35 @@ static void InitDefaultsscc_info_Fea_statedb_2eproto() {
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Fea_statedb_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Fea_statedb_2eproto}, {}};
 
+static void InitDefaultsscc_info_GetNodesRequest_statedb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::statedb::v1::_GetNodesRequest_default_instance_;
+    new (ptr) ::statedb::v1::GetNodesRequest();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::statedb::v1::GetNodesRequest::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetNodesRequest_statedb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GetNodesRequest_statedb_2eproto}, {}};
+
+static void InitDefaultsscc_info_GetNodesResponse_statedb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::statedb::v1::_GetNodesResponse_default_instance_;
+    new (ptr) ::statedb::v1::GetNodesResponse();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::statedb::v1::GetNodesResponse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetNodesResponse_statedb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GetNodesResponse_statedb_2eproto}, {
+      &scc_info_ResultCode_statedb_2eproto.base,}};
+
 static void InitDefaultsscc_info_GetProgramRequest_statedb_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -169,6 +214,35 @@ static void InitDefaultsscc_info_GetResponse_SiblingsEntry_DoNotUse_statedb_2epr
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GetResponse_SiblingsEntry_DoNotUse_statedb_2eproto}, {
       &scc_info_SiblingList_statedb_2eproto.base,}};
 
+static void InitDefaultsscc_info_PutNodesRequest_statedb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::statedb::v1::_PutNodesRequest_default_instance_;
+    new (ptr) ::statedb::v1::PutNodesRequest();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::statedb::v1::PutNodesRequest::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PutNodesRequest_statedb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_PutNodesRequest_statedb_2eproto}, {}};
+
+static void InitDefaultsscc_info_PutNodesResponse_statedb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::statedb::v1::_PutNodesResponse_default_instance_;
+    new (ptr) ::statedb::v1::PutNodesResponse();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::statedb::v1::PutNodesResponse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_PutNodesResponse_statedb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_PutNodesResponse_statedb_2eproto}, {
+      &scc_info_ResultCode_statedb_2eproto.base,}};
+
 static void InitDefaultsscc_info_ResultCode_statedb_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -287,7 +361,7 @@ static void InitDefaultsscc_info_Version_statedb_2eproto() {
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Version_statedb_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Version_statedb_2eproto}, {}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_statedb_2eproto[14];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_statedb_2eproto[18];
 static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_statedb_2eproto[1];
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_statedb_2eproto = nullptr;
 
@@ -413,6 +487,32 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_statedb_2eproto::offsets[] PRO
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::statedb::v1::ResultCode, code_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::statedb::v1::GetNodesRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::statedb::v1::GetNodesRequest, keys_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::statedb::v1::GetNodesResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::statedb::v1::GetNodesResponse, nodes_),
+  PROTOBUF_FIELD_OFFSET(::statedb::v1::GetNodesResponse, result_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::statedb::v1::PutNodesRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::statedb::v1::PutNodesRequest, nodes_),
+  PROTOBUF_FIELD_OFFSET(::statedb::v1::PutNodesRequest, persistent_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::statedb::v1::PutNodesResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::statedb::v1::PutNodesResponse, result_),
 };
 static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(::statedb::v1::Version)},
@@ -429,6 +529,10 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 100, -1, sizeof(::statedb::v1::Fea)},
   { 109, -1, sizeof(::statedb::v1::SiblingList)},
   { 115, -1, sizeof(::statedb::v1::ResultCode)},
+  { 121, -1, sizeof(::statedb::v1::GetNodesRequest)},
+  { 127, -1, sizeof(::statedb::v1::GetNodesResponse)},
+  { 134, -1, sizeof(::statedb::v1::PutNodesRequest)},
+  { 141, -1, sizeof(::statedb::v1::PutNodesResponse)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -446,6 +550,10 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::statedb::v1::_Fea_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::statedb::v1::_SiblingList_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::statedb::v1::_ResultCode_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::statedb::v1::_GetNodesRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::statedb::v1::_GetNodesResponse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::statedb::v1::_PutNodesRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::statedb::v1::_PutNodesResponse_default_instance_),
 };
 
 const char descriptor_table_protodef_statedb_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -491,28 +599,41 @@ const char descriptor_table_protodef_statedb_2eproto[] PROTOBUF_SECTION_VARIABLE
   "\020\n\014CODE_SUCCESS\020\001\022\031\n\025CODE_DB_KEY_NOT_FOU"
   "ND\020\002\022\021\n\rCODE_DB_ERROR\020\003\022\027\n\023CODE_INTERNAL"
   "_ERROR\020\004\022\036\n\032CODE_SMT_INVALID_DATA_SIZE\020\016"
-  "2\335\002\n\016StateDBService\0228\n\003Set\022\026.statedb.v1."
-  "SetRequest\032\027.statedb.v1.SetResponse\"\000\0228\n"
-  "\003Get\022\026.statedb.v1.GetRequest\032\027.statedb.v"
-  "1.GetResponse\"\000\022M\n\nSetProgram\022\035.statedb."
-  "v1.SetProgramRequest\032\036.statedb.v1.SetPro"
-  "gramResponse\"\000\022M\n\nGetProgram\022\035.statedb.v"
-  "1.GetProgramRequest\032\036.statedb.v1.GetProg"
-  "ramResponse\"\000\0229\n\005Flush\022\026.google.protobuf"
-  ".Empty\032\026.google.protobuf.Empty\"\000B4Z2gith"
-  "ub.com/hermeznetwork/hermez-core/merklet"
-  "ree/pbb\006proto3"
+  "\"\037\n\017GetNodesRequest\022\014\n\004keys\030\001 \001(\014\"I\n\020Get"
+  "NodesResponse\022\r\n\005nodes\030\001 \001(\014\022&\n\006result\030\002"
+  " \001(\0132\026.statedb.v1.ResultCode\"4\n\017PutNodes"
+  "Request\022\r\n\005nodes\030\001 \001(\014\022\022\n\npersistent\030\002 \001"
+  "(\010\":\n\020PutNodesResponse\022&\n\006result\030\001 \001(\0132\026"
+  ".statedb.v1.ResultCode2\357\003\n\016StateDBServic"
+  "e\0228\n\003Set\022\026.statedb.v1.SetRequest\032\027.state"
+  "db.v1.SetResponse\"\000\0228\n\003Get\022\026.statedb.v1."
+  "GetRequest\032\027.statedb.v1.GetResponse\"\000\022M\n"
+  "\nSetProgram\022\035.statedb.v1.SetProgramReque"
+  "st\032\036.statedb.v1.SetProgramResponse\"\000\022M\n\n"
+  "GetProgram\022\035.statedb.v1.GetProgramReques"
+  "t\032\036.statedb.v1.GetProgramResponse\"\000\0229\n\005F"
+  "lush\022\026.google.protobuf.Empty\032\026.google.pr"
+  "otobuf.Empty\"\000\022G\n\010GetNodes\022\033.statedb.v1."
+  "GetNodesRequest\032\034.statedb.v1.GetNodesRes"
+  "ponse\"\000\022G\n\010PutNodes\022\033.statedb.v1.PutNode"
+  "sRequest\032\034.statedb.v1.PutNodesResponse\"\000"
+  "B4Z2github.com/hermeznetwork/hermez-core"
+  "/merkletree/pbb\006proto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_statedb_2eproto_deps[1] = {
   &::descriptor_table_google_2fprotobuf_2fempty_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_statedb_2eproto_sccs[14] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_statedb_2eproto_sccs[18] = {
   &scc_info_Fea_statedb_2eproto.base,
+  &scc_info_GetNodesRequest_statedb_2eproto.base,
+  &scc_info_GetNodesResponse_statedb_2eproto.base,
   &scc_info_GetProgramRequest_statedb_2eproto.base,
   &scc_info_GetProgramResponse_statedb_2eproto.base,
   &scc_info_GetRequest_statedb_2eproto.base,
   &scc_info_GetResponse_statedb_2eproto.base,
   &scc_info_GetResponse_SiblingsEntry_DoNotUse_statedb_2eproto.base,
+  &scc_info_PutNodesRequest_statedb_2eproto.base,
+  &scc_info_PutNodesResponse_statedb_2eproto.base,
   &scc_info_ResultCode_statedb_2eproto.base,
   &scc_info_SetProgramRequest_statedb_2eproto.base,
   &scc_info_SetProgramResponse_statedb_2eproto.base,
@@ -524,10 +645,10 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_sta
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_statedb_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_statedb_2eproto = {
-  false, false, descriptor_table_protodef_statedb_2eproto, "statedb.proto", 2094,
-  &descriptor_table_statedb_2eproto_once, descriptor_table_statedb_2eproto_sccs, descriptor_table_statedb_2eproto_deps, 14, 1,
+  false, false, descriptor_table_protodef_statedb_2eproto, "statedb.proto", 2462,
+  &descriptor_table_statedb_2eproto_once, descriptor_table_statedb_2eproto_sccs, descriptor_table_statedb_2eproto_deps, 18, 1,
   schemas, file_default_instances, TableStruct_statedb_2eproto::offsets,
-  file_level_metadata_statedb_2eproto, 14, file_level_enum_descriptors_statedb_2eproto, file_level_service_descriptors_statedb_2eproto,
+  file_level_metadata_statedb_2eproto, 18, file_level_enum_descriptors_statedb_2eproto, file_level_service_descriptors_statedb_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -4264,51 +4385,959 @@ void ResultCode::InternalSwap(ResultCode* other) {
 }
 
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace v1
-}  // namespace statedb
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::statedb::v1::Version* Arena::CreateMaybeMessage< ::statedb::v1::Version >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::Version >(arena);
+// ===================================================================
+
+void GetNodesRequest::InitAsDefaultInstance() {
 }
-template<> PROTOBUF_NOINLINE ::statedb::v1::SetRequest* Arena::CreateMaybeMessage< ::statedb::v1::SetRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::SetRequest >(arena);
+class GetNodesRequest::_Internal {
+ public:
+};
+
+GetNodesRequest::GetNodesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:statedb.v1.GetNodesRequest)
 }
-template<> PROTOBUF_NOINLINE ::statedb::v1::GetRequest* Arena::CreateMaybeMessage< ::statedb::v1::GetRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::GetRequest >(arena);
+GetNodesRequest::GetNodesRequest(const GetNodesRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  keys_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_keys().empty()) {
+    keys_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_keys(),
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:statedb.v1.GetNodesRequest)
 }
-template<> PROTOBUF_NOINLINE ::statedb::v1::SetProgramRequest* Arena::CreateMaybeMessage< ::statedb::v1::SetProgramRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::SetProgramRequest >(arena);
+
+void GetNodesRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetNodesRequest_statedb_2eproto.base);
+  keys_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-template<> PROTOBUF_NOINLINE ::statedb::v1::GetProgramRequest* Arena::CreateMaybeMessage< ::statedb::v1::GetProgramRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::GetProgramRequest >(arena);
+
+GetNodesRequest::~GetNodesRequest() {
+  // @@protoc_insertion_point(destructor:statedb.v1.GetNodesRequest)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-template<> PROTOBUF_NOINLINE ::statedb::v1::SetResponse_SiblingsEntry_DoNotUse* Arena::CreateMaybeMessage< ::statedb::v1::SetResponse_SiblingsEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::SetResponse_SiblingsEntry_DoNotUse >(arena);
+
+void GetNodesRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  keys_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-template<> PROTOBUF_NOINLINE ::statedb::v1::SetResponse* Arena::CreateMaybeMessage< ::statedb::v1::SetResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::SetResponse >(arena);
+
+void GetNodesRequest::ArenaDtor(void* object) {
+  GetNodesRequest* _this = reinterpret_cast< GetNodesRequest* >(object);
+  (void)_this;
 }
-template<> PROTOBUF_NOINLINE ::statedb::v1::GetResponse_SiblingsEntry_DoNotUse* Arena::CreateMaybeMessage< ::statedb::v1::GetResponse_SiblingsEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::GetResponse_SiblingsEntry_DoNotUse >(arena);
+void GetNodesRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-template<> PROTOBUF_NOINLINE ::statedb::v1::GetResponse* Arena::CreateMaybeMessage< ::statedb::v1::GetResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::GetResponse >(arena);
+void GetNodesRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::statedb::v1::SetProgramResponse* Arena::CreateMaybeMessage< ::statedb::v1::SetProgramResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::SetProgramResponse >(arena);
+const GetNodesRequest& GetNodesRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetNodesRequest_statedb_2eproto.base);
+  return *internal_default_instance();
 }
-template<> PROTOBUF_NOINLINE ::statedb::v1::GetProgramResponse* Arena::CreateMaybeMessage< ::statedb::v1::GetProgramResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::GetProgramResponse >(arena);
+
+
+void GetNodesRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:statedb.v1.GetNodesRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  keys_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-template<> PROTOBUF_NOINLINE ::statedb::v1::Fea* Arena::CreateMaybeMessage< ::statedb::v1::Fea >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::Fea >(arena);
+
+const char* GetNodesRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // bytes keys = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_keys();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
 }
-template<> PROTOBUF_NOINLINE ::statedb::v1::SiblingList* Arena::CreateMaybeMessage< ::statedb::v1::SiblingList >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::SiblingList >(arena);
+
+::PROTOBUF_NAMESPACE_ID::uint8* GetNodesRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:statedb.v1.GetNodesRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes keys = 1;
+  if (this->keys().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_keys(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:statedb.v1.GetNodesRequest)
+  return target;
 }
-template<> PROTOBUF_NOINLINE ::statedb::v1::ResultCode* Arena::CreateMaybeMessage< ::statedb::v1::ResultCode >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::statedb::v1::ResultCode >(arena);
+
+size_t GetNodesRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:statedb.v1.GetNodesRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes keys = 1;
+  if (this->keys().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_keys());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void GetNodesRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:statedb.v1.GetNodesRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const GetNodesRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetNodesRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:statedb.v1.GetNodesRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:statedb.v1.GetNodesRequest)
+    MergeFrom(*source);
+  }
+}
+
+void GetNodesRequest::MergeFrom(const GetNodesRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:statedb.v1.GetNodesRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.keys().size() > 0) {
+    _internal_set_keys(from._internal_keys());
+  }
+}
+
+void GetNodesRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:statedb.v1.GetNodesRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void GetNodesRequest::CopyFrom(const GetNodesRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:statedb.v1.GetNodesRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetNodesRequest::IsInitialized() const {
+  return true;
+}
+
+void GetNodesRequest::InternalSwap(GetNodesRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  keys_.Swap(&other->keys_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetNodesRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void GetNodesResponse::InitAsDefaultInstance() {
+  ::statedb::v1::_GetNodesResponse_default_instance_._instance.get_mutable()->result_ = const_cast< ::statedb::v1::ResultCode*>(
+      ::statedb::v1::ResultCode::internal_default_instance());
+}
+class GetNodesResponse::_Internal {
+ public:
+  static const ::statedb::v1::ResultCode& result(const GetNodesResponse* msg);
+};
+
+const ::statedb::v1::ResultCode&
+GetNodesResponse::_Internal::result(const GetNodesResponse* msg) {
+  return *msg->result_;
+}
+GetNodesResponse::GetNodesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:statedb.v1.GetNodesResponse)
+}
+GetNodesResponse::GetNodesResponse(const GetNodesResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  nodes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_nodes().empty()) {
+    nodes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_nodes(),
+      GetArena());
+  }
+  if (from._internal_has_result()) {
+    result_ = new ::statedb::v1::ResultCode(*from.result_);
+  } else {
+    result_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:statedb.v1.GetNodesResponse)
+}
+
+void GetNodesResponse::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetNodesResponse_statedb_2eproto.base);
+  nodes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  result_ = nullptr;
+}
+
+GetNodesResponse::~GetNodesResponse() {
+  // @@protoc_insertion_point(destructor:statedb.v1.GetNodesResponse)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void GetNodesResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  nodes_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete result_;
+}
+
+void GetNodesResponse::ArenaDtor(void* object) {
+  GetNodesResponse* _this = reinterpret_cast< GetNodesResponse* >(object);
+  (void)_this;
+}
+void GetNodesResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void GetNodesResponse::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const GetNodesResponse& GetNodesResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetNodesResponse_statedb_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void GetNodesResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:statedb.v1.GetNodesResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  nodes_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetNodesResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // bytes nodes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_nodes();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .statedb.v1.ResultCode result = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* GetNodesResponse::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:statedb.v1.GetNodesResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes nodes = 1;
+  if (this->nodes().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_nodes(), target);
+  }
+
+  // .statedb.v1.ResultCode result = 2;
+  if (this->has_result()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::result(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:statedb.v1.GetNodesResponse)
+  return target;
+}
+
+size_t GetNodesResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:statedb.v1.GetNodesResponse)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes nodes = 1;
+  if (this->nodes().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_nodes());
+  }
+
+  // .statedb.v1.ResultCode result = 2;
+  if (this->has_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *result_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void GetNodesResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:statedb.v1.GetNodesResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const GetNodesResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetNodesResponse>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:statedb.v1.GetNodesResponse)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:statedb.v1.GetNodesResponse)
+    MergeFrom(*source);
+  }
+}
+
+void GetNodesResponse::MergeFrom(const GetNodesResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:statedb.v1.GetNodesResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.nodes().size() > 0) {
+    _internal_set_nodes(from._internal_nodes());
+  }
+  if (from.has_result()) {
+    _internal_mutable_result()->::statedb::v1::ResultCode::MergeFrom(from._internal_result());
+  }
+}
+
+void GetNodesResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:statedb.v1.GetNodesResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void GetNodesResponse::CopyFrom(const GetNodesResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:statedb.v1.GetNodesResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetNodesResponse::IsInitialized() const {
+  return true;
+}
+
+void GetNodesResponse::InternalSwap(GetNodesResponse* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  nodes_.Swap(&other->nodes_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(result_, other->result_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetNodesResponse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void PutNodesRequest::InitAsDefaultInstance() {
+}
+class PutNodesRequest::_Internal {
+ public:
+};
+
+PutNodesRequest::PutNodesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:statedb.v1.PutNodesRequest)
+}
+PutNodesRequest::PutNodesRequest(const PutNodesRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  nodes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_nodes().empty()) {
+    nodes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_nodes(),
+      GetArena());
+  }
+  persistent_ = from.persistent_;
+  // @@protoc_insertion_point(copy_constructor:statedb.v1.PutNodesRequest)
+}
+
+void PutNodesRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_PutNodesRequest_statedb_2eproto.base);
+  nodes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  persistent_ = false;
+}
+
+PutNodesRequest::~PutNodesRequest() {
+  // @@protoc_insertion_point(destructor:statedb.v1.PutNodesRequest)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void PutNodesRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  nodes_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void PutNodesRequest::ArenaDtor(void* object) {
+  PutNodesRequest* _this = reinterpret_cast< PutNodesRequest* >(object);
+  (void)_this;
+}
+void PutNodesRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void PutNodesRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const PutNodesRequest& PutNodesRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PutNodesRequest_statedb_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void PutNodesRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:statedb.v1.PutNodesRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  nodes_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  persistent_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PutNodesRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // bytes nodes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_nodes();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bool persistent = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          persistent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* PutNodesRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:statedb.v1.PutNodesRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes nodes = 1;
+  if (this->nodes().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_nodes(), target);
+  }
+
+  // bool persistent = 2;
+  if (this->persistent() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_persistent(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:statedb.v1.PutNodesRequest)
+  return target;
+}
+
+size_t PutNodesRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:statedb.v1.PutNodesRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes nodes = 1;
+  if (this->nodes().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_nodes());
+  }
+
+  // bool persistent = 2;
+  if (this->persistent() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void PutNodesRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:statedb.v1.PutNodesRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const PutNodesRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PutNodesRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:statedb.v1.PutNodesRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:statedb.v1.PutNodesRequest)
+    MergeFrom(*source);
+  }
+}
+
+void PutNodesRequest::MergeFrom(const PutNodesRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:statedb.v1.PutNodesRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.nodes().size() > 0) {
+    _internal_set_nodes(from._internal_nodes());
+  }
+  if (from.persistent() != 0) {
+    _internal_set_persistent(from._internal_persistent());
+  }
+}
+
+void PutNodesRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:statedb.v1.PutNodesRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PutNodesRequest::CopyFrom(const PutNodesRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:statedb.v1.PutNodesRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PutNodesRequest::IsInitialized() const {
+  return true;
+}
+
+void PutNodesRequest::InternalSwap(PutNodesRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  nodes_.Swap(&other->nodes_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(persistent_, other->persistent_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PutNodesRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void PutNodesResponse::InitAsDefaultInstance() {
+  ::statedb::v1::_PutNodesResponse_default_instance_._instance.get_mutable()->result_ = const_cast< ::statedb::v1::ResultCode*>(
+      ::statedb::v1::ResultCode::internal_default_instance());
+}
+class PutNodesResponse::_Internal {
+ public:
+  static const ::statedb::v1::ResultCode& result(const PutNodesResponse* msg);
+};
+
+const ::statedb::v1::ResultCode&
+PutNodesResponse::_Internal::result(const PutNodesResponse* msg) {
+  return *msg->result_;
+}
+PutNodesResponse::PutNodesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:statedb.v1.PutNodesResponse)
+}
+PutNodesResponse::PutNodesResponse(const PutNodesResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_result()) {
+    result_ = new ::statedb::v1::ResultCode(*from.result_);
+  } else {
+    result_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:statedb.v1.PutNodesResponse)
+}
+
+void PutNodesResponse::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_PutNodesResponse_statedb_2eproto.base);
+  result_ = nullptr;
+}
+
+PutNodesResponse::~PutNodesResponse() {
+  // @@protoc_insertion_point(destructor:statedb.v1.PutNodesResponse)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void PutNodesResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete result_;
+}
+
+void PutNodesResponse::ArenaDtor(void* object) {
+  PutNodesResponse* _this = reinterpret_cast< PutNodesResponse* >(object);
+  (void)_this;
+}
+void PutNodesResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void PutNodesResponse::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const PutNodesResponse& PutNodesResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PutNodesResponse_statedb_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void PutNodesResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:statedb.v1.PutNodesResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PutNodesResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .statedb.v1.ResultCode result = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* PutNodesResponse::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:statedb.v1.PutNodesResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .statedb.v1.ResultCode result = 1;
+  if (this->has_result()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::result(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:statedb.v1.PutNodesResponse)
+  return target;
+}
+
+size_t PutNodesResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:statedb.v1.PutNodesResponse)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .statedb.v1.ResultCode result = 1;
+  if (this->has_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *result_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void PutNodesResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:statedb.v1.PutNodesResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const PutNodesResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PutNodesResponse>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:statedb.v1.PutNodesResponse)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:statedb.v1.PutNodesResponse)
+    MergeFrom(*source);
+  }
+}
+
+void PutNodesResponse::MergeFrom(const PutNodesResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:statedb.v1.PutNodesResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_result()) {
+    _internal_mutable_result()->::statedb::v1::ResultCode::MergeFrom(from._internal_result());
+  }
+}
+
+void PutNodesResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:statedb.v1.PutNodesResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PutNodesResponse::CopyFrom(const PutNodesResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:statedb.v1.PutNodesResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PutNodesResponse::IsInitialized() const {
+  return true;
+}
+
+void PutNodesResponse::InternalSwap(PutNodesResponse* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(result_, other->result_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PutNodesResponse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace v1
+}  // namespace statedb
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::statedb::v1::Version* Arena::CreateMaybeMessage< ::statedb::v1::Version >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::Version >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::SetRequest* Arena::CreateMaybeMessage< ::statedb::v1::SetRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::SetRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::GetRequest* Arena::CreateMaybeMessage< ::statedb::v1::GetRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::GetRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::SetProgramRequest* Arena::CreateMaybeMessage< ::statedb::v1::SetProgramRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::SetProgramRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::GetProgramRequest* Arena::CreateMaybeMessage< ::statedb::v1::GetProgramRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::GetProgramRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::SetResponse_SiblingsEntry_DoNotUse* Arena::CreateMaybeMessage< ::statedb::v1::SetResponse_SiblingsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::SetResponse_SiblingsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::SetResponse* Arena::CreateMaybeMessage< ::statedb::v1::SetResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::SetResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::GetResponse_SiblingsEntry_DoNotUse* Arena::CreateMaybeMessage< ::statedb::v1::GetResponse_SiblingsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::GetResponse_SiblingsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::GetResponse* Arena::CreateMaybeMessage< ::statedb::v1::GetResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::GetResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::SetProgramResponse* Arena::CreateMaybeMessage< ::statedb::v1::SetProgramResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::SetProgramResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::GetProgramResponse* Arena::CreateMaybeMessage< ::statedb::v1::GetProgramResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::GetProgramResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::Fea* Arena::CreateMaybeMessage< ::statedb::v1::Fea >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::Fea >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::SiblingList* Arena::CreateMaybeMessage< ::statedb::v1::SiblingList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::SiblingList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::ResultCode* Arena::CreateMaybeMessage< ::statedb::v1::ResultCode >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::ResultCode >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::GetNodesRequest* Arena::CreateMaybeMessage< ::statedb::v1::GetNodesRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::GetNodesRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::GetNodesResponse* Arena::CreateMaybeMessage< ::statedb::v1::GetNodesResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::GetNodesResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::PutNodesRequest* Arena::CreateMaybeMessage< ::statedb::v1::PutNodesRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::PutNodesRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::statedb::v1::PutNodesResponse* Arena::CreateMaybeMessage< ::statedb::v1::PutNodesResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::statedb::v1::PutNodesResponse >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -64,6 +64,12 @@ namespace v1 {
 class Fea;
 class FeaDefaultTypeInternal;
 extern FeaDefaultTypeInternal _Fea_default_instance_;
+class GetNodesRequest;
+class GetNodesRequestDefaultTypeInternal;
+extern GetNodesRequestDefaultTypeInternal _GetNodesRequest_default_instance_;
+class GetNodesResponse;
+class GetNodesResponseDefaultTypeInternal;
+extern GetNodesResponseDefaultTypeInternal _GetNodesResponse_default_instance_;
 class GetProgramRequest;
 class GetProgramRequestDefaultTypeInternal;
 extern GetProgramRequestDefaultTypeInternal _GetProgramRequest_default_instance_;
@@ -79,6 +85,12 @@ extern GetResponseDefaultTypeInternal _GetResponse_default_instance_;
 class GetResponse_SiblingsEntry_DoNotUse;
 class GetResponse_SiblingsEntry_DoNotUseDefaultTypeInternal;
 extern GetResponse_SiblingsEntry_DoNotUseDefaultTypeInternal _GetResponse_SiblingsEntry_DoNotUse_default_instance_;
+class PutNodesRequest;
+class PutNodesRequestDefaultTypeInternal;
+extern PutNodesRequestDefaultTypeInternal _PutNodesRequest_default_instance_;
+class PutNodesResponse;
+class PutNodesResponseDefaultTypeInternal;
+extern PutNodesResponseDefaultTypeInternal _PutNodesResponse_default_instance_;
 class ResultCode;
 class ResultCodeDefaultTypeInternal;
 extern ResultCodeDefaultTypeInternal _ResultCode_default_instance_;
@@ -107,11 +119,15 @@ extern VersionDefaultTypeInternal _Version_default_instance_;
 }  // namespace statedb
 PROTOBUF_NAMESPACE_OPEN
 template<> ::statedb::v1::Fea* Arena::CreateMaybeMessage<::statedb::v1::Fea>(Arena*);
+template<> ::statedb::v1::GetNodesRequest* Arena::CreateMaybeMessage<::statedb::v1::GetNodesRequest>(Arena*);
+template<> ::statedb::v1::GetNodesResponse* Arena::CreateMaybeMessage<::statedb::v1::GetNodesResponse>(Arena*);
 template<> ::statedb::v1::GetProgramRequest* Arena::CreateMaybeMessage<::statedb::v1::GetProgramRequest>(Arena*);
 template<> ::statedb::v1::GetProgramResponse* Arena::CreateMaybeMessage<::statedb::v1::GetProgramResponse>(Arena*);
 template<> ::statedb::v1::GetRequest* Arena::CreateMaybeMessage<::statedb::v1::GetRequest>(Arena*);
 template<> ::statedb::v1::GetResponse* Arena::CreateMaybeMessage<::statedb::v1::GetResponse>(Arena*);
 template<> ::statedb::v1::GetResponse_SiblingsEntry_DoNotUse* Arena::CreateMaybeMessage<::statedb::v1::GetResponse_SiblingsEntry_DoNotUse>(Arena*);
+template<> ::statedb::v1::PutNodesRequest* Arena::CreateMaybeMessage<::statedb::v1::PutNodesRequest>(Arena*);
+template<> ::statedb::v1::PutNodesResponse* Arena::CreateMaybeMessage<::statedb::v1::PutNodesResponse>(Arena*);
 template<> ::statedb::v1::ResultCode* Arena::CreateMaybeMessage<::statedb::v1::ResultCode>(Arena*);
 template<> ::statedb::v1::SetProgramRequest* Arena::CreateMaybeMessage<::statedb::v1::SetProgramRequest>(Arena*);
 template<> ::statedb::v1::SetProgramResponse* Arena::CreateMaybeMessage<::statedb::v1::SetProgramResponse>(Arena*);
@@ -2591,125 +2607,1507 @@ class ResultCode PROTOBUF_FINAL :
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_statedb_2eproto;
 };
+// -------------------------------------------------------------------
+
+class GetNodesRequest PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:statedb.v1.GetNodesRequest) */ {
+ public:
+  inline GetNodesRequest() : GetNodesRequest(nullptr) {};
+  virtual ~GetNodesRequest();
+
+  GetNodesRequest(const GetNodesRequest& from);
+  GetNodesRequest(GetNodesRequest&& from) noexcept
+    : GetNodesRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetNodesRequest& operator=(const GetNodesRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetNodesRequest& operator=(GetNodesRequest&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GetNodesRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const GetNodesRequest* internal_default_instance() {
+    return reinterpret_cast<const GetNodesRequest*>(
+               &_GetNodesRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(GetNodesRequest& a, GetNodesRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetNodesRequest* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetNodesRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetNodesRequest* New() const final {
+    return CreateMaybeMessage<GetNodesRequest>(nullptr);
+  }
+
+  GetNodesRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GetNodesRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GetNodesRequest& from);
+  void MergeFrom(const GetNodesRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetNodesRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "statedb.v1.GetNodesRequest";
+  }
+  protected:
+  explicit GetNodesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_statedb_2eproto);
+    return ::descriptor_table_statedb_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 1,
+  };
+  // bytes keys = 1;
+  void clear_keys();
+  const std::string& keys() const;
+  void set_keys(const std::string& value);
+  void set_keys(std::string&& value);
+  void set_keys(const char* value);
+  void set_keys(const void* value, size_t size);
+  std::string* mutable_keys();
+  std::string* release_keys();
+  void set_allocated_keys(std::string* keys);
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  std::string* unsafe_arena_release_keys();
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  void unsafe_arena_set_allocated_keys(
+      std::string* keys);
+  private:
+  const std::string& _internal_keys() const;
+  void _internal_set_keys(const std::string& value);
+  std::string* _internal_mutable_keys();
+  public:
+
+  // @@protoc_insertion_point(class_scope:statedb.v1.GetNodesRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr keys_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_statedb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetNodesResponse PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:statedb.v1.GetNodesResponse) */ {
+ public:
+  inline GetNodesResponse() : GetNodesResponse(nullptr) {};
+  virtual ~GetNodesResponse();
+
+  GetNodesResponse(const GetNodesResponse& from);
+  GetNodesResponse(GetNodesResponse&& from) noexcept
+    : GetNodesResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetNodesResponse& operator=(const GetNodesResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetNodesResponse& operator=(GetNodesResponse&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GetNodesResponse& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const GetNodesResponse* internal_default_instance() {
+    return reinterpret_cast<const GetNodesResponse*>(
+               &_GetNodesResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(GetNodesResponse& a, GetNodesResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetNodesResponse* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetNodesResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetNodesResponse* New() const final {
+    return CreateMaybeMessage<GetNodesResponse>(nullptr);
+  }
+
+  GetNodesResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GetNodesResponse>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GetNodesResponse& from);
+  void MergeFrom(const GetNodesResponse& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetNodesResponse* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "statedb.v1.GetNodesResponse";
+  }
+  protected:
+  explicit GetNodesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_statedb_2eproto);
+    return ::descriptor_table_statedb_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodesFieldNumber = 1,
+    kResultFieldNumber = 2,
+  };
+  // bytes nodes = 1;
+  void clear_nodes();
+  const std::string& nodes() const;
+  void set_nodes(const std::string& value);
+  void set_nodes(std::string&& value);
+  void set_nodes(const char* value);
+  void set_nodes(const void* value, size_t size);
+  std::string* mutable_nodes();
+  std::string* release_nodes();
+  void set_allocated_nodes(std::string* nodes);
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  std::string* unsafe_arena_release_nodes();
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  void unsafe_arena_set_allocated_nodes(
+      std::string* nodes);
+  private:
+  const std::string& _internal_nodes() const;
+  void _internal_set_nodes(const std::string& value);
+  std::string* _internal_mutable_nodes();
+  public:
+
+  // .statedb.v1.ResultCode result = 2;
+  bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
+  void clear_result();
+  const ::statedb::v1::ResultCode& result() const;
+  ::statedb::v1::ResultCode* release_result();
+  ::statedb::v1::ResultCode* mutable_result();
+  void set_allocated_result(::statedb::v1::ResultCode* result);
+  private:
+  const ::statedb::v1::ResultCode& _internal_result() const;
+  ::statedb::v1::ResultCode* _internal_mutable_result();
+  public:
+  void unsafe_arena_set_allocated_result(
+      ::statedb::v1::ResultCode* result);
+  ::statedb::v1::ResultCode* unsafe_arena_release_result();
+
+  // @@protoc_insertion_point(class_scope:statedb.v1.GetNodesResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nodes_;
+  ::statedb::v1::ResultCode* result_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_statedb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PutNodesRequest PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:statedb.v1.PutNodesRequest) */ {
+ public:
+  inline PutNodesRequest() : PutNodesRequest(nullptr) {};
+  virtual ~PutNodesRequest();
+
+  PutNodesRequest(const PutNodesRequest& from);
+  PutNodesRequest(PutNodesRequest&& from) noexcept
+    : PutNodesRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline PutNodesRequest& operator=(const PutNodesRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PutNodesRequest& operator=(PutNodesRequest&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const PutNodesRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const PutNodesRequest* internal_default_instance() {
+    return reinterpret_cast<const PutNodesRequest*>(
+               &_PutNodesRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(PutNodesRequest& a, PutNodesRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PutNodesRequest* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PutNodesRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline PutNodesRequest* New() const final {
+    return CreateMaybeMessage<PutNodesRequest>(nullptr);
+  }
+
+  PutNodesRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<PutNodesRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const PutNodesRequest& from);
+  void MergeFrom(const PutNodesRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PutNodesRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "statedb.v1.PutNodesRequest";
+  }
+  protected:
+  explicit PutNodesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_statedb_2eproto);
+    return ::descriptor_table_statedb_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodesFieldNumber = 1,
+    kPersistentFieldNumber = 2,
+  };
+  // bytes nodes = 1;
+  void clear_nodes();
+  const std::string& nodes() const;
+  void set_nodes(const std::string& value);
+  void set_nodes(std::string&& value);
+  void set_nodes(const char* value);
+  void set_nodes(const void* value, size_t size);
+  std::string* mutable_nodes();
+  std::string* release_nodes();
+  void set_allocated_nodes(std::string* nodes);
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  std::string* unsafe_arena_release_nodes();
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  void unsafe_arena_set_allocated_nodes(
+      std::string* nodes);
+  private:
+  const std::string& _internal_nodes() const;
+  void _internal_set_nodes(const std::string& value);
+  std::string* _internal_mutable_nodes();
+  public:
+
+  // bool persistent = 2;
+  void clear_persistent();
+  bool persistent() const;
+  void set_persistent(bool value);
+  private:
+  bool _internal_persistent() const;
+  void _internal_set_persistent(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:statedb.v1.PutNodesRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nodes_;
+  bool persistent_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_statedb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PutNodesResponse PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:statedb.v1.PutNodesResponse) */ {
+ public:
+  inline PutNodesResponse() : PutNodesResponse(nullptr) {};
+  virtual ~PutNodesResponse();
+
+  PutNodesResponse(const PutNodesResponse& from);
+  PutNodesResponse(PutNodesResponse&& from) noexcept
+    : PutNodesResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline PutNodesResponse& operator=(const PutNodesResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PutNodesResponse& operator=(PutNodesResponse&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const PutNodesResponse& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const PutNodesResponse* internal_default_instance() {
+    return reinterpret_cast<const PutNodesResponse*>(
+               &_PutNodesResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(PutNodesResponse& a, PutNodesResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PutNodesResponse* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PutNodesResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline PutNodesResponse* New() const final {
+    return CreateMaybeMessage<PutNodesResponse>(nullptr);
+  }
+
+  PutNodesResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<PutNodesResponse>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const PutNodesResponse& from);
+  void MergeFrom(const PutNodesResponse& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PutNodesResponse* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "statedb.v1.PutNodesResponse";
+  }
+  protected:
+  explicit PutNodesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_statedb_2eproto);
+    return ::descriptor_table_statedb_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultFieldNumber = 1,
+  };
+  // .statedb.v1.ResultCode result = 1;
+  bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
+  void clear_result();
+  const ::statedb::v1::ResultCode& result() const;
+  ::statedb::v1::ResultCode* release_result();
+  ::statedb::v1::ResultCode* mutable_result();
+  void set_allocated_result(::statedb::v1::ResultCode* result);
+  private:
+  const ::statedb::v1::ResultCode& _internal_result() const;
+  ::statedb::v1::ResultCode* _internal_mutable_result();
+  public:
+  void unsafe_arena_set_allocated_result(
+      ::statedb::v1::ResultCode* result);
+  ::statedb::v1::ResultCode* unsafe_arena_release_result();
+
+  // @@protoc_insertion_point(class_scope:statedb.v1.PutNodesResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::statedb::v1::ResultCode* result_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_statedb_2eproto;
+};
 // ===================================================================
 
 
-// ===================================================================
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Version
+
+// string v0_0_1 = 1;
+inline void Version::clear_v0_0_1() {
+  v0_0_1_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& Version::v0_0_1() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.Version.v0_0_1)
+  return _internal_v0_0_1();
+}
+inline void Version::set_v0_0_1(const std::string& value) {
+  _internal_set_v0_0_1(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.Version.v0_0_1)
+}
+inline std::string* Version::mutable_v0_0_1() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.Version.v0_0_1)
+  return _internal_mutable_v0_0_1();
+}
+inline const std::string& Version::_internal_v0_0_1() const {
+  return v0_0_1_.Get();
+}
+inline void Version::_internal_set_v0_0_1(const std::string& value) {
+  
+  v0_0_1_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Version::set_v0_0_1(std::string&& value) {
+  
+  v0_0_1_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.Version.v0_0_1)
+}
+inline void Version::set_v0_0_1(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  v0_0_1_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:statedb.v1.Version.v0_0_1)
+}
+inline void Version::set_v0_0_1(const char* value,
+    size_t size) {
+  
+  v0_0_1_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:statedb.v1.Version.v0_0_1)
+}
+inline std::string* Version::_internal_mutable_v0_0_1() {
+  
+  return v0_0_1_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Version::release_v0_0_1() {
+  // @@protoc_insertion_point(field_release:statedb.v1.Version.v0_0_1)
+  return v0_0_1_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Version::set_allocated_v0_0_1(std::string* v0_0_1) {
+  if (v0_0_1 != nullptr) {
+    
+  } else {
+    
+  }
+  v0_0_1_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), v0_0_1,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.Version.v0_0_1)
+}
+inline std::string* Version::unsafe_arena_release_v0_0_1() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.Version.v0_0_1)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return v0_0_1_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void Version::unsafe_arena_set_allocated_v0_0_1(
+    std::string* v0_0_1) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (v0_0_1 != nullptr) {
+    
+  } else {
+    
+  }
+  v0_0_1_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      v0_0_1, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.Version.v0_0_1)
+}
+
+// -------------------------------------------------------------------
+
+// SetRequest
+
+// .statedb.v1.Fea old_root = 1;
+inline bool SetRequest::_internal_has_old_root() const {
+  return this != internal_default_instance() && old_root_ != nullptr;
+}
+inline bool SetRequest::has_old_root() const {
+  return _internal_has_old_root();
+}
+inline void SetRequest::clear_old_root() {
+  if (GetArena() == nullptr && old_root_ != nullptr) {
+    delete old_root_;
+  }
+  old_root_ = nullptr;
+}
+inline const ::statedb::v1::Fea& SetRequest::_internal_old_root() const {
+  const ::statedb::v1::Fea* p = old_root_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
+      &::statedb::v1::_Fea_default_instance_);
+}
+inline const ::statedb::v1::Fea& SetRequest::old_root() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetRequest.old_root)
+  return _internal_old_root();
+}
+inline void SetRequest::unsafe_arena_set_allocated_old_root(
+    ::statedb::v1::Fea* old_root) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(old_root_);
+  }
+  old_root_ = old_root;
+  if (old_root) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetRequest.old_root)
+}
+inline ::statedb::v1::Fea* SetRequest::release_old_root() {
+  auto temp = unsafe_arena_release_old_root();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::statedb::v1::Fea* SetRequest::unsafe_arena_release_old_root() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetRequest.old_root)
+  
+  ::statedb::v1::Fea* temp = old_root_;
+  old_root_ = nullptr;
+  return temp;
+}
+inline ::statedb::v1::Fea* SetRequest::_internal_mutable_old_root() {
+  
+  if (old_root_ == nullptr) {
+    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
+    old_root_ = p;
+  }
+  return old_root_;
+}
+inline ::statedb::v1::Fea* SetRequest::mutable_old_root() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetRequest.old_root)
+  return _internal_mutable_old_root();
+}
+inline void SetRequest::set_allocated_old_root(::statedb::v1::Fea* old_root) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete old_root_;
+  }
+  if (old_root) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(old_root);
+    if (message_arena != submessage_arena) {
+      old_root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, old_root, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  old_root_ = old_root;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetRequest.old_root)
+}
+
+// .statedb.v1.Fea key = 2;
+inline bool SetRequest::_internal_has_key() const {
+  return this != internal_default_instance() && key_ != nullptr;
+}
+inline bool SetRequest::has_key() const {
+  return _internal_has_key();
+}
+inline void SetRequest::clear_key() {
+  if (GetArena() == nullptr && key_ != nullptr) {
+    delete key_;
+  }
+  key_ = nullptr;
+}
+inline const ::statedb::v1::Fea& SetRequest::_internal_key() const {
+  const ::statedb::v1::Fea* p = key_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
+      &::statedb::v1::_Fea_default_instance_);
+}
+inline const ::statedb::v1::Fea& SetRequest::key() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetRequest.key)
+  return _internal_key();
+}
+inline void SetRequest::unsafe_arena_set_allocated_key(
+    ::statedb::v1::Fea* key) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_);
+  }
+  key_ = key;
+  if (key) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetRequest.key)
+}
+inline ::statedb::v1::Fea* SetRequest::release_key() {
+  auto temp = unsafe_arena_release_key();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::statedb::v1::Fea* SetRequest::unsafe_arena_release_key() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetRequest.key)
+  
+  ::statedb::v1::Fea* temp = key_;
+  key_ = nullptr;
+  return temp;
+}
+inline ::statedb::v1::Fea* SetRequest::_internal_mutable_key() {
+  
+  if (key_ == nullptr) {
+    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
+    key_ = p;
+  }
+  return key_;
+}
+inline ::statedb::v1::Fea* SetRequest::mutable_key() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetRequest.key)
+  return _internal_mutable_key();
+}
+inline void SetRequest::set_allocated_key(::statedb::v1::Fea* key) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete key_;
+  }
+  if (key) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(key);
+    if (message_arena != submessage_arena) {
+      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  key_ = key;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetRequest.key)
+}
+
+// string value = 3;
+inline void SetRequest::clear_value() {
+  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& SetRequest::value() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetRequest.value)
+  return _internal_value();
+}
+inline void SetRequest::set_value(const std::string& value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.SetRequest.value)
+}
+inline std::string* SetRequest::mutable_value() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetRequest.value)
+  return _internal_mutable_value();
+}
+inline const std::string& SetRequest::_internal_value() const {
+  return value_.Get();
+}
+inline void SetRequest::_internal_set_value(const std::string& value) {
+  
+  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void SetRequest::set_value(std::string&& value) {
+  
+  value_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.SetRequest.value)
+}
+inline void SetRequest::set_value(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:statedb.v1.SetRequest.value)
+}
+inline void SetRequest::set_value(const char* value,
+    size_t size) {
+  
+  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:statedb.v1.SetRequest.value)
+}
+inline std::string* SetRequest::_internal_mutable_value() {
+  
+  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* SetRequest::release_value() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetRequest.value)
+  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void SetRequest::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetRequest.value)
+}
+inline std::string* SetRequest::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.SetRequest.value)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void SetRequest::unsafe_arena_set_allocated_value(
+    std::string* value) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      value, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetRequest.value)
+}
+
+// bool persistent = 4;
+inline void SetRequest::clear_persistent() {
+  persistent_ = false;
+}
+inline bool SetRequest::_internal_persistent() const {
+  return persistent_;
+}
+inline bool SetRequest::persistent() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetRequest.persistent)
+  return _internal_persistent();
+}
+inline void SetRequest::_internal_set_persistent(bool value) {
+  
+  persistent_ = value;
+}
+inline void SetRequest::set_persistent(bool value) {
+  _internal_set_persistent(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.SetRequest.persistent)
+}
+
+// bool details = 5;
+inline void SetRequest::clear_details() {
+  details_ = false;
+}
+inline bool SetRequest::_internal_details() const {
+  return details_;
+}
+inline bool SetRequest::details() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetRequest.details)
+  return _internal_details();
+}
+inline void SetRequest::_internal_set_details(bool value) {
+  
+  details_ = value;
+}
+inline void SetRequest::set_details(bool value) {
+  _internal_set_details(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.SetRequest.details)
+}
+
+// -------------------------------------------------------------------
+
+// GetRequest
+
+// .statedb.v1.Fea root = 1;
+inline bool GetRequest::_internal_has_root() const {
+  return this != internal_default_instance() && root_ != nullptr;
+}
+inline bool GetRequest::has_root() const {
+  return _internal_has_root();
+}
+inline void GetRequest::clear_root() {
+  if (GetArena() == nullptr && root_ != nullptr) {
+    delete root_;
+  }
+  root_ = nullptr;
+}
+inline const ::statedb::v1::Fea& GetRequest::_internal_root() const {
+  const ::statedb::v1::Fea* p = root_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
+      &::statedb::v1::_Fea_default_instance_);
+}
+inline const ::statedb::v1::Fea& GetRequest::root() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetRequest.root)
+  return _internal_root();
+}
+inline void GetRequest::unsafe_arena_set_allocated_root(
+    ::statedb::v1::Fea* root) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(root_);
+  }
+  root_ = root;
+  if (root) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetRequest.root)
+}
+inline ::statedb::v1::Fea* GetRequest::release_root() {
+  auto temp = unsafe_arena_release_root();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::statedb::v1::Fea* GetRequest::unsafe_arena_release_root() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetRequest.root)
+  
+  ::statedb::v1::Fea* temp = root_;
+  root_ = nullptr;
+  return temp;
+}
+inline ::statedb::v1::Fea* GetRequest::_internal_mutable_root() {
+  
+  if (root_ == nullptr) {
+    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
+    root_ = p;
+  }
+  return root_;
+}
+inline ::statedb::v1::Fea* GetRequest::mutable_root() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetRequest.root)
+  return _internal_mutable_root();
+}
+inline void GetRequest::set_allocated_root(::statedb::v1::Fea* root) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete root_;
+  }
+  if (root) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(root);
+    if (message_arena != submessage_arena) {
+      root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, root, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  root_ = root;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetRequest.root)
+}
+
+// .statedb.v1.Fea key = 2;
+inline bool GetRequest::_internal_has_key() const {
+  return this != internal_default_instance() && key_ != nullptr;
+}
+inline bool GetRequest::has_key() const {
+  return _internal_has_key();
+}
+inline void GetRequest::clear_key() {
+  if (GetArena() == nullptr && key_ != nullptr) {
+    delete key_;
+  }
+  key_ = nullptr;
+}
+inline const ::statedb::v1::Fea& GetRequest::_internal_key() const {
+  const ::statedb::v1::Fea* p = key_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
+      &::statedb::v1::_Fea_default_instance_);
+}
+inline const ::statedb::v1::Fea& GetRequest::key() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetRequest.key)
+  return _internal_key();
+}
+inline void GetRequest::unsafe_arena_set_allocated_key(
+    ::statedb::v1::Fea* key) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_);
+  }
+  key_ = key;
+  if (key) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetRequest.key)
+}
+inline ::statedb::v1::Fea* GetRequest::release_key() {
+  auto temp = unsafe_arena_release_key();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::statedb::v1::Fea* GetRequest::unsafe_arena_release_key() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetRequest.key)
+  
+  ::statedb::v1::Fea* temp = key_;
+  key_ = nullptr;
+  return temp;
+}
+inline ::statedb::v1::Fea* GetRequest::_internal_mutable_key() {
+  
+  if (key_ == nullptr) {
+    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
+    key_ = p;
+  }
+  return key_;
+}
+inline ::statedb::v1::Fea* GetRequest::mutable_key() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetRequest.key)
+  return _internal_mutable_key();
+}
+inline void GetRequest::set_allocated_key(::statedb::v1::Fea* key) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete key_;
+  }
+  if (key) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(key);
+    if (message_arena != submessage_arena) {
+      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  key_ = key;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetRequest.key)
+}
+
+// bool details = 3;
+inline void GetRequest::clear_details() {
+  details_ = false;
+}
+inline bool GetRequest::_internal_details() const {
+  return details_;
+}
+inline bool GetRequest::details() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetRequest.details)
+  return _internal_details();
+}
+inline void GetRequest::_internal_set_details(bool value) {
+  
+  details_ = value;
+}
+inline void GetRequest::set_details(bool value) {
+  _internal_set_details(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.GetRequest.details)
+}
+
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Version
+// SetProgramRequest
 
-// string v0_0_1 = 1;
-inline void Version::clear_v0_0_1() {
-  v0_0_1_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// .statedb.v1.Fea key = 1;
+inline bool SetProgramRequest::_internal_has_key() const {
+  return this != internal_default_instance() && key_ != nullptr;
 }
-inline const std::string& Version::v0_0_1() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.Version.v0_0_1)
-  return _internal_v0_0_1();
+inline bool SetProgramRequest::has_key() const {
+  return _internal_has_key();
+}
+inline void SetProgramRequest::clear_key() {
+  if (GetArena() == nullptr && key_ != nullptr) {
+    delete key_;
+  }
+  key_ = nullptr;
+}
+inline const ::statedb::v1::Fea& SetProgramRequest::_internal_key() const {
+  const ::statedb::v1::Fea* p = key_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
+      &::statedb::v1::_Fea_default_instance_);
+}
+inline const ::statedb::v1::Fea& SetProgramRequest::key() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetProgramRequest.key)
+  return _internal_key();
+}
+inline void SetProgramRequest::unsafe_arena_set_allocated_key(
+    ::statedb::v1::Fea* key) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_);
+  }
+  key_ = key;
+  if (key) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetProgramRequest.key)
+}
+inline ::statedb::v1::Fea* SetProgramRequest::release_key() {
+  auto temp = unsafe_arena_release_key();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::statedb::v1::Fea* SetProgramRequest::unsafe_arena_release_key() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetProgramRequest.key)
+  
+  ::statedb::v1::Fea* temp = key_;
+  key_ = nullptr;
+  return temp;
+}
+inline ::statedb::v1::Fea* SetProgramRequest::_internal_mutable_key() {
+  
+  if (key_ == nullptr) {
+    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
+    key_ = p;
+  }
+  return key_;
+}
+inline ::statedb::v1::Fea* SetProgramRequest::mutable_key() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetProgramRequest.key)
+  return _internal_mutable_key();
+}
+inline void SetProgramRequest::set_allocated_key(::statedb::v1::Fea* key) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete key_;
+  }
+  if (key) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(key);
+    if (message_arena != submessage_arena) {
+      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  key_ = key;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetProgramRequest.key)
+}
+
+// bytes data = 2;
+inline void SetProgramRequest::clear_data() {
+  data_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& SetProgramRequest::data() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetProgramRequest.data)
+  return _internal_data();
+}
+inline void SetProgramRequest::set_data(const std::string& value) {
+  _internal_set_data(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.SetProgramRequest.data)
+}
+inline std::string* SetProgramRequest::mutable_data() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetProgramRequest.data)
+  return _internal_mutable_data();
+}
+inline const std::string& SetProgramRequest::_internal_data() const {
+  return data_.Get();
+}
+inline void SetProgramRequest::_internal_set_data(const std::string& value) {
+  
+  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void SetProgramRequest::set_data(std::string&& value) {
+  
+  data_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.SetProgramRequest.data)
+}
+inline void SetProgramRequest::set_data(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:statedb.v1.SetProgramRequest.data)
+}
+inline void SetProgramRequest::set_data(const void* value,
+    size_t size) {
+  
+  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:statedb.v1.SetProgramRequest.data)
+}
+inline std::string* SetProgramRequest::_internal_mutable_data() {
+  
+  return data_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* SetProgramRequest::release_data() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetProgramRequest.data)
+  return data_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void SetProgramRequest::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetProgramRequest.data)
+}
+inline std::string* SetProgramRequest::unsafe_arena_release_data() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.SetProgramRequest.data)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return data_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void SetProgramRequest::unsafe_arena_set_allocated_data(
+    std::string* data) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  data_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      data, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetProgramRequest.data)
 }
-inline void Version::set_v0_0_1(const std::string& value) {
-  _internal_set_v0_0_1(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.Version.v0_0_1)
+
+// bool persistent = 3;
+inline void SetProgramRequest::clear_persistent() {
+  persistent_ = false;
 }
-inline std::string* Version::mutable_v0_0_1() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.Version.v0_0_1)
-  return _internal_mutable_v0_0_1();
+inline bool SetProgramRequest::_internal_persistent() const {
+  return persistent_;
 }
-inline const std::string& Version::_internal_v0_0_1() const {
-  return v0_0_1_.Get();
+inline bool SetProgramRequest::persistent() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetProgramRequest.persistent)
+  return _internal_persistent();
 }
-inline void Version::_internal_set_v0_0_1(const std::string& value) {
+inline void SetProgramRequest::_internal_set_persistent(bool value) {
   
-  v0_0_1_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  persistent_ = value;
 }
-inline void Version::set_v0_0_1(std::string&& value) {
-  
-  v0_0_1_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.Version.v0_0_1)
+inline void SetProgramRequest::set_persistent(bool value) {
+  _internal_set_persistent(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.SetProgramRequest.persistent)
 }
-inline void Version::set_v0_0_1(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  v0_0_1_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:statedb.v1.Version.v0_0_1)
+
+// -------------------------------------------------------------------
+
+// GetProgramRequest
+
+// .statedb.v1.Fea key = 1;
+inline bool GetProgramRequest::_internal_has_key() const {
+  return this != internal_default_instance() && key_ != nullptr;
 }
-inline void Version::set_v0_0_1(const char* value,
-    size_t size) {
-  
-  v0_0_1_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:statedb.v1.Version.v0_0_1)
+inline bool GetProgramRequest::has_key() const {
+  return _internal_has_key();
 }
-inline std::string* Version::_internal_mutable_v0_0_1() {
-  
-  return v0_0_1_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void GetProgramRequest::clear_key() {
+  if (GetArena() == nullptr && key_ != nullptr) {
+    delete key_;
+  }
+  key_ = nullptr;
 }
-inline std::string* Version::release_v0_0_1() {
-  // @@protoc_insertion_point(field_release:statedb.v1.Version.v0_0_1)
-  return v0_0_1_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::statedb::v1::Fea& GetProgramRequest::_internal_key() const {
+  const ::statedb::v1::Fea* p = key_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
+      &::statedb::v1::_Fea_default_instance_);
 }
-inline void Version::set_allocated_v0_0_1(std::string* v0_0_1) {
-  if (v0_0_1 != nullptr) {
+inline const ::statedb::v1::Fea& GetProgramRequest::key() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetProgramRequest.key)
+  return _internal_key();
+}
+inline void GetProgramRequest::unsafe_arena_set_allocated_key(
+    ::statedb::v1::Fea* key) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_);
+  }
+  key_ = key;
+  if (key) {
     
   } else {
     
   }
-  v0_0_1_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), v0_0_1,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.Version.v0_0_1)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetProgramRequest.key)
 }
-inline std::string* Version::unsafe_arena_release_v0_0_1() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.Version.v0_0_1)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline ::statedb::v1::Fea* GetProgramRequest::release_key() {
+  auto temp = unsafe_arena_release_key();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::statedb::v1::Fea* GetProgramRequest::unsafe_arena_release_key() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetProgramRequest.key)
   
-  return v0_0_1_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  ::statedb::v1::Fea* temp = key_;
+  key_ = nullptr;
+  return temp;
 }
-inline void Version::unsafe_arena_set_allocated_v0_0_1(
-    std::string* v0_0_1) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (v0_0_1 != nullptr) {
+inline ::statedb::v1::Fea* GetProgramRequest::_internal_mutable_key() {
+  
+  if (key_ == nullptr) {
+    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
+    key_ = p;
+  }
+  return key_;
+}
+inline ::statedb::v1::Fea* GetProgramRequest::mutable_key() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetProgramRequest.key)
+  return _internal_mutable_key();
+}
+inline void GetProgramRequest::set_allocated_key(::statedb::v1::Fea* key) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete key_;
+  }
+  if (key) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(key);
+    if (message_arena != submessage_arena) {
+      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key, submessage_arena);
+    }
     
   } else {
     
   }
-  v0_0_1_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      v0_0_1, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.Version.v0_0_1)
+  key_ = key;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetProgramRequest.key)
 }
 
 // -------------------------------------------------------------------
 
-// SetRequest
+// -------------------------------------------------------------------
+
+// SetResponse
 
 // .statedb.v1.Fea old_root = 1;
-inline bool SetRequest::_internal_has_old_root() const {
+inline bool SetResponse::_internal_has_old_root() const {
   return this != internal_default_instance() && old_root_ != nullptr;
 }
-inline bool SetRequest::has_old_root() const {
+inline bool SetResponse::has_old_root() const {
   return _internal_has_old_root();
 }
-inline void SetRequest::clear_old_root() {
+inline void SetResponse::clear_old_root() {
   if (GetArena() == nullptr && old_root_ != nullptr) {
     delete old_root_;
   }
   old_root_ = nullptr;
 }
-inline const ::statedb::v1::Fea& SetRequest::_internal_old_root() const {
+inline const ::statedb::v1::Fea& SetResponse::_internal_old_root() const {
   const ::statedb::v1::Fea* p = old_root_;
   return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
       &::statedb::v1::_Fea_default_instance_);
 }
-inline const ::statedb::v1::Fea& SetRequest::old_root() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetRequest.old_root)
+inline const ::statedb::v1::Fea& SetResponse::old_root() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.old_root)
   return _internal_old_root();
 }
-inline void SetRequest::unsafe_arena_set_allocated_old_root(
+inline void SetResponse::unsafe_arena_set_allocated_old_root(
     ::statedb::v1::Fea* old_root) {
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(old_root_);
@@ -2720,23 +4118,23 @@ inline void SetRequest::unsafe_arena_set_allocated_old_root(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetRequest.old_root)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.old_root)
 }
-inline ::statedb::v1::Fea* SetRequest::release_old_root() {
+inline ::statedb::v1::Fea* SetResponse::release_old_root() {
   auto temp = unsafe_arena_release_old_root();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::statedb::v1::Fea* SetRequest::unsafe_arena_release_old_root() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetRequest.old_root)
+inline ::statedb::v1::Fea* SetResponse::unsafe_arena_release_old_root() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.old_root)
   
   ::statedb::v1::Fea* temp = old_root_;
   old_root_ = nullptr;
   return temp;
 }
-inline ::statedb::v1::Fea* SetRequest::_internal_mutable_old_root() {
+inline ::statedb::v1::Fea* SetResponse::_internal_mutable_old_root() {
   
   if (old_root_ == nullptr) {
     auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
@@ -2744,11 +4142,11 @@ inline ::statedb::v1::Fea* SetRequest::_internal_mutable_old_root() {
   }
   return old_root_;
 }
-inline ::statedb::v1::Fea* SetRequest::mutable_old_root() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetRequest.old_root)
+inline ::statedb::v1::Fea* SetResponse::mutable_old_root() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.old_root)
   return _internal_mutable_old_root();
 }
-inline void SetRequest::set_allocated_old_root(::statedb::v1::Fea* old_root) {
+inline void SetResponse::set_allocated_old_root(::statedb::v1::Fea* old_root) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
     delete old_root_;
@@ -2764,33 +4162,114 @@ inline void SetRequest::set_allocated_old_root(::statedb::v1::Fea* old_root) {
   } else {
     
   }
-  old_root_ = old_root;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetRequest.old_root)
+  old_root_ = old_root;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.old_root)
+}
+
+// .statedb.v1.Fea new_root = 2;
+inline bool SetResponse::_internal_has_new_root() const {
+  return this != internal_default_instance() && new_root_ != nullptr;
+}
+inline bool SetResponse::has_new_root() const {
+  return _internal_has_new_root();
+}
+inline void SetResponse::clear_new_root() {
+  if (GetArena() == nullptr && new_root_ != nullptr) {
+    delete new_root_;
+  }
+  new_root_ = nullptr;
+}
+inline const ::statedb::v1::Fea& SetResponse::_internal_new_root() const {
+  const ::statedb::v1::Fea* p = new_root_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
+      &::statedb::v1::_Fea_default_instance_);
+}
+inline const ::statedb::v1::Fea& SetResponse::new_root() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.new_root)
+  return _internal_new_root();
+}
+inline void SetResponse::unsafe_arena_set_allocated_new_root(
+    ::statedb::v1::Fea* new_root) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(new_root_);
+  }
+  new_root_ = new_root;
+  if (new_root) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.new_root)
+}
+inline ::statedb::v1::Fea* SetResponse::release_new_root() {
+  auto temp = unsafe_arena_release_new_root();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::statedb::v1::Fea* SetResponse::unsafe_arena_release_new_root() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.new_root)
+  
+  ::statedb::v1::Fea* temp = new_root_;
+  new_root_ = nullptr;
+  return temp;
+}
+inline ::statedb::v1::Fea* SetResponse::_internal_mutable_new_root() {
+  
+  if (new_root_ == nullptr) {
+    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
+    new_root_ = p;
+  }
+  return new_root_;
+}
+inline ::statedb::v1::Fea* SetResponse::mutable_new_root() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.new_root)
+  return _internal_mutable_new_root();
+}
+inline void SetResponse::set_allocated_new_root(::statedb::v1::Fea* new_root) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete new_root_;
+  }
+  if (new_root) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(new_root);
+    if (message_arena != submessage_arena) {
+      new_root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, new_root, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  new_root_ = new_root;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.new_root)
 }
 
-// .statedb.v1.Fea key = 2;
-inline bool SetRequest::_internal_has_key() const {
+// .statedb.v1.Fea key = 3;
+inline bool SetResponse::_internal_has_key() const {
   return this != internal_default_instance() && key_ != nullptr;
 }
-inline bool SetRequest::has_key() const {
+inline bool SetResponse::has_key() const {
   return _internal_has_key();
 }
-inline void SetRequest::clear_key() {
+inline void SetResponse::clear_key() {
   if (GetArena() == nullptr && key_ != nullptr) {
     delete key_;
   }
   key_ = nullptr;
 }
-inline const ::statedb::v1::Fea& SetRequest::_internal_key() const {
+inline const ::statedb::v1::Fea& SetResponse::_internal_key() const {
   const ::statedb::v1::Fea* p = key_;
   return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
       &::statedb::v1::_Fea_default_instance_);
 }
-inline const ::statedb::v1::Fea& SetRequest::key() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetRequest.key)
+inline const ::statedb::v1::Fea& SetResponse::key() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.key)
   return _internal_key();
 }
-inline void SetRequest::unsafe_arena_set_allocated_key(
+inline void SetResponse::unsafe_arena_set_allocated_key(
     ::statedb::v1::Fea* key) {
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_);
@@ -2801,23 +4280,23 @@ inline void SetRequest::unsafe_arena_set_allocated_key(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetRequest.key)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.key)
 }
-inline ::statedb::v1::Fea* SetRequest::release_key() {
+inline ::statedb::v1::Fea* SetResponse::release_key() {
   auto temp = unsafe_arena_release_key();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::statedb::v1::Fea* SetRequest::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetRequest.key)
+inline ::statedb::v1::Fea* SetResponse::unsafe_arena_release_key() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.key)
   
   ::statedb::v1::Fea* temp = key_;
   key_ = nullptr;
   return temp;
 }
-inline ::statedb::v1::Fea* SetRequest::_internal_mutable_key() {
+inline ::statedb::v1::Fea* SetResponse::_internal_mutable_key() {
   
   if (key_ == nullptr) {
     auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
@@ -2825,11 +4304,11 @@ inline ::statedb::v1::Fea* SetRequest::_internal_mutable_key() {
   }
   return key_;
 }
-inline ::statedb::v1::Fea* SetRequest::mutable_key() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetRequest.key)
+inline ::statedb::v1::Fea* SetResponse::mutable_key() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.key)
   return _internal_mutable_key();
 }
-inline void SetRequest::set_allocated_key(::statedb::v1::Fea* key) {
+inline void SetResponse::set_allocated_key(::statedb::v1::Fea* key) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
     delete key_;
@@ -2846,778 +4325,674 @@ inline void SetRequest::set_allocated_key(::statedb::v1::Fea* key) {
     
   }
   key_ = key;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetRequest.key)
-}
-
-// string value = 3;
-inline void SetRequest::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& SetRequest::value() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetRequest.value)
-  return _internal_value();
-}
-inline void SetRequest::set_value(const std::string& value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.SetRequest.value)
-}
-inline std::string* SetRequest::mutable_value() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetRequest.value)
-  return _internal_mutable_value();
-}
-inline const std::string& SetRequest::_internal_value() const {
-  return value_.Get();
-}
-inline void SetRequest::_internal_set_value(const std::string& value) {
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void SetRequest::set_value(std::string&& value) {
-  
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.SetRequest.value)
-}
-inline void SetRequest::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:statedb.v1.SetRequest.value)
-}
-inline void SetRequest::set_value(const char* value,
-    size_t size) {
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:statedb.v1.SetRequest.value)
-}
-inline std::string* SetRequest::_internal_mutable_value() {
-  
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* SetRequest::release_value() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetRequest.value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void SetRequest::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
-    
-  } else {
-    
-  }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetRequest.value)
-}
-inline std::string* SetRequest::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.SetRequest.value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void SetRequest::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
-    
-  } else {
-    
-  }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetRequest.value)
-}
-
-// bool persistent = 4;
-inline void SetRequest::clear_persistent() {
-  persistent_ = false;
-}
-inline bool SetRequest::_internal_persistent() const {
-  return persistent_;
-}
-inline bool SetRequest::persistent() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetRequest.persistent)
-  return _internal_persistent();
-}
-inline void SetRequest::_internal_set_persistent(bool value) {
-  
-  persistent_ = value;
-}
-inline void SetRequest::set_persistent(bool value) {
-  _internal_set_persistent(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.SetRequest.persistent)
-}
-
-// bool details = 5;
-inline void SetRequest::clear_details() {
-  details_ = false;
-}
-inline bool SetRequest::_internal_details() const {
-  return details_;
-}
-inline bool SetRequest::details() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetRequest.details)
-  return _internal_details();
-}
-inline void SetRequest::_internal_set_details(bool value) {
-  
-  details_ = value;
-}
-inline void SetRequest::set_details(bool value) {
-  _internal_set_details(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.SetRequest.details)
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.key)
 }
 
-// -------------------------------------------------------------------
-
-// GetRequest
-
-// .statedb.v1.Fea root = 1;
-inline bool GetRequest::_internal_has_root() const {
-  return this != internal_default_instance() && root_ != nullptr;
-}
-inline bool GetRequest::has_root() const {
-  return _internal_has_root();
-}
-inline void GetRequest::clear_root() {
-  if (GetArena() == nullptr && root_ != nullptr) {
-    delete root_;
-  }
-  root_ = nullptr;
-}
-inline const ::statedb::v1::Fea& GetRequest::_internal_root() const {
-  const ::statedb::v1::Fea* p = root_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
-      &::statedb::v1::_Fea_default_instance_);
-}
-inline const ::statedb::v1::Fea& GetRequest::root() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetRequest.root)
-  return _internal_root();
-}
-inline void GetRequest::unsafe_arena_set_allocated_root(
-    ::statedb::v1::Fea* root) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(root_);
-  }
-  root_ = root;
-  if (root) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetRequest.root)
+// map<uint64, .statedb.v1.SiblingList> siblings = 4;
+inline int SetResponse::_internal_siblings_size() const {
+  return siblings_.size();
 }
-inline ::statedb::v1::Fea* GetRequest::release_root() {
-  auto temp = unsafe_arena_release_root();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
+inline int SetResponse::siblings_size() const {
+  return _internal_siblings_size();
 }
-inline ::statedb::v1::Fea* GetRequest::unsafe_arena_release_root() {
-  // @@protoc_insertion_point(field_release:statedb.v1.GetRequest.root)
-  
-  ::statedb::v1::Fea* temp = root_;
-  root_ = nullptr;
-  return temp;
+inline void SetResponse::clear_siblings() {
+  siblings_.Clear();
 }
-inline ::statedb::v1::Fea* GetRequest::_internal_mutable_root() {
-  
-  if (root_ == nullptr) {
-    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
-    root_ = p;
-  }
-  return root_;
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::statedb::v1::SiblingList >&
+SetResponse::_internal_siblings() const {
+  return siblings_.GetMap();
 }
-inline ::statedb::v1::Fea* GetRequest::mutable_root() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.GetRequest.root)
-  return _internal_mutable_root();
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::statedb::v1::SiblingList >&
+SetResponse::siblings() const {
+  // @@protoc_insertion_point(field_map:statedb.v1.SetResponse.siblings)
+  return _internal_siblings();
 }
-inline void GetRequest::set_allocated_root(::statedb::v1::Fea* root) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete root_;
-  }
-  if (root) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(root);
-    if (message_arena != submessage_arena) {
-      root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, root, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  root_ = root;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetRequest.root)
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::statedb::v1::SiblingList >*
+SetResponse::_internal_mutable_siblings() {
+  return siblings_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::statedb::v1::SiblingList >*
+SetResponse::mutable_siblings() {
+  // @@protoc_insertion_point(field_mutable_map:statedb.v1.SetResponse.siblings)
+  return _internal_mutable_siblings();
 }
 
-// .statedb.v1.Fea key = 2;
-inline bool GetRequest::_internal_has_key() const {
-  return this != internal_default_instance() && key_ != nullptr;
+// .statedb.v1.Fea ins_key = 5;
+inline bool SetResponse::_internal_has_ins_key() const {
+  return this != internal_default_instance() && ins_key_ != nullptr;
 }
-inline bool GetRequest::has_key() const {
-  return _internal_has_key();
+inline bool SetResponse::has_ins_key() const {
+  return _internal_has_ins_key();
 }
-inline void GetRequest::clear_key() {
-  if (GetArena() == nullptr && key_ != nullptr) {
-    delete key_;
+inline void SetResponse::clear_ins_key() {
+  if (GetArena() == nullptr && ins_key_ != nullptr) {
+    delete ins_key_;
   }
-  key_ = nullptr;
+  ins_key_ = nullptr;
 }
-inline const ::statedb::v1::Fea& GetRequest::_internal_key() const {
-  const ::statedb::v1::Fea* p = key_;
+inline const ::statedb::v1::Fea& SetResponse::_internal_ins_key() const {
+  const ::statedb::v1::Fea* p = ins_key_;
   return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
       &::statedb::v1::_Fea_default_instance_);
 }
-inline const ::statedb::v1::Fea& GetRequest::key() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetRequest.key)
-  return _internal_key();
+inline const ::statedb::v1::Fea& SetResponse::ins_key() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.ins_key)
+  return _internal_ins_key();
 }
-inline void GetRequest::unsafe_arena_set_allocated_key(
-    ::statedb::v1::Fea* key) {
+inline void SetResponse::unsafe_arena_set_allocated_ins_key(
+    ::statedb::v1::Fea* ins_key) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(ins_key_);
   }
-  key_ = key;
-  if (key) {
+  ins_key_ = ins_key;
+  if (ins_key) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetRequest.key)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.ins_key)
 }
-inline ::statedb::v1::Fea* GetRequest::release_key() {
-  auto temp = unsafe_arena_release_key();
+inline ::statedb::v1::Fea* SetResponse::release_ins_key() {
+  auto temp = unsafe_arena_release_ins_key();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::statedb::v1::Fea* GetRequest::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_release:statedb.v1.GetRequest.key)
+inline ::statedb::v1::Fea* SetResponse::unsafe_arena_release_ins_key() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.ins_key)
   
-  ::statedb::v1::Fea* temp = key_;
-  key_ = nullptr;
+  ::statedb::v1::Fea* temp = ins_key_;
+  ins_key_ = nullptr;
   return temp;
 }
-inline ::statedb::v1::Fea* GetRequest::_internal_mutable_key() {
+inline ::statedb::v1::Fea* SetResponse::_internal_mutable_ins_key() {
   
-  if (key_ == nullptr) {
+  if (ins_key_ == nullptr) {
     auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
-    key_ = p;
+    ins_key_ = p;
   }
-  return key_;
+  return ins_key_;
 }
-inline ::statedb::v1::Fea* GetRequest::mutable_key() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.GetRequest.key)
-  return _internal_mutable_key();
+inline ::statedb::v1::Fea* SetResponse::mutable_ins_key() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.ins_key)
+  return _internal_mutable_ins_key();
 }
-inline void GetRequest::set_allocated_key(::statedb::v1::Fea* key) {
+inline void SetResponse::set_allocated_ins_key(::statedb::v1::Fea* ins_key) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete key_;
+    delete ins_key_;
   }
-  if (key) {
+  if (ins_key) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(key);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(ins_key);
     if (message_arena != submessage_arena) {
-      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, key, submessage_arena);
+      ins_key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ins_key, submessage_arena);
     }
     
   } else {
     
   }
-  key_ = key;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetRequest.key)
+  ins_key_ = ins_key;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.ins_key)
 }
 
-// bool details = 3;
-inline void GetRequest::clear_details() {
-  details_ = false;
+// string ins_value = 6;
+inline void SetResponse::clear_ins_value() {
+  ins_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline bool GetRequest::_internal_details() const {
-  return details_;
+inline const std::string& SetResponse::ins_value() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.ins_value)
+  return _internal_ins_value();
 }
-inline bool GetRequest::details() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetRequest.details)
-  return _internal_details();
+inline void SetResponse::set_ins_value(const std::string& value) {
+  _internal_set_ins_value(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.SetResponse.ins_value)
 }
-inline void GetRequest::_internal_set_details(bool value) {
-  
-  details_ = value;
+inline std::string* SetResponse::mutable_ins_value() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.ins_value)
+  return _internal_mutable_ins_value();
 }
-inline void GetRequest::set_details(bool value) {
-  _internal_set_details(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.GetRequest.details)
+inline const std::string& SetResponse::_internal_ins_value() const {
+  return ins_value_.Get();
 }
-
-// -------------------------------------------------------------------
-
-// SetProgramRequest
-
-// .statedb.v1.Fea key = 1;
-inline bool SetProgramRequest::_internal_has_key() const {
-  return this != internal_default_instance() && key_ != nullptr;
+inline void SetResponse::_internal_set_ins_value(const std::string& value) {
+  
+  ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline bool SetProgramRequest::has_key() const {
-  return _internal_has_key();
+inline void SetResponse::set_ins_value(std::string&& value) {
+  
+  ins_value_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.SetResponse.ins_value)
 }
-inline void SetProgramRequest::clear_key() {
-  if (GetArena() == nullptr && key_ != nullptr) {
-    delete key_;
-  }
-  key_ = nullptr;
+inline void SetResponse::set_ins_value(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:statedb.v1.SetResponse.ins_value)
 }
-inline const ::statedb::v1::Fea& SetProgramRequest::_internal_key() const {
-  const ::statedb::v1::Fea* p = key_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
-      &::statedb::v1::_Fea_default_instance_);
+inline void SetResponse::set_ins_value(const char* value,
+    size_t size) {
+  
+  ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:statedb.v1.SetResponse.ins_value)
 }
-inline const ::statedb::v1::Fea& SetProgramRequest::key() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetProgramRequest.key)
-  return _internal_key();
+inline std::string* SetResponse::_internal_mutable_ins_value() {
+  
+  return ins_value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void SetProgramRequest::unsafe_arena_set_allocated_key(
-    ::statedb::v1::Fea* key) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_);
-  }
-  key_ = key;
-  if (key) {
+inline std::string* SetResponse::release_ins_value() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.ins_value)
+  return ins_value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void SetResponse::set_allocated_ins_value(std::string* ins_value) {
+  if (ins_value != nullptr) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetProgramRequest.key)
+  ins_value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ins_value,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.ins_value)
 }
-inline ::statedb::v1::Fea* SetProgramRequest::release_key() {
-  auto temp = unsafe_arena_release_key();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+inline std::string* SetResponse::unsafe_arena_release_ins_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.SetResponse.ins_value)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return ins_value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void SetResponse::unsafe_arena_set_allocated_ins_value(
+    std::string* ins_value) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (ins_value != nullptr) {
+    
+  } else {
+    
   }
-  return temp;
+  ins_value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ins_value, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.ins_value)
+}
+
+// bool is_old0 = 7;
+inline void SetResponse::clear_is_old0() {
+  is_old0_ = false;
+}
+inline bool SetResponse::_internal_is_old0() const {
+  return is_old0_;
+}
+inline bool SetResponse::is_old0() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.is_old0)
+  return _internal_is_old0();
+}
+inline void SetResponse::_internal_set_is_old0(bool value) {
+  
+  is_old0_ = value;
+}
+inline void SetResponse::set_is_old0(bool value) {
+  _internal_set_is_old0(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.SetResponse.is_old0)
+}
+
+// string old_value = 8;
+inline void SetResponse::clear_old_value() {
+  old_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& SetResponse::old_value() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.old_value)
+  return _internal_old_value();
+}
+inline void SetResponse::set_old_value(const std::string& value) {
+  _internal_set_old_value(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.SetResponse.old_value)
+}
+inline std::string* SetResponse::mutable_old_value() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.old_value)
+  return _internal_mutable_old_value();
+}
+inline const std::string& SetResponse::_internal_old_value() const {
+  return old_value_.Get();
+}
+inline void SetResponse::_internal_set_old_value(const std::string& value) {
+  
+  old_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void SetResponse::set_old_value(std::string&& value) {
+  
+  old_value_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.SetResponse.old_value)
+}
+inline void SetResponse::set_old_value(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  old_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:statedb.v1.SetResponse.old_value)
 }
-inline ::statedb::v1::Fea* SetProgramRequest::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetProgramRequest.key)
+inline void SetResponse::set_old_value(const char* value,
+    size_t size) {
   
-  ::statedb::v1::Fea* temp = key_;
-  key_ = nullptr;
-  return temp;
+  old_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:statedb.v1.SetResponse.old_value)
 }
-inline ::statedb::v1::Fea* SetProgramRequest::_internal_mutable_key() {
+inline std::string* SetResponse::_internal_mutable_old_value() {
   
-  if (key_ == nullptr) {
-    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
-    key_ = p;
-  }
-  return key_;
+  return old_value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline ::statedb::v1::Fea* SetProgramRequest::mutable_key() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetProgramRequest.key)
-  return _internal_mutable_key();
+inline std::string* SetResponse::release_old_value() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.old_value)
+  return old_value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void SetProgramRequest::set_allocated_key(::statedb::v1::Fea* key) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete key_;
+inline void SetResponse::set_allocated_old_value(std::string* old_value) {
+  if (old_value != nullptr) {
+    
+  } else {
+    
   }
-  if (key) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(key);
-    if (message_arena != submessage_arena) {
-      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, key, submessage_arena);
-    }
+  old_value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), old_value,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.old_value)
+}
+inline std::string* SetResponse::unsafe_arena_release_old_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.SetResponse.old_value)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return old_value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void SetResponse::unsafe_arena_set_allocated_old_value(
+    std::string* old_value) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (old_value != nullptr) {
     
   } else {
     
   }
-  key_ = key;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetProgramRequest.key)
+  old_value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      old_value, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.old_value)
 }
 
-// bytes data = 2;
-inline void SetProgramRequest::clear_data() {
-  data_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// string new_value = 9;
+inline void SetResponse::clear_new_value() {
+  new_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& SetProgramRequest::data() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetProgramRequest.data)
-  return _internal_data();
+inline const std::string& SetResponse::new_value() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.new_value)
+  return _internal_new_value();
 }
-inline void SetProgramRequest::set_data(const std::string& value) {
-  _internal_set_data(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.SetProgramRequest.data)
+inline void SetResponse::set_new_value(const std::string& value) {
+  _internal_set_new_value(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.SetResponse.new_value)
 }
-inline std::string* SetProgramRequest::mutable_data() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetProgramRequest.data)
-  return _internal_mutable_data();
+inline std::string* SetResponse::mutable_new_value() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.new_value)
+  return _internal_mutable_new_value();
 }
-inline const std::string& SetProgramRequest::_internal_data() const {
-  return data_.Get();
+inline const std::string& SetResponse::_internal_new_value() const {
+  return new_value_.Get();
 }
-inline void SetProgramRequest::_internal_set_data(const std::string& value) {
+inline void SetResponse::_internal_set_new_value(const std::string& value) {
   
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  new_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void SetProgramRequest::set_data(std::string&& value) {
+inline void SetResponse::set_new_value(std::string&& value) {
   
-  data_.Set(
+  new_value_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.SetProgramRequest.data)
+  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.SetResponse.new_value)
 }
-inline void SetProgramRequest::set_data(const char* value) {
+inline void SetResponse::set_new_value(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  new_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:statedb.v1.SetProgramRequest.data)
+  // @@protoc_insertion_point(field_set_char:statedb.v1.SetResponse.new_value)
 }
-inline void SetProgramRequest::set_data(const void* value,
+inline void SetResponse::set_new_value(const char* value,
     size_t size) {
   
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  new_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:statedb.v1.SetProgramRequest.data)
+  // @@protoc_insertion_point(field_set_pointer:statedb.v1.SetResponse.new_value)
 }
-inline std::string* SetProgramRequest::_internal_mutable_data() {
+inline std::string* SetResponse::_internal_mutable_new_value() {
   
-  return data_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return new_value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* SetProgramRequest::release_data() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetProgramRequest.data)
-  return data_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* SetResponse::release_new_value() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.new_value)
+  return new_value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void SetProgramRequest::set_allocated_data(std::string* data) {
-  if (data != nullptr) {
+inline void SetResponse::set_allocated_new_value(std::string* new_value) {
+  if (new_value != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data,
+  new_value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), new_value,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetProgramRequest.data)
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.new_value)
 }
-inline std::string* SetProgramRequest::unsafe_arena_release_data() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.SetProgramRequest.data)
+inline std::string* SetResponse::unsafe_arena_release_new_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.SetResponse.new_value)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
-  return data_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  return new_value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void SetProgramRequest::unsafe_arena_set_allocated_data(
-    std::string* data) {
+inline void SetResponse::unsafe_arena_set_allocated_new_value(
+    std::string* new_value) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (data != nullptr) {
+  if (new_value != nullptr) {
     
   } else {
     
   }
-  data_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      data, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetProgramRequest.data)
+  new_value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      new_value, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.new_value)
 }
 
-// bool persistent = 3;
-inline void SetProgramRequest::clear_persistent() {
-  persistent_ = false;
+// string mode = 10;
+inline void SetResponse::clear_mode() {
+  mode_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline bool SetProgramRequest::_internal_persistent() const {
-  return persistent_;
+inline const std::string& SetResponse::mode() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.mode)
+  return _internal_mode();
 }
-inline bool SetProgramRequest::persistent() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetProgramRequest.persistent)
-  return _internal_persistent();
+inline void SetResponse::set_mode(const std::string& value) {
+  _internal_set_mode(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.SetResponse.mode)
 }
-inline void SetProgramRequest::_internal_set_persistent(bool value) {
-  
-  persistent_ = value;
+inline std::string* SetResponse::mutable_mode() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.mode)
+  return _internal_mutable_mode();
 }
-inline void SetProgramRequest::set_persistent(bool value) {
-  _internal_set_persistent(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.SetProgramRequest.persistent)
+inline const std::string& SetResponse::_internal_mode() const {
+  return mode_.Get();
 }
-
-// -------------------------------------------------------------------
-
-// GetProgramRequest
-
-// .statedb.v1.Fea key = 1;
-inline bool GetProgramRequest::_internal_has_key() const {
-  return this != internal_default_instance() && key_ != nullptr;
+inline void SetResponse::_internal_set_mode(const std::string& value) {
+  
+  mode_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline bool GetProgramRequest::has_key() const {
-  return _internal_has_key();
+inline void SetResponse::set_mode(std::string&& value) {
+  
+  mode_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.SetResponse.mode)
 }
-inline void GetProgramRequest::clear_key() {
-  if (GetArena() == nullptr && key_ != nullptr) {
-    delete key_;
-  }
-  key_ = nullptr;
+inline void SetResponse::set_mode(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  mode_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:statedb.v1.SetResponse.mode)
 }
-inline const ::statedb::v1::Fea& GetProgramRequest::_internal_key() const {
-  const ::statedb::v1::Fea* p = key_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
-      &::statedb::v1::_Fea_default_instance_);
+inline void SetResponse::set_mode(const char* value,
+    size_t size) {
+  
+  mode_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:statedb.v1.SetResponse.mode)
 }
-inline const ::statedb::v1::Fea& GetProgramRequest::key() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetProgramRequest.key)
-  return _internal_key();
+inline std::string* SetResponse::_internal_mutable_mode() {
+  
+  return mode_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void GetProgramRequest::unsafe_arena_set_allocated_key(
-    ::statedb::v1::Fea* key) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_);
-  }
-  key_ = key;
-  if (key) {
+inline std::string* SetResponse::release_mode() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.mode)
+  return mode_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void SetResponse::set_allocated_mode(std::string* mode) {
+  if (mode != nullptr) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetProgramRequest.key)
-}
-inline ::statedb::v1::Fea* GetProgramRequest::release_key() {
-  auto temp = unsafe_arena_release_key();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
-}
-inline ::statedb::v1::Fea* GetProgramRequest::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_release:statedb.v1.GetProgramRequest.key)
-  
-  ::statedb::v1::Fea* temp = key_;
-  key_ = nullptr;
-  return temp;
-}
-inline ::statedb::v1::Fea* GetProgramRequest::_internal_mutable_key() {
-  
-  if (key_ == nullptr) {
-    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
-    key_ = p;
-  }
-  return key_;
+  mode_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), mode,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.mode)
 }
-inline ::statedb::v1::Fea* GetProgramRequest::mutable_key() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.GetProgramRequest.key)
-  return _internal_mutable_key();
+inline std::string* SetResponse::unsafe_arena_release_mode() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.SetResponse.mode)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return mode_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
 }
-inline void GetProgramRequest::set_allocated_key(::statedb::v1::Fea* key) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete key_;
-  }
-  if (key) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(key);
-    if (message_arena != submessage_arena) {
-      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, key, submessage_arena);
-    }
+inline void SetResponse::unsafe_arena_set_allocated_mode(
+    std::string* mode) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (mode != nullptr) {
     
   } else {
     
   }
-  key_ = key;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetProgramRequest.key)
+  mode_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      mode, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.mode)
 }
 
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// SetResponse
+// uint64 proof_hash_counter = 11;
+inline void SetResponse::clear_proof_hash_counter() {
+  proof_hash_counter_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 SetResponse::_internal_proof_hash_counter() const {
+  return proof_hash_counter_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 SetResponse::proof_hash_counter() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.proof_hash_counter)
+  return _internal_proof_hash_counter();
+}
+inline void SetResponse::_internal_set_proof_hash_counter(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  proof_hash_counter_ = value;
+}
+inline void SetResponse::set_proof_hash_counter(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_proof_hash_counter(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.SetResponse.proof_hash_counter)
+}
 
-// .statedb.v1.Fea old_root = 1;
-inline bool SetResponse::_internal_has_old_root() const {
-  return this != internal_default_instance() && old_root_ != nullptr;
+// .statedb.v1.ResultCode result = 12;
+inline bool SetResponse::_internal_has_result() const {
+  return this != internal_default_instance() && result_ != nullptr;
 }
-inline bool SetResponse::has_old_root() const {
-  return _internal_has_old_root();
+inline bool SetResponse::has_result() const {
+  return _internal_has_result();
 }
-inline void SetResponse::clear_old_root() {
-  if (GetArena() == nullptr && old_root_ != nullptr) {
-    delete old_root_;
+inline void SetResponse::clear_result() {
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
   }
-  old_root_ = nullptr;
+  result_ = nullptr;
 }
-inline const ::statedb::v1::Fea& SetResponse::_internal_old_root() const {
-  const ::statedb::v1::Fea* p = old_root_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
-      &::statedb::v1::_Fea_default_instance_);
+inline const ::statedb::v1::ResultCode& SetResponse::_internal_result() const {
+  const ::statedb::v1::ResultCode* p = result_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::ResultCode*>(
+      &::statedb::v1::_ResultCode_default_instance_);
 }
-inline const ::statedb::v1::Fea& SetResponse::old_root() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.old_root)
-  return _internal_old_root();
+inline const ::statedb::v1::ResultCode& SetResponse::result() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.result)
+  return _internal_result();
 }
-inline void SetResponse::unsafe_arena_set_allocated_old_root(
-    ::statedb::v1::Fea* old_root) {
+inline void SetResponse::unsafe_arena_set_allocated_result(
+    ::statedb::v1::ResultCode* result) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(old_root_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
   }
-  old_root_ = old_root;
-  if (old_root) {
+  result_ = result;
+  if (result) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.old_root)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.result)
 }
-inline ::statedb::v1::Fea* SetResponse::release_old_root() {
-  auto temp = unsafe_arena_release_old_root();
+inline ::statedb::v1::ResultCode* SetResponse::release_result() {
+  auto temp = unsafe_arena_release_result();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::statedb::v1::Fea* SetResponse::unsafe_arena_release_old_root() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.old_root)
+inline ::statedb::v1::ResultCode* SetResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.result)
   
-  ::statedb::v1::Fea* temp = old_root_;
-  old_root_ = nullptr;
+  ::statedb::v1::ResultCode* temp = result_;
+  result_ = nullptr;
   return temp;
 }
-inline ::statedb::v1::Fea* SetResponse::_internal_mutable_old_root() {
+inline ::statedb::v1::ResultCode* SetResponse::_internal_mutable_result() {
   
-  if (old_root_ == nullptr) {
-    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
-    old_root_ = p;
+  if (result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::statedb::v1::ResultCode>(GetArena());
+    result_ = p;
   }
-  return old_root_;
+  return result_;
 }
-inline ::statedb::v1::Fea* SetResponse::mutable_old_root() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.old_root)
-  return _internal_mutable_old_root();
+inline ::statedb::v1::ResultCode* SetResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.result)
+  return _internal_mutable_result();
 }
-inline void SetResponse::set_allocated_old_root(::statedb::v1::Fea* old_root) {
+inline void SetResponse::set_allocated_result(::statedb::v1::ResultCode* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete old_root_;
+    delete result_;
   }
-  if (old_root) {
+  if (result) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(old_root);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
     if (message_arena != submessage_arena) {
-      old_root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, old_root, submessage_arena);
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
     }
     
   } else {
     
   }
-  old_root_ = old_root;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.old_root)
+  result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.result)
 }
 
-// .statedb.v1.Fea new_root = 2;
-inline bool SetResponse::_internal_has_new_root() const {
-  return this != internal_default_instance() && new_root_ != nullptr;
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// GetResponse
+
+// .statedb.v1.Fea root = 1;
+inline bool GetResponse::_internal_has_root() const {
+  return this != internal_default_instance() && root_ != nullptr;
 }
-inline bool SetResponse::has_new_root() const {
-  return _internal_has_new_root();
+inline bool GetResponse::has_root() const {
+  return _internal_has_root();
 }
-inline void SetResponse::clear_new_root() {
-  if (GetArena() == nullptr && new_root_ != nullptr) {
-    delete new_root_;
+inline void GetResponse::clear_root() {
+  if (GetArena() == nullptr && root_ != nullptr) {
+    delete root_;
   }
-  new_root_ = nullptr;
+  root_ = nullptr;
 }
-inline const ::statedb::v1::Fea& SetResponse::_internal_new_root() const {
-  const ::statedb::v1::Fea* p = new_root_;
+inline const ::statedb::v1::Fea& GetResponse::_internal_root() const {
+  const ::statedb::v1::Fea* p = root_;
   return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
       &::statedb::v1::_Fea_default_instance_);
 }
-inline const ::statedb::v1::Fea& SetResponse::new_root() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.new_root)
-  return _internal_new_root();
+inline const ::statedb::v1::Fea& GetResponse::root() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.root)
+  return _internal_root();
 }
-inline void SetResponse::unsafe_arena_set_allocated_new_root(
-    ::statedb::v1::Fea* new_root) {
+inline void GetResponse::unsafe_arena_set_allocated_root(
+    ::statedb::v1::Fea* root) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(new_root_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(root_);
   }
-  new_root_ = new_root;
-  if (new_root) {
+  root_ = root;
+  if (root) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.new_root)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetResponse.root)
 }
-inline ::statedb::v1::Fea* SetResponse::release_new_root() {
-  auto temp = unsafe_arena_release_new_root();
+inline ::statedb::v1::Fea* GetResponse::release_root() {
+  auto temp = unsafe_arena_release_root();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::statedb::v1::Fea* SetResponse::unsafe_arena_release_new_root() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.new_root)
+inline ::statedb::v1::Fea* GetResponse::unsafe_arena_release_root() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetResponse.root)
   
-  ::statedb::v1::Fea* temp = new_root_;
-  new_root_ = nullptr;
+  ::statedb::v1::Fea* temp = root_;
+  root_ = nullptr;
   return temp;
 }
-inline ::statedb::v1::Fea* SetResponse::_internal_mutable_new_root() {
+inline ::statedb::v1::Fea* GetResponse::_internal_mutable_root() {
   
-  if (new_root_ == nullptr) {
+  if (root_ == nullptr) {
     auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
-    new_root_ = p;
+    root_ = p;
   }
-  return new_root_;
+  return root_;
 }
-inline ::statedb::v1::Fea* SetResponse::mutable_new_root() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.new_root)
-  return _internal_mutable_new_root();
+inline ::statedb::v1::Fea* GetResponse::mutable_root() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetResponse.root)
+  return _internal_mutable_root();
 }
-inline void SetResponse::set_allocated_new_root(::statedb::v1::Fea* new_root) {
+inline void GetResponse::set_allocated_root(::statedb::v1::Fea* root) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete new_root_;
+    delete root_;
   }
-  if (new_root) {
+  if (root) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(new_root);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(root);
     if (message_arena != submessage_arena) {
-      new_root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, new_root, submessage_arena);
+      root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, root, submessage_arena);
     }
     
   } else {
     
   }
-  new_root_ = new_root;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.new_root)
+  root_ = root;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetResponse.root)
 }
 
-// .statedb.v1.Fea key = 3;
-inline bool SetResponse::_internal_has_key() const {
+// .statedb.v1.Fea key = 2;
+inline bool GetResponse::_internal_has_key() const {
   return this != internal_default_instance() && key_ != nullptr;
 }
-inline bool SetResponse::has_key() const {
+inline bool GetResponse::has_key() const {
   return _internal_has_key();
 }
-inline void SetResponse::clear_key() {
+inline void GetResponse::clear_key() {
   if (GetArena() == nullptr && key_ != nullptr) {
     delete key_;
   }
   key_ = nullptr;
 }
-inline const ::statedb::v1::Fea& SetResponse::_internal_key() const {
+inline const ::statedb::v1::Fea& GetResponse::_internal_key() const {
   const ::statedb::v1::Fea* p = key_;
   return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
       &::statedb::v1::_Fea_default_instance_);
 }
-inline const ::statedb::v1::Fea& SetResponse::key() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.key)
+inline const ::statedb::v1::Fea& GetResponse::key() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.key)
   return _internal_key();
 }
-inline void SetResponse::unsafe_arena_set_allocated_key(
+inline void GetResponse::unsafe_arena_set_allocated_key(
     ::statedb::v1::Fea* key) {
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_);
@@ -3628,23 +5003,23 @@ inline void SetResponse::unsafe_arena_set_allocated_key(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.key)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetResponse.key)
 }
-inline ::statedb::v1::Fea* SetResponse::release_key() {
+inline ::statedb::v1::Fea* GetResponse::release_key() {
   auto temp = unsafe_arena_release_key();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
-}
-inline ::statedb::v1::Fea* SetResponse::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.key)
+}
+inline ::statedb::v1::Fea* GetResponse::unsafe_arena_release_key() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetResponse.key)
   
   ::statedb::v1::Fea* temp = key_;
   key_ = nullptr;
   return temp;
 }
-inline ::statedb::v1::Fea* SetResponse::_internal_mutable_key() {
+inline ::statedb::v1::Fea* GetResponse::_internal_mutable_key() {
   
   if (key_ == nullptr) {
     auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
@@ -3652,11 +5027,11 @@ inline ::statedb::v1::Fea* SetResponse::_internal_mutable_key() {
   }
   return key_;
 }
-inline ::statedb::v1::Fea* SetResponse::mutable_key() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.key)
+inline ::statedb::v1::Fea* GetResponse::mutable_key() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetResponse.key)
   return _internal_mutable_key();
 }
-inline void SetResponse::set_allocated_key(::statedb::v1::Fea* key) {
+inline void GetResponse::set_allocated_key(::statedb::v1::Fea* key) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
     delete key_;
@@ -3673,506 +5048,344 @@ inline void SetResponse::set_allocated_key(::statedb::v1::Fea* key) {
     
   }
   key_ = key;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.key)
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetResponse.key)
 }
 
-// map<uint64, .statedb.v1.SiblingList> siblings = 4;
-inline int SetResponse::_internal_siblings_size() const {
+// map<uint64, .statedb.v1.SiblingList> siblings = 3;
+inline int GetResponse::_internal_siblings_size() const {
   return siblings_.size();
 }
-inline int SetResponse::siblings_size() const {
+inline int GetResponse::siblings_size() const {
   return _internal_siblings_size();
 }
-inline void SetResponse::clear_siblings() {
+inline void GetResponse::clear_siblings() {
   siblings_.Clear();
 }
 inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::statedb::v1::SiblingList >&
-SetResponse::_internal_siblings() const {
+GetResponse::_internal_siblings() const {
   return siblings_.GetMap();
 }
 inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::statedb::v1::SiblingList >&
-SetResponse::siblings() const {
-  // @@protoc_insertion_point(field_map:statedb.v1.SetResponse.siblings)
+GetResponse::siblings() const {
+  // @@protoc_insertion_point(field_map:statedb.v1.GetResponse.siblings)
   return _internal_siblings();
 }
 inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::statedb::v1::SiblingList >*
-SetResponse::_internal_mutable_siblings() {
+GetResponse::_internal_mutable_siblings() {
   return siblings_.MutableMap();
 }
 inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::statedb::v1::SiblingList >*
-SetResponse::mutable_siblings() {
-  // @@protoc_insertion_point(field_mutable_map:statedb.v1.SetResponse.siblings)
+GetResponse::mutable_siblings() {
+  // @@protoc_insertion_point(field_mutable_map:statedb.v1.GetResponse.siblings)
   return _internal_mutable_siblings();
 }
 
-// .statedb.v1.Fea ins_key = 5;
-inline bool SetResponse::_internal_has_ins_key() const {
+// .statedb.v1.Fea ins_key = 4;
+inline bool GetResponse::_internal_has_ins_key() const {
   return this != internal_default_instance() && ins_key_ != nullptr;
 }
-inline bool SetResponse::has_ins_key() const {
+inline bool GetResponse::has_ins_key() const {
   return _internal_has_ins_key();
 }
-inline void SetResponse::clear_ins_key() {
+inline void GetResponse::clear_ins_key() {
   if (GetArena() == nullptr && ins_key_ != nullptr) {
     delete ins_key_;
   }
   ins_key_ = nullptr;
 }
-inline const ::statedb::v1::Fea& SetResponse::_internal_ins_key() const {
-  const ::statedb::v1::Fea* p = ins_key_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
-      &::statedb::v1::_Fea_default_instance_);
-}
-inline const ::statedb::v1::Fea& SetResponse::ins_key() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.ins_key)
-  return _internal_ins_key();
-}
-inline void SetResponse::unsafe_arena_set_allocated_ins_key(
-    ::statedb::v1::Fea* ins_key) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(ins_key_);
-  }
-  ins_key_ = ins_key;
-  if (ins_key) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.ins_key)
-}
-inline ::statedb::v1::Fea* SetResponse::release_ins_key() {
-  auto temp = unsafe_arena_release_ins_key();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
-}
-inline ::statedb::v1::Fea* SetResponse::unsafe_arena_release_ins_key() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.ins_key)
-  
-  ::statedb::v1::Fea* temp = ins_key_;
-  ins_key_ = nullptr;
-  return temp;
-}
-inline ::statedb::v1::Fea* SetResponse::_internal_mutable_ins_key() {
-  
-  if (ins_key_ == nullptr) {
-    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
-    ins_key_ = p;
-  }
-  return ins_key_;
-}
-inline ::statedb::v1::Fea* SetResponse::mutable_ins_key() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.ins_key)
-  return _internal_mutable_ins_key();
-}
-inline void SetResponse::set_allocated_ins_key(::statedb::v1::Fea* ins_key) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete ins_key_;
-  }
-  if (ins_key) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(ins_key);
-    if (message_arena != submessage_arena) {
-      ins_key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, ins_key, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  ins_key_ = ins_key;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.ins_key)
-}
-
-// string ins_value = 6;
-inline void SetResponse::clear_ins_value() {
-  ins_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& SetResponse::ins_value() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.ins_value)
-  return _internal_ins_value();
-}
-inline void SetResponse::set_ins_value(const std::string& value) {
-  _internal_set_ins_value(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.SetResponse.ins_value)
-}
-inline std::string* SetResponse::mutable_ins_value() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.ins_value)
-  return _internal_mutable_ins_value();
-}
-inline const std::string& SetResponse::_internal_ins_value() const {
-  return ins_value_.Get();
-}
-inline void SetResponse::_internal_set_ins_value(const std::string& value) {
-  
-  ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void SetResponse::set_ins_value(std::string&& value) {
-  
-  ins_value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.SetResponse.ins_value)
-}
-inline void SetResponse::set_ins_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:statedb.v1.SetResponse.ins_value)
-}
-inline void SetResponse::set_ins_value(const char* value,
-    size_t size) {
-  
-  ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:statedb.v1.SetResponse.ins_value)
-}
-inline std::string* SetResponse::_internal_mutable_ins_value() {
-  
-  return ins_value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* SetResponse::release_ins_value() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.ins_value)
-  return ins_value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void SetResponse::set_allocated_ins_value(std::string* ins_value) {
-  if (ins_value != nullptr) {
-    
-  } else {
-    
-  }
-  ins_value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ins_value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.ins_value)
-}
-inline std::string* SetResponse::unsafe_arena_release_ins_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.SetResponse.ins_value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return ins_value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void SetResponse::unsafe_arena_set_allocated_ins_value(
-    std::string* ins_value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (ins_value != nullptr) {
-    
-  } else {
-    
-  }
-  ins_value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ins_value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.ins_value)
-}
-
-// bool is_old0 = 7;
-inline void SetResponse::clear_is_old0() {
-  is_old0_ = false;
-}
-inline bool SetResponse::_internal_is_old0() const {
-  return is_old0_;
-}
-inline bool SetResponse::is_old0() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.is_old0)
-  return _internal_is_old0();
-}
-inline void SetResponse::_internal_set_is_old0(bool value) {
-  
-  is_old0_ = value;
-}
-inline void SetResponse::set_is_old0(bool value) {
-  _internal_set_is_old0(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.SetResponse.is_old0)
-}
-
-// string old_value = 8;
-inline void SetResponse::clear_old_value() {
-  old_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& SetResponse::old_value() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.old_value)
-  return _internal_old_value();
-}
-inline void SetResponse::set_old_value(const std::string& value) {
-  _internal_set_old_value(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.SetResponse.old_value)
-}
-inline std::string* SetResponse::mutable_old_value() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.old_value)
-  return _internal_mutable_old_value();
-}
-inline const std::string& SetResponse::_internal_old_value() const {
-  return old_value_.Get();
-}
-inline void SetResponse::_internal_set_old_value(const std::string& value) {
-  
-  old_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void SetResponse::set_old_value(std::string&& value) {
-  
-  old_value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.SetResponse.old_value)
-}
-inline void SetResponse::set_old_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  old_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:statedb.v1.SetResponse.old_value)
-}
-inline void SetResponse::set_old_value(const char* value,
-    size_t size) {
-  
-  old_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:statedb.v1.SetResponse.old_value)
-}
-inline std::string* SetResponse::_internal_mutable_old_value() {
-  
-  return old_value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::statedb::v1::Fea& GetResponse::_internal_ins_key() const {
+  const ::statedb::v1::Fea* p = ins_key_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
+      &::statedb::v1::_Fea_default_instance_);
 }
-inline std::string* SetResponse::release_old_value() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.old_value)
-  return old_value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::statedb::v1::Fea& GetResponse::ins_key() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.ins_key)
+  return _internal_ins_key();
 }
-inline void SetResponse::set_allocated_old_value(std::string* old_value) {
-  if (old_value != nullptr) {
+inline void GetResponse::unsafe_arena_set_allocated_ins_key(
+    ::statedb::v1::Fea* ins_key) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(ins_key_);
+  }
+  ins_key_ = ins_key;
+  if (ins_key) {
     
   } else {
     
   }
-  old_value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), old_value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.old_value)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetResponse.ins_key)
 }
-inline std::string* SetResponse::unsafe_arena_release_old_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.SetResponse.old_value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline ::statedb::v1::Fea* GetResponse::release_ins_key() {
+  auto temp = unsafe_arena_release_ins_key();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::statedb::v1::Fea* GetResponse::unsafe_arena_release_ins_key() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetResponse.ins_key)
   
-  return old_value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  ::statedb::v1::Fea* temp = ins_key_;
+  ins_key_ = nullptr;
+  return temp;
 }
-inline void SetResponse::unsafe_arena_set_allocated_old_value(
-    std::string* old_value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (old_value != nullptr) {
+inline ::statedb::v1::Fea* GetResponse::_internal_mutable_ins_key() {
+  
+  if (ins_key_ == nullptr) {
+    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
+    ins_key_ = p;
+  }
+  return ins_key_;
+}
+inline ::statedb::v1::Fea* GetResponse::mutable_ins_key() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetResponse.ins_key)
+  return _internal_mutable_ins_key();
+}
+inline void GetResponse::set_allocated_ins_key(::statedb::v1::Fea* ins_key) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete ins_key_;
+  }
+  if (ins_key) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(ins_key);
+    if (message_arena != submessage_arena) {
+      ins_key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ins_key, submessage_arena);
+    }
     
   } else {
     
   }
-  old_value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      old_value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.old_value)
+  ins_key_ = ins_key;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetResponse.ins_key)
 }
 
-// string new_value = 9;
-inline void SetResponse::clear_new_value() {
-  new_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// string ins_value = 5;
+inline void GetResponse::clear_ins_value() {
+  ins_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& SetResponse::new_value() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.new_value)
-  return _internal_new_value();
+inline const std::string& GetResponse::ins_value() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.ins_value)
+  return _internal_ins_value();
 }
-inline void SetResponse::set_new_value(const std::string& value) {
-  _internal_set_new_value(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.SetResponse.new_value)
+inline void GetResponse::set_ins_value(const std::string& value) {
+  _internal_set_ins_value(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.GetResponse.ins_value)
 }
-inline std::string* SetResponse::mutable_new_value() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.new_value)
-  return _internal_mutable_new_value();
+inline std::string* GetResponse::mutable_ins_value() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetResponse.ins_value)
+  return _internal_mutable_ins_value();
 }
-inline const std::string& SetResponse::_internal_new_value() const {
-  return new_value_.Get();
+inline const std::string& GetResponse::_internal_ins_value() const {
+  return ins_value_.Get();
 }
-inline void SetResponse::_internal_set_new_value(const std::string& value) {
+inline void GetResponse::_internal_set_ins_value(const std::string& value) {
   
-  new_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void SetResponse::set_new_value(std::string&& value) {
+inline void GetResponse::set_ins_value(std::string&& value) {
   
-  new_value_.Set(
+  ins_value_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.SetResponse.new_value)
+  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.GetResponse.ins_value)
 }
-inline void SetResponse::set_new_value(const char* value) {
+inline void GetResponse::set_ins_value(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  new_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:statedb.v1.SetResponse.new_value)
+  // @@protoc_insertion_point(field_set_char:statedb.v1.GetResponse.ins_value)
 }
-inline void SetResponse::set_new_value(const char* value,
+inline void GetResponse::set_ins_value(const char* value,
     size_t size) {
   
-  new_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:statedb.v1.SetResponse.new_value)
+  // @@protoc_insertion_point(field_set_pointer:statedb.v1.GetResponse.ins_value)
 }
-inline std::string* SetResponse::_internal_mutable_new_value() {
+inline std::string* GetResponse::_internal_mutable_ins_value() {
   
-  return new_value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return ins_value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* SetResponse::release_new_value() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.new_value)
-  return new_value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* GetResponse::release_ins_value() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetResponse.ins_value)
+  return ins_value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void SetResponse::set_allocated_new_value(std::string* new_value) {
-  if (new_value != nullptr) {
+inline void GetResponse::set_allocated_ins_value(std::string* ins_value) {
+  if (ins_value != nullptr) {
     
   } else {
     
   }
-  new_value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), new_value,
+  ins_value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ins_value,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.new_value)
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetResponse.ins_value)
 }
-inline std::string* SetResponse::unsafe_arena_release_new_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.SetResponse.new_value)
+inline std::string* GetResponse::unsafe_arena_release_ins_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.GetResponse.ins_value)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
-  return new_value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  return ins_value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void SetResponse::unsafe_arena_set_allocated_new_value(
-    std::string* new_value) {
+inline void GetResponse::unsafe_arena_set_allocated_ins_value(
+    std::string* ins_value) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (new_value != nullptr) {
+  if (ins_value != nullptr) {
     
   } else {
     
   }
-  new_value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      new_value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.new_value)
+  ins_value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ins_value, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetResponse.ins_value)
 }
 
-// string mode = 10;
-inline void SetResponse::clear_mode() {
-  mode_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// bool is_old0 = 6;
+inline void GetResponse::clear_is_old0() {
+  is_old0_ = false;
 }
-inline const std::string& SetResponse::mode() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.mode)
-  return _internal_mode();
+inline bool GetResponse::_internal_is_old0() const {
+  return is_old0_;
 }
-inline void SetResponse::set_mode(const std::string& value) {
-  _internal_set_mode(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.SetResponse.mode)
+inline bool GetResponse::is_old0() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.is_old0)
+  return _internal_is_old0();
 }
-inline std::string* SetResponse::mutable_mode() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.mode)
-  return _internal_mutable_mode();
+inline void GetResponse::_internal_set_is_old0(bool value) {
+  
+  is_old0_ = value;
 }
-inline const std::string& SetResponse::_internal_mode() const {
-  return mode_.Get();
+inline void GetResponse::set_is_old0(bool value) {
+  _internal_set_is_old0(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.GetResponse.is_old0)
 }
-inline void SetResponse::_internal_set_mode(const std::string& value) {
+
+// string value = 7;
+inline void GetResponse::clear_value() {
+  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& GetResponse::value() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.value)
+  return _internal_value();
+}
+inline void GetResponse::set_value(const std::string& value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.GetResponse.value)
+}
+inline std::string* GetResponse::mutable_value() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetResponse.value)
+  return _internal_mutable_value();
+}
+inline const std::string& GetResponse::_internal_value() const {
+  return value_.Get();
+}
+inline void GetResponse::_internal_set_value(const std::string& value) {
   
-  mode_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void SetResponse::set_mode(std::string&& value) {
+inline void GetResponse::set_value(std::string&& value) {
   
-  mode_.Set(
+  value_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.SetResponse.mode)
+  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.GetResponse.value)
 }
-inline void SetResponse::set_mode(const char* value) {
+inline void GetResponse::set_value(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  mode_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:statedb.v1.SetResponse.mode)
+  // @@protoc_insertion_point(field_set_char:statedb.v1.GetResponse.value)
 }
-inline void SetResponse::set_mode(const char* value,
+inline void GetResponse::set_value(const char* value,
     size_t size) {
   
-  mode_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:statedb.v1.SetResponse.mode)
+  // @@protoc_insertion_point(field_set_pointer:statedb.v1.GetResponse.value)
 }
-inline std::string* SetResponse::_internal_mutable_mode() {
+inline std::string* GetResponse::_internal_mutable_value() {
   
-  return mode_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* SetResponse::release_mode() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.mode)
-  return mode_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* GetResponse::release_value() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetResponse.value)
+  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void SetResponse::set_allocated_mode(std::string* mode) {
-  if (mode != nullptr) {
+inline void GetResponse::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
     
   } else {
     
   }
-  mode_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), mode,
+  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.mode)
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetResponse.value)
 }
-inline std::string* SetResponse::unsafe_arena_release_mode() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.SetResponse.mode)
+inline std::string* GetResponse::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.GetResponse.value)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
-  return mode_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void SetResponse::unsafe_arena_set_allocated_mode(
-    std::string* mode) {
+inline void GetResponse::unsafe_arena_set_allocated_value(
+    std::string* value) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (mode != nullptr) {
+  if (value != nullptr) {
     
   } else {
     
   }
-  mode_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      mode, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.mode)
+  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      value, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetResponse.value)
 }
 
-// uint64 proof_hash_counter = 11;
-inline void SetResponse::clear_proof_hash_counter() {
+// uint64 proof_hash_counter = 8;
+inline void GetResponse::clear_proof_hash_counter() {
   proof_hash_counter_ = PROTOBUF_ULONGLONG(0);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 SetResponse::_internal_proof_hash_counter() const {
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetResponse::_internal_proof_hash_counter() const {
   return proof_hash_counter_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 SetResponse::proof_hash_counter() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.proof_hash_counter)
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetResponse::proof_hash_counter() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.proof_hash_counter)
   return _internal_proof_hash_counter();
 }
-inline void SetResponse::_internal_set_proof_hash_counter(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void GetResponse::_internal_set_proof_hash_counter(::PROTOBUF_NAMESPACE_ID::uint64 value) {
   
   proof_hash_counter_ = value;
 }
-inline void SetResponse::set_proof_hash_counter(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void GetResponse::set_proof_hash_counter(::PROTOBUF_NAMESPACE_ID::uint64 value) {
   _internal_set_proof_hash_counter(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.SetResponse.proof_hash_counter)
+  // @@protoc_insertion_point(field_set:statedb.v1.GetResponse.proof_hash_counter)
 }
 
-// .statedb.v1.ResultCode result = 12;
-inline bool SetResponse::_internal_has_result() const {
+// .statedb.v1.ResultCode result = 9;
+inline bool GetResponse::_internal_has_result() const {
   return this != internal_default_instance() && result_ != nullptr;
 }
-inline bool SetResponse::has_result() const {
+inline bool GetResponse::has_result() const {
   return _internal_has_result();
 }
-inline void SetResponse::clear_result() {
+inline void GetResponse::clear_result() {
   if (GetArena() == nullptr && result_ != nullptr) {
     delete result_;
   }
   result_ = nullptr;
 }
-inline const ::statedb::v1::ResultCode& SetResponse::_internal_result() const {
+inline const ::statedb::v1::ResultCode& GetResponse::_internal_result() const {
   const ::statedb::v1::ResultCode* p = result_;
   return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::ResultCode*>(
       &::statedb::v1::_ResultCode_default_instance_);
 }
-inline const ::statedb::v1::ResultCode& SetResponse::result() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetResponse.result)
+inline const ::statedb::v1::ResultCode& GetResponse::result() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.result)
   return _internal_result();
 }
-inline void SetResponse::unsafe_arena_set_allocated_result(
+inline void GetResponse::unsafe_arena_set_allocated_result(
     ::statedb::v1::ResultCode* result) {
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
@@ -4183,23 +5396,23 @@ inline void SetResponse::unsafe_arena_set_allocated_result(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetResponse.result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetResponse.result)
 }
-inline ::statedb::v1::ResultCode* SetResponse::release_result() {
+inline ::statedb::v1::ResultCode* GetResponse::release_result() {
   auto temp = unsafe_arena_release_result();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::statedb::v1::ResultCode* SetResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetResponse.result)
+inline ::statedb::v1::ResultCode* GetResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetResponse.result)
   
   ::statedb::v1::ResultCode* temp = result_;
   result_ = nullptr;
   return temp;
 }
-inline ::statedb::v1::ResultCode* SetResponse::_internal_mutable_result() {
+inline ::statedb::v1::ResultCode* GetResponse::_internal_mutable_result() {
   
   if (result_ == nullptr) {
     auto* p = CreateMaybeMessage<::statedb::v1::ResultCode>(GetArena());
@@ -4207,11 +5420,11 @@ inline ::statedb::v1::ResultCode* SetResponse::_internal_mutable_result() {
   }
   return result_;
 }
-inline ::statedb::v1::ResultCode* SetResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetResponse.result)
+inline ::statedb::v1::ResultCode* GetResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetResponse.result)
   return _internal_mutable_result();
 }
-inline void SetResponse::set_allocated_result(::statedb::v1::ResultCode* result) {
+inline void GetResponse::set_allocated_result(::statedb::v1::ResultCode* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
     delete result_;
@@ -4228,597 +5441,612 @@ inline void SetResponse::set_allocated_result(::statedb::v1::ResultCode* result)
     
   }
   result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetResponse.result)
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetResponse.result)
 }
 
 // -------------------------------------------------------------------
 
-// -------------------------------------------------------------------
-
-// GetResponse
+// SetProgramResponse
 
-// .statedb.v1.Fea root = 1;
-inline bool GetResponse::_internal_has_root() const {
-  return this != internal_default_instance() && root_ != nullptr;
+// .statedb.v1.ResultCode result = 1;
+inline bool SetProgramResponse::_internal_has_result() const {
+  return this != internal_default_instance() && result_ != nullptr;
 }
-inline bool GetResponse::has_root() const {
-  return _internal_has_root();
+inline bool SetProgramResponse::has_result() const {
+  return _internal_has_result();
 }
-inline void GetResponse::clear_root() {
-  if (GetArena() == nullptr && root_ != nullptr) {
-    delete root_;
+inline void SetProgramResponse::clear_result() {
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
   }
-  root_ = nullptr;
+  result_ = nullptr;
 }
-inline const ::statedb::v1::Fea& GetResponse::_internal_root() const {
-  const ::statedb::v1::Fea* p = root_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
-      &::statedb::v1::_Fea_default_instance_);
+inline const ::statedb::v1::ResultCode& SetProgramResponse::_internal_result() const {
+  const ::statedb::v1::ResultCode* p = result_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::ResultCode*>(
+      &::statedb::v1::_ResultCode_default_instance_);
 }
-inline const ::statedb::v1::Fea& GetResponse::root() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.root)
-  return _internal_root();
+inline const ::statedb::v1::ResultCode& SetProgramResponse::result() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SetProgramResponse.result)
+  return _internal_result();
 }
-inline void GetResponse::unsafe_arena_set_allocated_root(
-    ::statedb::v1::Fea* root) {
+inline void SetProgramResponse::unsafe_arena_set_allocated_result(
+    ::statedb::v1::ResultCode* result) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(root_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
   }
-  root_ = root;
-  if (root) {
+  result_ = result;
+  if (result) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetResponse.root)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetProgramResponse.result)
 }
-inline ::statedb::v1::Fea* GetResponse::release_root() {
-  auto temp = unsafe_arena_release_root();
+inline ::statedb::v1::ResultCode* SetProgramResponse::release_result() {
+  auto temp = unsafe_arena_release_result();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::statedb::v1::Fea* GetResponse::unsafe_arena_release_root() {
-  // @@protoc_insertion_point(field_release:statedb.v1.GetResponse.root)
+inline ::statedb::v1::ResultCode* SetProgramResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:statedb.v1.SetProgramResponse.result)
   
-  ::statedb::v1::Fea* temp = root_;
-  root_ = nullptr;
+  ::statedb::v1::ResultCode* temp = result_;
+  result_ = nullptr;
   return temp;
 }
-inline ::statedb::v1::Fea* GetResponse::_internal_mutable_root() {
+inline ::statedb::v1::ResultCode* SetProgramResponse::_internal_mutable_result() {
   
-  if (root_ == nullptr) {
-    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
-    root_ = p;
+  if (result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::statedb::v1::ResultCode>(GetArena());
+    result_ = p;
   }
-  return root_;
+  return result_;
 }
-inline ::statedb::v1::Fea* GetResponse::mutable_root() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.GetResponse.root)
-  return _internal_mutable_root();
+inline ::statedb::v1::ResultCode* SetProgramResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.SetProgramResponse.result)
+  return _internal_mutable_result();
 }
-inline void GetResponse::set_allocated_root(::statedb::v1::Fea* root) {
+inline void SetProgramResponse::set_allocated_result(::statedb::v1::ResultCode* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete root_;
+    delete result_;
   }
-  if (root) {
+  if (result) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(root);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
     if (message_arena != submessage_arena) {
-      root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, root, submessage_arena);
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
     }
     
   } else {
     
   }
-  root_ = root;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetResponse.root)
+  result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetProgramResponse.result)
 }
 
-// .statedb.v1.Fea key = 2;
-inline bool GetResponse::_internal_has_key() const {
-  return this != internal_default_instance() && key_ != nullptr;
+// -------------------------------------------------------------------
+
+// GetProgramResponse
+
+// bytes data = 1;
+inline void GetProgramResponse::clear_data() {
+  data_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline bool GetResponse::has_key() const {
-  return _internal_has_key();
+inline const std::string& GetProgramResponse::data() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetProgramResponse.data)
+  return _internal_data();
 }
-inline void GetResponse::clear_key() {
-  if (GetArena() == nullptr && key_ != nullptr) {
-    delete key_;
+inline void GetProgramResponse::set_data(const std::string& value) {
+  _internal_set_data(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.GetProgramResponse.data)
+}
+inline std::string* GetProgramResponse::mutable_data() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetProgramResponse.data)
+  return _internal_mutable_data();
+}
+inline const std::string& GetProgramResponse::_internal_data() const {
+  return data_.Get();
+}
+inline void GetProgramResponse::_internal_set_data(const std::string& value) {
+  
+  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void GetProgramResponse::set_data(std::string&& value) {
+  
+  data_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.GetProgramResponse.data)
+}
+inline void GetProgramResponse::set_data(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:statedb.v1.GetProgramResponse.data)
+}
+inline void GetProgramResponse::set_data(const void* value,
+    size_t size) {
+  
+  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:statedb.v1.GetProgramResponse.data)
+}
+inline std::string* GetProgramResponse::_internal_mutable_data() {
+  
+  return data_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* GetProgramResponse::release_data() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetProgramResponse.data)
+  return data_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void GetProgramResponse::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
   }
-  key_ = nullptr;
+  data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetProgramResponse.data)
 }
-inline const ::statedb::v1::Fea& GetResponse::_internal_key() const {
-  const ::statedb::v1::Fea* p = key_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
-      &::statedb::v1::_Fea_default_instance_);
+inline std::string* GetProgramResponse::unsafe_arena_release_data() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.GetProgramResponse.data)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return data_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void GetProgramResponse::unsafe_arena_set_allocated_data(
+    std::string* data) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  data_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      data, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetProgramResponse.data)
+}
+
+// .statedb.v1.ResultCode result = 2;
+inline bool GetProgramResponse::_internal_has_result() const {
+  return this != internal_default_instance() && result_ != nullptr;
+}
+inline bool GetProgramResponse::has_result() const {
+  return _internal_has_result();
+}
+inline void GetProgramResponse::clear_result() {
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
 }
-inline const ::statedb::v1::Fea& GetResponse::key() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.key)
-  return _internal_key();
+inline const ::statedb::v1::ResultCode& GetProgramResponse::_internal_result() const {
+  const ::statedb::v1::ResultCode* p = result_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::ResultCode*>(
+      &::statedb::v1::_ResultCode_default_instance_);
 }
-inline void GetResponse::unsafe_arena_set_allocated_key(
-    ::statedb::v1::Fea* key) {
+inline const ::statedb::v1::ResultCode& GetProgramResponse::result() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetProgramResponse.result)
+  return _internal_result();
+}
+inline void GetProgramResponse::unsafe_arena_set_allocated_result(
+    ::statedb::v1::ResultCode* result) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
   }
-  key_ = key;
-  if (key) {
+  result_ = result;
+  if (result) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetResponse.key)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetProgramResponse.result)
 }
-inline ::statedb::v1::Fea* GetResponse::release_key() {
-  auto temp = unsafe_arena_release_key();
+inline ::statedb::v1::ResultCode* GetProgramResponse::release_result() {
+  auto temp = unsafe_arena_release_result();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::statedb::v1::Fea* GetResponse::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_release:statedb.v1.GetResponse.key)
+inline ::statedb::v1::ResultCode* GetProgramResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetProgramResponse.result)
   
-  ::statedb::v1::Fea* temp = key_;
-  key_ = nullptr;
+  ::statedb::v1::ResultCode* temp = result_;
+  result_ = nullptr;
   return temp;
 }
-inline ::statedb::v1::Fea* GetResponse::_internal_mutable_key() {
+inline ::statedb::v1::ResultCode* GetProgramResponse::_internal_mutable_result() {
   
-  if (key_ == nullptr) {
-    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
-    key_ = p;
+  if (result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::statedb::v1::ResultCode>(GetArena());
+    result_ = p;
   }
-  return key_;
+  return result_;
 }
-inline ::statedb::v1::Fea* GetResponse::mutable_key() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.GetResponse.key)
-  return _internal_mutable_key();
+inline ::statedb::v1::ResultCode* GetProgramResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetProgramResponse.result)
+  return _internal_mutable_result();
 }
-inline void GetResponse::set_allocated_key(::statedb::v1::Fea* key) {
+inline void GetProgramResponse::set_allocated_result(::statedb::v1::ResultCode* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete key_;
+    delete result_;
   }
-  if (key) {
+  if (result) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(key);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
     if (message_arena != submessage_arena) {
-      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, key, submessage_arena);
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
     }
     
   } else {
     
   }
-  key_ = key;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetResponse.key)
+  result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetProgramResponse.result)
 }
 
-// map<uint64, .statedb.v1.SiblingList> siblings = 3;
-inline int GetResponse::_internal_siblings_size() const {
-  return siblings_.size();
+// -------------------------------------------------------------------
+
+// Fea
+
+// uint64 fe0 = 1;
+inline void Fea::clear_fe0() {
+  fe0_ = PROTOBUF_ULONGLONG(0);
 }
-inline int GetResponse::siblings_size() const {
-  return _internal_siblings_size();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe0() const {
+  return fe0_;
 }
-inline void GetResponse::clear_siblings() {
-  siblings_.Clear();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe0() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.Fea.fe0)
+  return _internal_fe0();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::statedb::v1::SiblingList >&
-GetResponse::_internal_siblings() const {
-  return siblings_.GetMap();
+inline void Fea::_internal_set_fe0(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe0_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::statedb::v1::SiblingList >&
-GetResponse::siblings() const {
-  // @@protoc_insertion_point(field_map:statedb.v1.GetResponse.siblings)
-  return _internal_siblings();
+inline void Fea::set_fe0(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe0(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.Fea.fe0)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::statedb::v1::SiblingList >*
-GetResponse::_internal_mutable_siblings() {
-  return siblings_.MutableMap();
+
+// uint64 fe1 = 2;
+inline void Fea::clear_fe1() {
+  fe1_ = PROTOBUF_ULONGLONG(0);
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::statedb::v1::SiblingList >*
-GetResponse::mutable_siblings() {
-  // @@protoc_insertion_point(field_mutable_map:statedb.v1.GetResponse.siblings)
-  return _internal_mutable_siblings();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe1() const {
+  return fe1_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe1() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.Fea.fe1)
+  return _internal_fe1();
+}
+inline void Fea::_internal_set_fe1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe1_ = value;
+}
+inline void Fea::set_fe1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe1(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.Fea.fe1)
 }
 
-// .statedb.v1.Fea ins_key = 4;
-inline bool GetResponse::_internal_has_ins_key() const {
-  return this != internal_default_instance() && ins_key_ != nullptr;
+// uint64 fe2 = 3;
+inline void Fea::clear_fe2() {
+  fe2_ = PROTOBUF_ULONGLONG(0);
 }
-inline bool GetResponse::has_ins_key() const {
-  return _internal_has_ins_key();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe2() const {
+  return fe2_;
 }
-inline void GetResponse::clear_ins_key() {
-  if (GetArena() == nullptr && ins_key_ != nullptr) {
-    delete ins_key_;
-  }
-  ins_key_ = nullptr;
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe2() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.Fea.fe2)
+  return _internal_fe2();
 }
-inline const ::statedb::v1::Fea& GetResponse::_internal_ins_key() const {
-  const ::statedb::v1::Fea* p = ins_key_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::Fea*>(
-      &::statedb::v1::_Fea_default_instance_);
+inline void Fea::_internal_set_fe2(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe2_ = value;
 }
-inline const ::statedb::v1::Fea& GetResponse::ins_key() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.ins_key)
-  return _internal_ins_key();
+inline void Fea::set_fe2(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe2(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.Fea.fe2)
 }
-inline void GetResponse::unsafe_arena_set_allocated_ins_key(
-    ::statedb::v1::Fea* ins_key) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(ins_key_);
-  }
-  ins_key_ = ins_key;
-  if (ins_key) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetResponse.ins_key)
+
+// uint64 fe3 = 4;
+inline void Fea::clear_fe3() {
+  fe3_ = PROTOBUF_ULONGLONG(0);
 }
-inline ::statedb::v1::Fea* GetResponse::release_ins_key() {
-  auto temp = unsafe_arena_release_ins_key();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe3() const {
+  return fe3_;
 }
-inline ::statedb::v1::Fea* GetResponse::unsafe_arena_release_ins_key() {
-  // @@protoc_insertion_point(field_release:statedb.v1.GetResponse.ins_key)
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe3() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.Fea.fe3)
+  return _internal_fe3();
+}
+inline void Fea::_internal_set_fe3(::PROTOBUF_NAMESPACE_ID::uint64 value) {
   
-  ::statedb::v1::Fea* temp = ins_key_;
-  ins_key_ = nullptr;
-  return temp;
+  fe3_ = value;
+}
+inline void Fea::set_fe3(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe3(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.Fea.fe3)
+}
+
+// -------------------------------------------------------------------
+
+// SiblingList
+
+// repeated uint64 sibling = 1;
+inline int SiblingList::_internal_sibling_size() const {
+  return sibling_.size();
+}
+inline int SiblingList::sibling_size() const {
+  return _internal_sibling_size();
+}
+inline void SiblingList::clear_sibling() {
+  sibling_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 SiblingList::_internal_sibling(int index) const {
+  return sibling_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 SiblingList::sibling(int index) const {
+  // @@protoc_insertion_point(field_get:statedb.v1.SiblingList.sibling)
+  return _internal_sibling(index);
+}
+inline void SiblingList::set_sibling(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  sibling_.Set(index, value);
+  // @@protoc_insertion_point(field_set:statedb.v1.SiblingList.sibling)
+}
+inline void SiblingList::_internal_add_sibling(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  sibling_.Add(value);
+}
+inline void SiblingList::add_sibling(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_sibling(value);
+  // @@protoc_insertion_point(field_add:statedb.v1.SiblingList.sibling)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+SiblingList::_internal_sibling() const {
+  return sibling_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+SiblingList::sibling() const {
+  // @@protoc_insertion_point(field_list:statedb.v1.SiblingList.sibling)
+  return _internal_sibling();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+SiblingList::_internal_mutable_sibling() {
+  return &sibling_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+SiblingList::mutable_sibling() {
+  // @@protoc_insertion_point(field_mutable_list:statedb.v1.SiblingList.sibling)
+  return _internal_mutable_sibling();
+}
+
+// -------------------------------------------------------------------
+
+// ResultCode
+
+// .statedb.v1.ResultCode.Code code = 1;
+inline void ResultCode::clear_code() {
+  code_ = 0;
+}
+inline ::statedb::v1::ResultCode_Code ResultCode::_internal_code() const {
+  return static_cast< ::statedb::v1::ResultCode_Code >(code_);
 }
-inline ::statedb::v1::Fea* GetResponse::_internal_mutable_ins_key() {
-  
-  if (ins_key_ == nullptr) {
-    auto* p = CreateMaybeMessage<::statedb::v1::Fea>(GetArena());
-    ins_key_ = p;
-  }
-  return ins_key_;
+inline ::statedb::v1::ResultCode_Code ResultCode::code() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.ResultCode.code)
+  return _internal_code();
 }
-inline ::statedb::v1::Fea* GetResponse::mutable_ins_key() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.GetResponse.ins_key)
-  return _internal_mutable_ins_key();
+inline void ResultCode::_internal_set_code(::statedb::v1::ResultCode_Code value) {
+  
+  code_ = value;
 }
-inline void GetResponse::set_allocated_ins_key(::statedb::v1::Fea* ins_key) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete ins_key_;
-  }
-  if (ins_key) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(ins_key);
-    if (message_arena != submessage_arena) {
-      ins_key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, ins_key, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  ins_key_ = ins_key;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetResponse.ins_key)
+inline void ResultCode::set_code(::statedb::v1::ResultCode_Code value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.ResultCode.code)
 }
 
-// string ins_value = 5;
-inline void GetResponse::clear_ins_value() {
-  ins_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// -------------------------------------------------------------------
+
+// GetNodesRequest
+
+// bytes keys = 1;
+inline void GetNodesRequest::clear_keys() {
+  keys_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& GetResponse::ins_value() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.ins_value)
-  return _internal_ins_value();
+inline const std::string& GetNodesRequest::keys() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetNodesRequest.keys)
+  return _internal_keys();
 }
-inline void GetResponse::set_ins_value(const std::string& value) {
-  _internal_set_ins_value(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.GetResponse.ins_value)
+inline void GetNodesRequest::set_keys(const std::string& value) {
+  _internal_set_keys(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.GetNodesRequest.keys)
 }
-inline std::string* GetResponse::mutable_ins_value() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.GetResponse.ins_value)
-  return _internal_mutable_ins_value();
+inline std::string* GetNodesRequest::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetNodesRequest.keys)
+  return _internal_mutable_keys();
 }
-inline const std::string& GetResponse::_internal_ins_value() const {
-  return ins_value_.Get();
+inline const std::string& GetNodesRequest::_internal_keys() const {
+  return keys_.Get();
 }
-inline void GetResponse::_internal_set_ins_value(const std::string& value) {
+inline void GetNodesRequest::_internal_set_keys(const std::string& value) {
   
-  ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  keys_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void GetResponse::set_ins_value(std::string&& value) {
+inline void GetNodesRequest::set_keys(std::string&& value) {
   
-  ins_value_.Set(
+  keys_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.GetResponse.ins_value)
+  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.GetNodesRequest.keys)
 }
-inline void GetResponse::set_ins_value(const char* value) {
+inline void GetNodesRequest::set_keys(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  keys_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:statedb.v1.GetResponse.ins_value)
+  // @@protoc_insertion_point(field_set_char:statedb.v1.GetNodesRequest.keys)
 }
-inline void GetResponse::set_ins_value(const char* value,
+inline void GetNodesRequest::set_keys(const void* value,
     size_t size) {
   
-  ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  keys_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:statedb.v1.GetResponse.ins_value)
+  // @@protoc_insertion_point(field_set_pointer:statedb.v1.GetNodesRequest.keys)
 }
-inline std::string* GetResponse::_internal_mutable_ins_value() {
+inline std::string* GetNodesRequest::_internal_mutable_keys() {
   
-  return ins_value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return keys_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* GetResponse::release_ins_value() {
-  // @@protoc_insertion_point(field_release:statedb.v1.GetResponse.ins_value)
-  return ins_value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* GetNodesRequest::release_keys() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetNodesRequest.keys)
+  return keys_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void GetResponse::set_allocated_ins_value(std::string* ins_value) {
-  if (ins_value != nullptr) {
+inline void GetNodesRequest::set_allocated_keys(std::string* keys) {
+  if (keys != nullptr) {
     
   } else {
     
   }
-  ins_value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ins_value,
+  keys_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), keys,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetResponse.ins_value)
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetNodesRequest.keys)
 }
-inline std::string* GetResponse::unsafe_arena_release_ins_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.GetResponse.ins_value)
+inline std::string* GetNodesRequest::unsafe_arena_release_keys() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.GetNodesRequest.keys)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
-  return ins_value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  return keys_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void GetResponse::unsafe_arena_set_allocated_ins_value(
-    std::string* ins_value) {
+inline void GetNodesRequest::unsafe_arena_set_allocated_keys(
+    std::string* keys) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (ins_value != nullptr) {
+  if (keys != nullptr) {
     
   } else {
     
   }
-  ins_value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ins_value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetResponse.ins_value)
+  keys_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      keys, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetNodesRequest.keys)
 }
 
-// bool is_old0 = 6;
-inline void GetResponse::clear_is_old0() {
-  is_old0_ = false;
-}
-inline bool GetResponse::_internal_is_old0() const {
-  return is_old0_;
-}
-inline bool GetResponse::is_old0() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.is_old0)
-  return _internal_is_old0();
-}
-inline void GetResponse::_internal_set_is_old0(bool value) {
-  
-  is_old0_ = value;
-}
-inline void GetResponse::set_is_old0(bool value) {
-  _internal_set_is_old0(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.GetResponse.is_old0)
-}
+// -------------------------------------------------------------------
 
-// string value = 7;
-inline void GetResponse::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// GetNodesResponse
+
+// bytes nodes = 1;
+inline void GetNodesResponse::clear_nodes() {
+  nodes_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& GetResponse::value() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.value)
-  return _internal_value();
+inline const std::string& GetNodesResponse::nodes() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetNodesResponse.nodes)
+  return _internal_nodes();
 }
-inline void GetResponse::set_value(const std::string& value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.GetResponse.value)
+inline void GetNodesResponse::set_nodes(const std::string& value) {
+  _internal_set_nodes(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.GetNodesResponse.nodes)
 }
-inline std::string* GetResponse::mutable_value() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.GetResponse.value)
-  return _internal_mutable_value();
+inline std::string* GetNodesResponse::mutable_nodes() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetNodesResponse.nodes)
+  return _internal_mutable_nodes();
 }
-inline const std::string& GetResponse::_internal_value() const {
-  return value_.Get();
+inline const std::string& GetNodesResponse::_internal_nodes() const {
+  return nodes_.Get();
 }
-inline void GetResponse::_internal_set_value(const std::string& value) {
+inline void GetNodesResponse::_internal_set_nodes(const std::string& value) {
   
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  nodes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void GetResponse::set_value(std::string&& value) {
+inline void GetNodesResponse::set_nodes(std::string&& value) {
   
-  value_.Set(
+  nodes_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.GetResponse.value)
+  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.GetNodesResponse.nodes)
 }
-inline void GetResponse::set_value(const char* value) {
+inline void GetNodesResponse::set_nodes(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  nodes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:statedb.v1.GetResponse.value)
+  // @@protoc_insertion_point(field_set_char:statedb.v1.GetNodesResponse.nodes)
 }
-inline void GetResponse::set_value(const char* value,
+inline void GetNodesResponse::set_nodes(const void* value,
     size_t size) {
   
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  nodes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:statedb.v1.GetResponse.value)
+  // @@protoc_insertion_point(field_set_pointer:statedb.v1.GetNodesResponse.nodes)
 }
-inline std::string* GetResponse::_internal_mutable_value() {
+inline std::string* GetNodesResponse::_internal_mutable_nodes() {
   
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return nodes_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* GetResponse::release_value() {
-  // @@protoc_insertion_point(field_release:statedb.v1.GetResponse.value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* GetNodesResponse::release_nodes() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetNodesResponse.nodes)
+  return nodes_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void GetResponse::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
+inline void GetNodesResponse::set_allocated_nodes(std::string* nodes) {
+  if (nodes != nullptr) {
     
   } else {
     
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
+  nodes_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nodes,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetResponse.value)
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetNodesResponse.nodes)
 }
-inline std::string* GetResponse::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.GetResponse.value)
+inline std::string* GetNodesResponse::unsafe_arena_release_nodes() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.GetNodesResponse.nodes)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  return nodes_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void GetResponse::unsafe_arena_set_allocated_value(
-    std::string* value) {
+inline void GetNodesResponse::unsafe_arena_set_allocated_nodes(
+    std::string* nodes) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
-    
-  } else {
-    
-  }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetResponse.value)
-}
-
-// uint64 proof_hash_counter = 8;
-inline void GetResponse::clear_proof_hash_counter() {
-  proof_hash_counter_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetResponse::_internal_proof_hash_counter() const {
-  return proof_hash_counter_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetResponse::proof_hash_counter() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.proof_hash_counter)
-  return _internal_proof_hash_counter();
-}
-inline void GetResponse::_internal_set_proof_hash_counter(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  proof_hash_counter_ = value;
-}
-inline void GetResponse::set_proof_hash_counter(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_proof_hash_counter(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.GetResponse.proof_hash_counter)
-}
-
-// .statedb.v1.ResultCode result = 9;
-inline bool GetResponse::_internal_has_result() const {
-  return this != internal_default_instance() && result_ != nullptr;
-}
-inline bool GetResponse::has_result() const {
-  return _internal_has_result();
-}
-inline void GetResponse::clear_result() {
-  if (GetArena() == nullptr && result_ != nullptr) {
-    delete result_;
-  }
-  result_ = nullptr;
-}
-inline const ::statedb::v1::ResultCode& GetResponse::_internal_result() const {
-  const ::statedb::v1::ResultCode* p = result_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::ResultCode*>(
-      &::statedb::v1::_ResultCode_default_instance_);
-}
-inline const ::statedb::v1::ResultCode& GetResponse::result() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetResponse.result)
-  return _internal_result();
-}
-inline void GetResponse::unsafe_arena_set_allocated_result(
-    ::statedb::v1::ResultCode* result) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
-  }
-  result_ = result;
-  if (result) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetResponse.result)
-}
-inline ::statedb::v1::ResultCode* GetResponse::release_result() {
-  auto temp = unsafe_arena_release_result();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
-}
-inline ::statedb::v1::ResultCode* GetResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:statedb.v1.GetResponse.result)
-  
-  ::statedb::v1::ResultCode* temp = result_;
-  result_ = nullptr;
-  return temp;
-}
-inline ::statedb::v1::ResultCode* GetResponse::_internal_mutable_result() {
-  
-  if (result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::statedb::v1::ResultCode>(GetArena());
-    result_ = p;
-  }
-  return result_;
-}
-inline ::statedb::v1::ResultCode* GetResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.GetResponse.result)
-  return _internal_mutable_result();
-}
-inline void GetResponse::set_allocated_result(::statedb::v1::ResultCode* result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete result_;
-  }
-  if (result) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
-    if (message_arena != submessage_arena) {
-      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, result, submessage_arena);
-    }
+  if (nodes != nullptr) {
     
   } else {
     
-  }
-  result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetResponse.result)
-}
-
-// -------------------------------------------------------------------
-
-// SetProgramResponse
+  }
+  nodes_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      nodes, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetNodesResponse.nodes)
+}
 
-// .statedb.v1.ResultCode result = 1;
-inline bool SetProgramResponse::_internal_has_result() const {
+// .statedb.v1.ResultCode result = 2;
+inline bool GetNodesResponse::_internal_has_result() const {
   return this != internal_default_instance() && result_ != nullptr;
 }
-inline bool SetProgramResponse::has_result() const {
+inline bool GetNodesResponse::has_result() const {
   return _internal_has_result();
 }
-inline void SetProgramResponse::clear_result() {
+inline void GetNodesResponse::clear_result() {
   if (GetArena() == nullptr && result_ != nullptr) {
     delete result_;
   }
   result_ = nullptr;
 }
-inline const ::statedb::v1::ResultCode& SetProgramResponse::_internal_result() const {
+inline const ::statedb::v1::ResultCode& GetNodesResponse::_internal_result() const {
   const ::statedb::v1::ResultCode* p = result_;
   return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::ResultCode*>(
       &::statedb::v1::_ResultCode_default_instance_);
 }
-inline const ::statedb::v1::ResultCode& SetProgramResponse::result() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SetProgramResponse.result)
+inline const ::statedb::v1::ResultCode& GetNodesResponse::result() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.GetNodesResponse.result)
   return _internal_result();
 }
-inline void SetProgramResponse::unsafe_arena_set_allocated_result(
+inline void GetNodesResponse::unsafe_arena_set_allocated_result(
     ::statedb::v1::ResultCode* result) {
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
@@ -4829,23 +6057,23 @@ inline void SetProgramResponse::unsafe_arena_set_allocated_result(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.SetProgramResponse.result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetNodesResponse.result)
 }
-inline ::statedb::v1::ResultCode* SetProgramResponse::release_result() {
+inline ::statedb::v1::ResultCode* GetNodesResponse::release_result() {
   auto temp = unsafe_arena_release_result();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::statedb::v1::ResultCode* SetProgramResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:statedb.v1.SetProgramResponse.result)
+inline ::statedb::v1::ResultCode* GetNodesResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:statedb.v1.GetNodesResponse.result)
   
   ::statedb::v1::ResultCode* temp = result_;
   result_ = nullptr;
   return temp;
 }
-inline ::statedb::v1::ResultCode* SetProgramResponse::_internal_mutable_result() {
+inline ::statedb::v1::ResultCode* GetNodesResponse::_internal_mutable_result() {
   
   if (result_ == nullptr) {
     auto* p = CreateMaybeMessage<::statedb::v1::ResultCode>(GetArena());
@@ -4853,11 +6081,11 @@ inline ::statedb::v1::ResultCode* SetProgramResponse::_internal_mutable_result()
   }
   return result_;
 }
-inline ::statedb::v1::ResultCode* SetProgramResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.SetProgramResponse.result)
+inline ::statedb::v1::ResultCode* GetNodesResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.GetNodesResponse.result)
   return _internal_mutable_result();
 }
-inline void SetProgramResponse::set_allocated_result(::statedb::v1::ResultCode* result) {
+inline void GetNodesResponse::set_allocated_result(::statedb::v1::ResultCode* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
     delete result_;
@@ -4874,117 +6102,141 @@ inline void SetProgramResponse::set_allocated_result(::statedb::v1::ResultCode*
     
   }
   result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.SetProgramResponse.result)
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetNodesResponse.result)
 }
 
 // -------------------------------------------------------------------
 
-// GetProgramResponse
+// PutNodesRequest
 
-// bytes data = 1;
-inline void GetProgramResponse::clear_data() {
-  data_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// bytes nodes = 1;
+inline void PutNodesRequest::clear_nodes() {
+  nodes_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& GetProgramResponse::data() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetProgramResponse.data)
-  return _internal_data();
+inline const std::string& PutNodesRequest::nodes() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.PutNodesRequest.nodes)
+  return _internal_nodes();
 }
-inline void GetProgramResponse::set_data(const std::string& value) {
-  _internal_set_data(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.GetProgramResponse.data)
+inline void PutNodesRequest::set_nodes(const std::string& value) {
+  _internal_set_nodes(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.PutNodesRequest.nodes)
 }
-inline std::string* GetProgramResponse::mutable_data() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.GetProgramResponse.data)
-  return _internal_mutable_data();
+inline std::string* PutNodesRequest::mutable_nodes() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.PutNodesRequest.nodes)
+  return _internal_mutable_nodes();
 }
-inline const std::string& GetProgramResponse::_internal_data() const {
-  return data_.Get();
+inline const std::string& PutNodesRequest::_internal_nodes() const {
+  return nodes_.Get();
 }
-inline void GetProgramResponse::_internal_set_data(const std::string& value) {
+inline void PutNodesRequest::_internal_set_nodes(const std::string& value) {
   
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  nodes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void GetProgramResponse::set_data(std::string&& value) {
+inline void PutNodesRequest::set_nodes(std::string&& value) {
   
-  data_.Set(
+  nodes_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.GetProgramResponse.data)
+  // @@protoc_insertion_point(field_set_rvalue:statedb.v1.PutNodesRequest.nodes)
 }
-inline void GetProgramResponse::set_data(const char* value) {
+inline void PutNodesRequest::set_nodes(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  nodes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:statedb.v1.GetProgramResponse.data)
+  // @@protoc_insertion_point(field_set_char:statedb.v1.PutNodesRequest.nodes)
 }
-inline void GetProgramResponse::set_data(const void* value,
+inline void PutNodesRequest::set_nodes(const void* value,
     size_t size) {
   
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  nodes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:statedb.v1.GetProgramResponse.data)
+  // @@protoc_insertion_point(field_set_pointer:statedb.v1.PutNodesRequest.nodes)
 }
-inline std::string* GetProgramResponse::_internal_mutable_data() {
+inline std::string* PutNodesRequest::_internal_mutable_nodes() {
   
-  return data_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return nodes_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* GetProgramResponse::release_data() {
-  // @@protoc_insertion_point(field_release:statedb.v1.GetProgramResponse.data)
-  return data_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* PutNodesRequest::release_nodes() {
+  // @@protoc_insertion_point(field_release:statedb.v1.PutNodesRequest.nodes)
+  return nodes_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void GetProgramResponse::set_allocated_data(std::string* data) {
-  if (data != nullptr) {
+inline void PutNodesRequest::set_allocated_nodes(std::string* nodes) {
+  if (nodes != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data,
+  nodes_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nodes,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetProgramResponse.data)
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.PutNodesRequest.nodes)
 }
-inline std::string* GetProgramResponse::unsafe_arena_release_data() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.GetProgramResponse.data)
+inline std::string* PutNodesRequest::unsafe_arena_release_nodes() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:statedb.v1.PutNodesRequest.nodes)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
-  return data_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  return nodes_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void GetProgramResponse::unsafe_arena_set_allocated_data(
-    std::string* data) {
+inline void PutNodesRequest::unsafe_arena_set_allocated_nodes(
+    std::string* nodes) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (data != nullptr) {
+  if (nodes != nullptr) {
     
   } else {
     
   }
-  data_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      data, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetProgramResponse.data)
+  nodes_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      nodes, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.PutNodesRequest.nodes)
 }
 
-// .statedb.v1.ResultCode result = 2;
-inline bool GetProgramResponse::_internal_has_result() const {
+// bool persistent = 2;
+inline void PutNodesRequest::clear_persistent() {
+  persistent_ = false;
+}
+inline bool PutNodesRequest::_internal_persistent() const {
+  return persistent_;
+}
+inline bool PutNodesRequest::persistent() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.PutNodesRequest.persistent)
+  return _internal_persistent();
+}
+inline void PutNodesRequest::_internal_set_persistent(bool value) {
+  
+  persistent_ = value;
+}
+inline void PutNodesRequest::set_persistent(bool value) {
+  _internal_set_persistent(value);
+  // @@protoc_insertion_point(field_set:statedb.v1.PutNodesRequest.persistent)
+}
+
+// -------------------------------------------------------------------
+
+// PutNodesResponse
+
+// .statedb.v1.ResultCode result = 1;
+inline bool PutNodesResponse::_internal_has_result() const {
   return this != internal_default_instance() && result_ != nullptr;
 }
-inline bool GetProgramResponse::has_result() const {
+inline bool PutNodesResponse::has_result() const {
   return _internal_has_result();
 }
-inline void GetProgramResponse::clear_result() {
+inline void PutNodesResponse::clear_result() {
   if (GetArena() == nullptr && result_ != nullptr) {
     delete result_;
   }
   result_ = nullptr;
 }
-inline const ::statedb::v1::ResultCode& GetProgramResponse::_internal_result() const {
+inline const ::statedb::v1::ResultCode& PutNodesResponse::_internal_result() const {
   const ::statedb::v1::ResultCode* p = result_;
   return p != nullptr ? *p : *reinterpret_cast<const ::statedb::v1::ResultCode*>(
       &::statedb::v1::_ResultCode_default_instance_);
 }
-inline const ::statedb::v1::ResultCode& GetProgramResponse::result() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.GetProgramResponse.result)
+inline const ::statedb::v1::ResultCode& PutNodesResponse::result() const {
+  // @@protoc_insertion_point(field_get:statedb.v1.PutNodesResponse.result)
   return _internal_result();
 }
-inline void GetProgramResponse::unsafe_arena_set_allocated_result(
+inline void PutNodesResponse::unsafe_arena_set_allocated_result(
     ::statedb::v1::ResultCode* result) {
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
@@ -4995,23 +6247,23 @@ inline void GetProgramResponse::unsafe_arena_set_allocated_result(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.GetProgramResponse.result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:statedb.v1.PutNodesResponse.result)
 }
-inline ::statedb::v1::ResultCode* GetProgramResponse::release_result() {
+inline ::statedb::v1::ResultCode* PutNodesResponse::release_result() {
   auto temp = unsafe_arena_release_result();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::statedb::v1::ResultCode* GetProgramResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:statedb.v1.GetProgramResponse.result)
+inline ::statedb::v1::ResultCode* PutNodesResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:statedb.v1.PutNodesResponse.result)
   
   ::statedb::v1::ResultCode* temp = result_;
   result_ = nullptr;
   return temp;
 }
-inline ::statedb::v1::ResultCode* GetProgramResponse::_internal_mutable_result() {
+inline ::statedb::v1::ResultCode* PutNodesResponse::_internal_mutable_result() {
   
   if (result_ == nullptr) {
     auto* p = CreateMaybeMessage<::statedb::v1::ResultCode>(GetArena());
@@ -5019,11 +6271,11 @@ inline ::statedb::v1::ResultCode* GetProgramResponse::_internal_mutable_result()
   }
   return result_;
 }
-inline ::statedb::v1::ResultCode* GetProgramResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:statedb.v1.GetProgramResponse.result)
+inline ::statedb::v1::ResultCode* PutNodesResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:statedb.v1.PutNodesResponse.result)
   return _internal_mutable_result();
 }
-inline void GetProgramResponse::set_allocated_result(::statedb::v1::ResultCode* result) {
+inline void PutNodesResponse::set_allocated_result(::statedb::v1::ResultCode* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
     delete result_;
@@ -5040,171 +6292,20 @@ inline void GetProgramResponse::set_allocated_result(::statedb::v1::ResultCode*
     
   }
   result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:statedb.v1.GetProgramResponse.result)
+  // @@protoc_insertion_point(field_set_allocated:statedb.v1.PutNodesResponse.result)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
 // -------------------------------------------------------------------
 
-// Fea
-
-// uint64 fe0 = 1;
-inline void Fea::clear_fe0() {
-  fe0_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe0() const {
-  return fe0_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe0() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.Fea.fe0)
-  return _internal_fe0();
-}
-inline void Fea::_internal_set_fe0(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  fe0_ = value;
-}
-inline void Fea::set_fe0(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe0(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.Fea.fe0)
-}
-
-// uint64 fe1 = 2;
-inline void Fea::clear_fe1() {
-  fe1_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe1() const {
-  return fe1_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe1() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.Fea.fe1)
-  return _internal_fe1();
-}
-inline void Fea::_internal_set_fe1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  fe1_ = value;
-}
-inline void Fea::set_fe1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe1(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.Fea.fe1)
-}
-
-// uint64 fe2 = 3;
-inline void Fea::clear_fe2() {
-  fe2_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe2() const {
-  return fe2_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe2() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.Fea.fe2)
-  return _internal_fe2();
-}
-inline void Fea::_internal_set_fe2(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  fe2_ = value;
-}
-inline void Fea::set_fe2(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe2(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.Fea.fe2)
-}
-
-// uint64 fe3 = 4;
-inline void Fea::clear_fe3() {
-  fe3_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe3() const {
-  return fe3_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe3() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.Fea.fe3)
-  return _internal_fe3();
-}
-inline void Fea::_internal_set_fe3(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  fe3_ = value;
-}
-inline void Fea::set_fe3(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe3(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.Fea.fe3)
-}
-
 // -------------------------------------------------------------------
 
-// SiblingList
-
-// repeated uint64 sibling = 1;
-inline int SiblingList::_internal_sibling_size() const {
-  return sibling_.size();
-}
-inline int SiblingList::sibling_size() const {
-  return _internal_sibling_size();
-}
-inline void SiblingList::clear_sibling() {
-  sibling_.Clear();
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 SiblingList::_internal_sibling(int index) const {
-  return sibling_.Get(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 SiblingList::sibling(int index) const {
-  // @@protoc_insertion_point(field_get:statedb.v1.SiblingList.sibling)
-  return _internal_sibling(index);
-}
-inline void SiblingList::set_sibling(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  sibling_.Set(index, value);
-  // @@protoc_insertion_point(field_set:statedb.v1.SiblingList.sibling)
-}
-inline void SiblingList::_internal_add_sibling(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  sibling_.Add(value);
-}
-inline void SiblingList::add_sibling(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_add_sibling(value);
-  // @@protoc_insertion_point(field_add:statedb.v1.SiblingList.sibling)
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
-SiblingList::_internal_sibling() const {
-  return sibling_;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
-SiblingList::sibling() const {
-  // @@protoc_insertion_point(field_list:statedb.v1.SiblingList.sibling)
-  return _internal_sibling();
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
-SiblingList::_internal_mutable_sibling() {
-  return &sibling_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
-SiblingList::mutable_sibling() {
-  // @@protoc_insertion_point(field_mutable_list:statedb.v1.SiblingList.sibling)
-  return _internal_mutable_sibling();
-}
-
 // -------------------------------------------------------------------
 
-// ResultCode
-
-// .statedb.v1.ResultCode.Code code = 1;
-inline void ResultCode::clear_code() {
-  code_ = 0;
-}
-inline ::statedb::v1::ResultCode_Code ResultCode::_internal_code() const {
-  return static_cast< ::statedb::v1::ResultCode_Code >(code_);
-}
-inline ::statedb::v1::ResultCode_Code ResultCode::code() const {
-  // @@protoc_insertion_point(field_get:statedb.v1.ResultCode.code)
-  return _internal_code();
-}
-inline void ResultCode::_internal_set_code(::statedb::v1::ResultCode_Code value) {
-  
-  code_ = value;
-}
-inline void ResultCode::set_code(::statedb::v1::ResultCode_Code value) {
-  _internal_set_code(value);
-  // @@protoc_insertion_point(field_set:statedb.v1.ResultCode.code)
-}
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -367,6 +367,7 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_zk_2dprover_2eproto::offsets[]
   PROTOBUF_FIELD_OFFSET(::zkprover::v1::GetStatusResponse, version_proto_),
   PROTOBUF_FIELD_OFFSET(::zkprover::v1::GetStatusResponse, version_server_),
   PROTOBUF_FIELD_OFFSET(::zkprover::v1::GetStatusResponse, pending_request_queue_ids_),
+  PROTOBUF_FIELD_OFFSET(::zkprover::v1::GetStatusResponse, metrics_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::zkprover::v1::GenProofResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -460,16 +461,16 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 17, -1, sizeof(::zkprover::v1::CancelRequest)},
   { 23, -1, sizeof(::zkprover::v1::GetProofRequest)},
   { 30, -1, sizeof(::zkprover::v1::GetStatusResponse)},
-  { 43, -1, sizeof(::zkprover::v1::GenProofResponse)},
-  { 50, -1, sizeof(::zkprover::v1::CancelResponse)},
-  { 56, -1, sizeof(::zkprover::v1::GetProofResponse)},
-  { 66, -1, sizeof(::zkprover::v1::PublicInputs)},
-  { 79, -1, sizeof(::zkprover::v1::ProofB)},
-  { 85, -1, sizeof(::zkprover::v1::Proof)},
-  { 93, 100, sizeof(::zkprover::v1::InputProver_DbEntry_DoNotUse)},
-  { 102, 109, sizeof(::zkprover::v1::InputProver_ContractsBytecodeEntry_DoNotUse)},
-  { 111, -1, sizeof(::zkprover::v1::InputProver)},
-  { 121, -1, sizeof(::zkprover::v1::PublicInputsExtended)},
+  { 44, -1, sizeof(::zkprover::v1::GenProofResponse)},
+  { 51, -1, sizeof(::zkprover::v1::CancelResponse)},
+  { 57, -1, sizeof(::zkprover::v1::GetProofResponse)},
+  { 67, -1, sizeof(::zkprover::v1::PublicInputs)},
+  { 80, -1, sizeof(::zkprover::v1::ProofB)},
+  { 86, -1, sizeof(::zkprover::v1::Proof)},
+  { 94, 101, sizeof(::zkprover::v1::InputProver_DbEntry_DoNotUse)},
+  { 103, 110, sizeof(::zkprover::v1::InputProver_ContractsBytecodeEntry_DoNotUse)},
+  { 112, -1, sizeof(::zkprover::v1::InputProver)},
+  { 122, -1, sizeof(::zkprover::v1::PublicInputsExtended)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -497,7 +498,7 @@ const char descriptor_table_protodef_zk_2dprover_2eproto[] PROTOBUF_SECTION_VARI
   "\017GenProofRequest\022\'\n\005input\030\001 \001(\0132\030.zkprov"
   "er.v1.InputProver\"\033\n\rCancelRequest\022\n\n\002id"
   "\030\001 \001(\t\".\n\017GetProofRequest\022\n\n\002id\030\001 \001(\t\022\017\n"
-  "\007timeout\030\002 \001(\004\"\307\003\n\021GetStatusResponse\022:\n\005"
+  "\007timeout\030\002 \001(\004\"\330\003\n\021GetStatusResponse\022:\n\005"
   "state\030\001 \001(\0162+.zkprover.v1.GetStatusRespo"
   "nse.StatusProver\022 \n\030last_computed_reques"
   "t_id\030\002 \001(\t\022\036\n\026last_computed_end_time\030\003 \001"
@@ -505,59 +506,59 @@ const char descriptor_table_protodef_zk_2dprover_2eproto[] PROTOBUF_SECTION_VARI
   "\022$\n\034current_computing_start_time\030\005 \001(\004\022\025"
   "\n\rversion_proto\030\006 \001(\t\022\026\n\016version_server\030"
   "\007 \001(\t\022!\n\031pending_request_queue_ids\030\010 \003(\t"
-  "\"\225\001\n\014StatusProver\022\035\n\031STATUS_PROVER_UNSPE"
-  "CIFIED\020\000\022\031\n\025STATUS_PROVER_BOOTING\020\001\022\033\n\027S"
-  "TATUS_PROVER_COMPUTING\020\002\022\026\n\022STATUS_PROVE"
-  "R_IDLE\020\003\022\026\n\022STATUS_PROVER_HALT\020\004\"\353\001\n\020Gen"
-  "ProofResponse\022\n\n\002id\030\001 \001(\t\022<\n\006result\030\002 \001("
-  "\0162,.zkprover.v1.GenProofResponse.ResultG"
-  "enProof\"\214\001\n\016ResultGenProof\022 \n\034RESULT_GEN"
-  "_PROOF_UNSPECIFIED\020\000\022\027\n\023RESULT_GEN_PROOF"
-  "_OK\020\001\022\032\n\026RESULT_GEN_PROOF_ERROR\020\002\022#\n\037RES"
-  "ULT_GEN_PROOF_INTERNAL_ERROR\020\003\"\250\001\n\016Cance"
-  "lResponse\0228\n\006result\030\001 \001(\0162(.zkprover.v1."
-  "CancelResponse.ResultCancel\"\\\n\014ResultCan"
-  "cel\022\035\n\031RESULT_CANCEL_UNSPECIFIED\020\000\022\024\n\020RE"
-  "SULT_CANCEL_OK\020\001\022\027\n\023RESULT_CANCEL_ERROR\020"
-  "\002\"\303\003\n\020GetProofResponse\022\n\n\002id\030\001 \001(\t\022!\n\005pr"
-  "oof\030\002 \001(\0132\022.zkprover.v1.Proof\0221\n\006public\030"
-  "\003 \001(\0132!.zkprover.v1.PublicInputsExtended"
-  "\022<\n\006result\030\004 \001(\0162,.zkprover.v1.GetProofR"
-  "esponse.ResultGetProof\022\025\n\rresult_string\030"
-  "\005 \001(\t\"\367\001\n\016ResultGetProof\022 \n\034RESULT_GET_P"
-  "ROOF_UNSPECIFIED\020\000\022!\n\035RESULT_GET_PROOF_C"
-  "OMPLETED_OK\020\001\022\032\n\026RESULT_GET_PROOF_ERROR\020"
-  "\002\022$\n RESULT_GET_PROOF_COMPLETED_ERROR\020\003\022"
-  "\034\n\030RESULT_GET_PROOF_PENDING\020\004\022#\n\037RESULT_"
-  "GET_PROOF_INTERNAL_ERROR\020\005\022\033\n\027RESULT_GET"
-  "_PROOF_CANCEL\020\006\"\323\001\n\014PublicInputs\022\026\n\016old_"
-  "state_root\030\001 \001(\t\022\033\n\023old_local_exit_root\030"
-  "\002 \001(\t\022\026\n\016new_state_root\030\003 \001(\t\022\033\n\023new_loc"
-  "al_exit_root\030\004 \001(\t\022\026\n\016sequencer_addr\030\005 \001"
-  "(\t\022\027\n\017batch_hash_data\030\006 \001(\t\022\021\n\tbatch_num"
-  "\030\007 \001(\r\022\025\n\reth_timestamp\030\010 \001(\004\"\030\n\006ProofB\022"
-  "\016\n\006proofs\030\001 \003(\t\"O\n\005Proof\022\017\n\007proof_a\030\001 \003("
-  "\t\022$\n\007proof_b\030\002 \003(\0132\023.zkprover.v1.ProofB\022"
-  "\017\n\007proof_c\030\003 \003(\t\"\320\002\n\013InputProver\0220\n\rpubl"
-  "ic_inputs\030\001 \001(\0132\031.zkprover.v1.PublicInpu"
-  "ts\022\030\n\020global_exit_root\030\002 \001(\t\022\025\n\rbatch_l2"
-  "_data\030\003 \001(\t\022,\n\002db\030\004 \003(\0132 .zkprover.v1.In"
-  "putProver.DbEntry\022K\n\022contracts_bytecode\030"
-  "\005 \003(\0132/.zkprover.v1.InputProver.Contract"
-  "sBytecodeEntry\032)\n\007DbEntry\022\013\n\003key\030\001 \001(\t\022\r"
-  "\n\005value\030\002 \001(\t:\0028\001\0328\n\026ContractsBytecodeEn"
-  "try\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"\\\n\024P"
-  "ublicInputsExtended\0220\n\rpublic_inputs\030\001 \001"
-  "(\0132\031.zkprover.v1.PublicInputs\022\022\n\ninput_h"
-  "ash\030\002 \001(\t2\276\002\n\017ZKProverService\022L\n\tGetStat"
-  "us\022\035.zkprover.v1.GetStatusRequest\032\036.zkpr"
-  "over.v1.GetStatusResponse\"\000\022I\n\010GenProof\022"
-  "\034.zkprover.v1.GenProofRequest\032\035.zkprover"
-  ".v1.GenProofResponse\"\000\022C\n\006Cancel\022\032.zkpro"
-  "ver.v1.CancelRequest\032\033.zkprover.v1.Cance"
-  "lResponse\"\000\022M\n\010GetProof\022\034.zkprover.v1.Ge"
-  "tProofRequest\032\035.zkprover.v1.GetProofResp"
-  "onse\"\000(\0010\001b\006proto3"
+  "\022\017\n\007metrics\030\t \001(\t\"\225\001\n\014StatusProver\022\035\n\031ST"
+  "ATUS_PROVER_UNSPECIFIED\020\000\022\031\n\025STATUS_PROV"
+  "ER_BOOTING\020\001\022\033\n\027STATUS_PROVER_COMPUTING\020"
+  "\002\022\026\n\022STATUS_PROVER_IDLE\020\003\022\026\n\022STATUS_PROV"
+  "ER_HALT\020\004\"\353\001\n\020GenProofResponse\022\n\n\002id\030\001 \001"
+  "(\t\022<\n\006result\030\002 \001(\0162,.zkprover.v1.GenProo"
+  "fResponse.ResultGenProof\"\214\001\n\016ResultGenPr"
+  "oof\022 \n\034RESULT_GEN_PROOF_UNSPECIFIED\020\000\022\027\n"
+  "\023RESULT_GEN_PROOF_OK\020\001\022\032\n\026RESULT_GEN_PRO"
+  "OF_ERROR\020\002\022#\n\037RESULT_GEN_PROOF_INTERNAL_"
+  "ERROR\020\003\"\250\001\n\016CancelResponse\0228\n\006result\030\001 \001"
+  "(\0162(.zkprover.v1.CancelResponse.ResultCa"
+  "ncel\"\\\n\014ResultCancel\022\035\n\031RESULT_CANCEL_UN"
+  "SPECIFIED\020\000\022\024\n\020RESULT_CANCEL_OK\020\001\022\027\n\023RES"
+  "ULT_CANCEL_ERROR\020\002\"\303\003\n\020GetProofResponse\022"
+  "\n\n\002id\030\001 \001(\t\022!\n\005proof\030\002 \001(\0132\022.zkprover.v1"
+  ".Proof\0221\n\006public\030\003 \001(\0132!.zkprover.v1.Pub"
+  "licInputsExtended\022<\n\006result\030\004 \001(\0162,.zkpr"
+  "over.v1.GetProofResponse.ResultGetProof\022"
+  "\025\n\rresult_string\030\005 \001(\t\"\367\001\n\016ResultGetProo"
+  "f\022 \n\034RESULT_GET_PROOF_UNSPECIFIED\020\000\022!\n\035R"
+  "ESULT_GET_PROOF_COMPLETED_OK\020\001\022\032\n\026RESULT"
+  "_GET_PROOF_ERROR\020\002\022$\n RESULT_GET_PROOF_C"
+  "OMPLETED_ERROR\020\003\022\034\n\030RESULT_GET_PROOF_PEN"
+  "DING\020\004\022#\n\037RESULT_GET_PROOF_INTERNAL_ERRO"
+  "R\020\005\022\033\n\027RESULT_GET_PROOF_CANCEL\020\006\"\323\001\n\014Pub"
+  "licInputs\022\026\n\016old_state_root\030\001 \001(\t\022\033\n\023old"
+  "_local_exit_root\030\002 \001(\t\022\026\n\016new_state_root"
+  "\030\003 \001(\t\022\033\n\023new_local_exit_root\030\004 \001(\t\022\026\n\016s"
+  "equencer_addr\030\005 \001(\t\022\027\n\017batch_hash_data\030\006"
+  " \001(\t\022\021\n\tbatch_num\030\007 \001(\r\022\025\n\reth_timestamp"
+  "\030\010 \001(\004\"\030\n\006ProofB\022\016\n\006proofs\030\001 \003(\t\"O\n\005Proo"
+  "f\022\017\n\007proof_a\030\001 \003(\t\022$\n\007proof_b\030\002 \003(\0132\023.zk"
+  "prover.v1.ProofB\022\017\n\007proof_c\030\003 \003(\t\"\320\002\n\013In"
+  "putProver\0220\n\rpublic_inputs\030\001 \001(\0132\031.zkpro"
+  "ver.v1.PublicInputs\022\030\n\020global_exit_root\030"
+  "\002 \001(\t\022\025\n\rbatch_l2_data\030\003 \001(\t\022,\n\002db\030\004 \003(\013"
+  "2 .zkprover.v1.InputProver.DbEntry\022K\n\022co"
+  "ntracts_bytecode\030\005 \003(\0132/.zkprover.v1.Inp"
+  "utProver.ContractsBytecodeEntry\032)\n\007DbEnt"
+  "ry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\0328\n\026Co"
+  "ntractsBytecodeEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005val"
+  "ue\030\002 \001(\t:\0028\001\"\\\n\024PublicInputsExtended\0220\n\r"
+  "public_inputs\030\001 \001(\0132\031.zkprover.v1.Public"
+  "Inputs\022\022\n\ninput_hash\030\002 \001(\t2\276\002\n\017ZKProverS"
+  "ervice\022L\n\tGetStatus\022\035.zkprover.v1.GetSta"
+  "tusRequest\032\036.zkprover.v1.GetStatusRespon"
+  "se\"\000\022I\n\010GenProof\022\034.zkprover.v1.GenProofR"
+  "equest\032\035.zkprover.v1.GenProofResponse\"\000\022"
+  "C\n\006Cancel\022\032.zkprover.v1.CancelRequest\032\033."
+  "zkprover.v1.CancelResponse\"\000\022M\n\010GetProof"
+  "\022\034.zkprover.v1.GetProofRequest\032\035.zkprove"
+  "r.v1.GetProofResponse\"\000(\0010\001b\006proto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_zk_2dprover_2eproto_deps[1] = {
 };
@@ -581,7 +582,7 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_zk_
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_zk_2dprover_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_zk_2dprover_2eproto = {
-  false, false, descriptor_table_protodef_zk_2dprover_2eproto, "zk-prover.proto", 2618,
+  false, false, descriptor_table_protodef_zk_2dprover_2eproto, "zk-prover.proto", 2635,
   &descriptor_table_zk_2dprover_2eproto_once, descriptor_table_zk_2dprover_2eproto_sccs, descriptor_table_zk_2dprover_2eproto_deps, 16, 0,
   schemas, file_default_instances, TableStruct_zk_2dprover_2eproto::offsets,
   file_level_metadata_zk_2dprover_2eproto, 16, file_level_enum_descriptors_zk_2dprover_2eproto, file_level_service_descriptors_zk_2dprover_2eproto,
@@ -1771,6 +1772,11 @@ GetStatusResponse::GetStatusResponse(const GetStatusResponse& from)
     version_server_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_version_server(),
       GetArena());
   }
+  metrics_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_metrics().empty()) {
+    metrics_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_metrics(),
+      GetArena());
+  }
   ::memcpy(&last_computed_end_time_, &from.last_computed_end_time_,
     static_cast<size_t>(reinterpret_cast<char*>(&state_) -
     reinterpret_cast<char*>(&last_computed_end_time_)) + sizeof(state_));
@@ -1783,6 +1789,7 @@ void GetStatusResponse::SharedCtor() {
   current_computing_request_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   version_proto_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   version_server_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  metrics_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   ::memset(&last_computed_end_time_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&state_) -
       reinterpret_cast<char*>(&last_computed_end_time_)) + sizeof(state_));
@@ -1800,6 +1807,7 @@ void GetStatusResponse::SharedDtor() {
   current_computing_request_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   version_proto_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   version_server_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  metrics_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
 void GetStatusResponse::ArenaDtor(void* object) {
@@ -1828,6 +1836,7 @@ void GetStatusResponse::Clear() {
   current_computing_request_id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   version_proto_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   version_server_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  metrics_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   ::memset(&last_computed_end_time_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&state_) -
       reinterpret_cast<char*>(&last_computed_end_time_)) + sizeof(state_));
@@ -1914,6 +1923,15 @@ const char* GetStatusResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESP
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
         } else goto handle_unusual;
         continue;
+      // string metrics = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          auto str = _internal_mutable_metrics();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "zkprover.v1.GetStatusResponse.metrics"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -2011,6 +2029,16 @@ failure:
     target = stream->WriteString(8, s, target);
   }
 
+  // string metrics = 9;
+  if (this->metrics().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_metrics().data(), static_cast<int>(this->_internal_metrics().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "zkprover.v1.GetStatusResponse.metrics");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_metrics(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2063,6 +2091,13 @@ size_t GetStatusResponse::ByteSizeLong() const {
         this->_internal_version_server());
   }
 
+  // string metrics = 9;
+  if (this->metrics().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_metrics());
+  }
+
   // uint64 last_computed_end_time = 3;
   if (this->last_computed_end_time() != 0) {
     total_size += 1 +
@@ -2127,6 +2162,9 @@ void GetStatusResponse::MergeFrom(const GetStatusResponse& from) {
   if (from.version_server().size() > 0) {
     _internal_set_version_server(from._internal_version_server());
   }
+  if (from.metrics().size() > 0) {
+    _internal_set_metrics(from._internal_metrics());
+  }
   if (from.last_computed_end_time() != 0) {
     _internal_set_last_computed_end_time(from._internal_last_computed_end_time());
   }
@@ -2164,6 +2202,7 @@ void GetStatusResponse::InternalSwap(GetStatusResponse* other) {
   current_computing_request_id_.Swap(&other->current_computing_request_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   version_proto_.Swap(&other->version_proto_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   version_server_.Swap(&other->version_server_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  metrics_.Swap(&other->metrics_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(GetStatusResponse, state_)
       + sizeof(GetStatusResponse::state_)
@@ -1138,6 +1138,7 @@ class GetStatusResponse PROTOBUF_FINAL :
     kCurrentComputingRequestIdFieldNumber = 4,
     kVersionProtoFieldNumber = 6,
     kVersionServerFieldNumber = 7,
+    kMetricsFieldNumber = 9,
     kLastComputedEndTimeFieldNumber = 3,
     kCurrentComputingStartTimeFieldNumber = 5,
     kStateFieldNumber = 1,
@@ -1265,6 +1266,30 @@ class GetStatusResponse PROTOBUF_FINAL :
   void _internal_set_version_server(const std::string& value);
   std::string* _internal_mutable_version_server();
   public:
+  // string metrics = 9;
+  void clear_metrics();
+  const std::string& metrics() const;
+  void set_metrics(const std::string& value);
+  void set_metrics(std::string&& value);
+  void set_metrics(const char* value);
+  void set_metrics(const char* value, size_t size);
+  std::string* mutable_metrics();
+  std::string* release_metrics();
+  void set_allocated_metrics(std::string* metrics);
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  std::string* unsafe_arena_release_metrics();
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  void unsafe_arena_set_allocated_metrics(
+      std::string* metrics);
+  private:
+  const std::string& _internal_metrics() const;
+  void _internal_set_metrics(const std::string& value);
+  std::string* _internal_mutable_metrics();
+  public:
 
   // uint64 last_computed_end_time = 3;
   void clear_last_computed_end_time();
@@ -1305,6 +1330,7 @@ class GetStatusResponse PROTOBUF_FINAL :
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr current_computing_request_id_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_proto_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_server_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr metrics_;
   ::PROTOBUF_NAMESPACE_ID::uint64 last_computed_end_time_;
   ::PROTOBUF_NAMESPACE_ID::uint64 current_computing_start_time_;
   int state_;
@@ -3858,6 +3884,87 @@ inline void GetStatusResponse::unsafe_arena_set_allocated_version_server(
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:zkprover.v1.GetStatusResponse.version_server)
 }
 
+// string metrics = 9;
+inline void GetStatusResponse::clear_metrics() {
+  metrics_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& GetStatusResponse::metrics() const {
+  // @@protoc_insertion_point(field_get:zkprover.v1.GetStatusResponse.metrics)
+  return _internal_metrics();
+}
+inline void GetStatusResponse::set_metrics(const std::string& value) {
+  _internal_set_metrics(value);
+  // @@protoc_insertion_point(field_set:zkprover.v1.GetStatusResponse.metrics)
+}
+inline std::string* GetStatusResponse::mutable_metrics() {
+  // @@protoc_insertion_point(field_mutable:zkprover.v1.GetStatusResponse.metrics)
+  return _internal_mutable_metrics();
+}
+inline const std::string& GetStatusResponse::_internal_metrics() const {
+  return metrics_.Get();
+}
+inline void GetStatusResponse::_internal_set_metrics(const std::string& value) {
+  
+  metrics_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void GetStatusResponse::set_metrics(std::string&& value) {
+  
+  metrics_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:zkprover.v1.GetStatusResponse.metrics)
+}
+inline void GetStatusResponse::set_metrics(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  metrics_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:zkprover.v1.GetStatusResponse.metrics)
+}
+inline void GetStatusResponse::set_metrics(const char* value,
+    size_t size) {
+  
+  metrics_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:zkprover.v1.GetStatusResponse.metrics)
+}
+inline std::string* GetStatusResponse::_internal_mutable_metrics() {
+  
+  return metrics_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* GetStatusResponse::release_metrics() {
+  // @@protoc_insertion_point(field_release:zkprover.v1.GetStatusResponse.metrics)
+  return metrics_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void GetStatusResponse::set_allocated_metrics(std::string* metrics) {
+  if (metrics != nullptr) {
+    
+  } else {
+    
+  }
+  metrics_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), metrics,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:zkprover.v1.GetStatusResponse.metrics)
+}
+inline std::string* GetStatusResponse::unsafe_arena_release_metrics() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:zkprover.v1.GetStatusResponse.metrics)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return metrics_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void GetStatusResponse::unsafe_arena_set_allocated_metrics(
+    std::string* metrics) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (metrics != nullptr) {
+    
+  } else {
+    
+  }
+  metrics_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      metrics, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:zkprover.v1.GetStatusResponse.metrics)
+}
+
 // repeated string pending_request_queue_ids = 8;
 inline int GetStatusResponse::_internal_pending_request_queue_ids_size() const {
   return pending_request_queue_ids_.size();
@@ -19,12 +19,15 @@
 #include "service/prover/prover_client.hpp"
 #include "service/executor/executor_server.hpp"
 #include "service/executor/executor_client.hpp"
+#include "service/metrics/metrics_server.hpp"
 #include "sm/keccak_f/keccak.hpp"
 #include "sm/keccak_f/keccak_executor_test.hpp"
 #include "sm/storage/storage_executor.hpp"
 #include "sm/storage/storage_test.hpp"
 #include "sm/binary/binary_test.hpp"
 #include "sm/mem_align/mem_align_test.hpp"
+#include "sm/main/main_sm_test.hpp"
+#include "service/statedb/database_test.hpp"
 #include "starkpil/test/stark_test.hpp"
 #include "timer.hpp"
 #include "statedb/statedb_server.hpp"
@@ -131,6 +134,18 @@ int main(int argc, char **argv)
         MemAlignSMTest(fr, config);
     }
 
+    // Test Main SM
+    if ( config.runMainSMTest )
+    {
+        MainSMTest(fr, config);
+    }
+
+    // Test the StateDB database
+    if ( config.runDatabaseTest )
+    {
+        DatabaseTest(fr, config);
+    }
+
     // If there is nothing else to run, exit normally
     if (!config.runProverServer && !config.runProverServerMock && !config.runProverClient &&
         !config.runExecutorServer && !config.runExecutorClient &&
@@ -195,6 +210,14 @@ int main(int argc, char **argv)
         executorServer.runThread();
     }
 
+    // Create the metrics server and run it, if configured
+    MetricsServer metricsServer(config);
+    if (config.runMetricsServer)
+    {
+        cout << "Launching metrics server thread..." << endl;
+        metricsServer.runThread();
+    }
+
     /* FILE-BASED INPUT */
 
     // Generate a proof from the input file
@@ -311,6 +334,12 @@ int main(int argc, char **argv)
         stateDBServer.waitForThread();
     }
 
+    // Wait for the metrics server thread to end
+    if (config.runMetricsServer)
+    {
+        metricsServer.waitForThread();
+    }
+
     TimerStopAndLog(WHOLE_PROCESS);
 
     cout << "Done" << endl;
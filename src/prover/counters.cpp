@@ -0,0 +1,65 @@
+#include "counters.hpp"
+#include "sm/pols_generated/commit_pols.hpp"
+#include "sm/binary/binary_defines.hpp"
+
+bool Counters::exceeds (const Counters &limits, string &counterName) const
+{
+    if (arith > limits.arith)
+    {
+        counterName = "arith";
+        return true;
+    }
+    if (binary > limits.binary)
+    {
+        counterName = "binary";
+        return true;
+    }
+    if (memAlign > limits.memAlign)
+    {
+        counterName = "memAlign";
+        return true;
+    }
+    if (keccakF > limits.keccakF)
+    {
+        counterName = "keccakF";
+        return true;
+    }
+    if (poseidonG > limits.poseidonG)
+    {
+        counterName = "poseidonG";
+        return true;
+    }
+    if (paddingPG > limits.paddingPG)
+    {
+        counterName = "paddingPG";
+        return true;
+    }
+    if (steps > limits.steps)
+    {
+        counterName = "steps";
+        return true;
+    }
+    return false;
+}
+
+void getCountersLimits (Counters &limits)
+{
+    // Every arith and mem align operation uses 32 evaluations (see ArithExecutor and MemAlignExecutor)
+    limits.arith = ArithCommitPols::pilDegree() / 32;
+    limits.memAlign = MemAlignCommitPols::pilDegree() / 32;
+
+    // Every binary operation uses a latch of LATCH_SIZE evaluations (see BinaryExecutor)
+    limits.binary = BinaryCommitPols::pilDegree() / LATCH_SIZE;
+
+    // Every slot of 158418 evaluations hashes 9 keccak-f blocks in parallel (see PaddingKKExecutor)
+    limits.keccakF = 9 * (PaddingKKCommitPols::pilDegree() / 158418);
+
+    // Every poseidon hash uses nRoundsF + nRoundsP + 1 = 31 evaluations (see PoseidonGExecutor)
+    limits.poseidonG = PoseidonGCommitPols::pilDegree() / (8 + 22 + 1);
+
+    // Every padding poseidon block of 8 elements of 7 bytes uses one evaluation per byte (see PaddingPGExecutor)
+    limits.paddingPG = PaddingPGCommitPols::pilDegree() / (8 * 7);
+
+    // The main state machine must reach its last step before its last evaluation
+    limits.steps = MainCommitPols::pilDegree() - 1;
+}
@@ -2,6 +2,7 @@
 #define COUNTERS_HPP
 
 #include <stdint.h>
+#include <string>
 
 using namespace std;
 
@@ -23,6 +24,13 @@ public:
         poseidonG(0),
         paddingPG(0),
         steps(0) {};
+
+    // Returns true if any counter exceeds its limit, and the name of the first one that does
+    bool exceeds (const Counters &limits, string &counterName) const;
 };
 
+// Maximum value of every counter, i.e. the number of operations that fit in the committed
+// polynomials of its state machine, given their pilDegree() and the evaluations per operation
+void getCountersLimits (Counters &limits);
+
 #endif
\ No newline at end of file
@@ -44,8 +44,8 @@ void Input::loadGlobals (json &input)
         cerr << "Error: globalExitRoot key not found in input JSON file" << endl;
         exitProcess();
     }
-    globalExitRoot = input["globalExitRoot"];
-    cout << "loadGobals(): globalExitRoot=" << globalExitRoot << endl;
+    string2scalar(input["globalExitRoot"], globalExitRoot);
+    cout << "loadGobals(): globalExitRoot=" << globalExitRoot.get_str(16) << endl;
 
     // Input JSON file must contain a oldStateRoot key at the root level
     if ( !input.contains("oldStateRoot") ||
@@ -54,8 +54,8 @@ void Input::loadGlobals (json &input)
         cerr << "Error: oldStateRoot key not found in input JSON file" << endl;
         exitProcess();
     }
-    publicInputs.oldStateRoot = input["oldStateRoot"];
-    cout << "loadGobals(): oldStateRoot=" << publicInputs.oldStateRoot << endl;
+    string2scalar(input["oldStateRoot"], publicInputs.oldStateRoot);
+    cout << "loadGobals(): oldStateRoot=" << publicInputs.oldStateRoot.get_str(16) << endl;
 
     // Input JSON file must contain a newStateRoot key at the root level
     if ( !input.contains("newStateRoot") ||
@@ -64,8 +64,8 @@ void Input::loadGlobals (json &input)
         cerr << "Error: newStateRoot key not found in input JSON file" << endl;
         exitProcess();
     }
-    publicInputs.newStateRoot = input["newStateRoot"];
-    cout << "loadGobals(): newStateRoot=" << publicInputs.newStateRoot << endl;
+    string2scalar(input["newStateRoot"], publicInputs.newStateRoot);
+    cout << "loadGobals(): newStateRoot=" << publicInputs.newStateRoot.get_str(16) << endl;
 
     // Input JSON file must contain a oldLocalExitRoot key at the root level
     if ( !input.contains("oldLocalExitRoot") ||
@@ -74,8 +74,8 @@ void Input::loadGlobals (json &input)
         cerr << "Error: oldLocalExitRoot key not found in input JSON file" << endl;
         exitProcess();
     }
-    publicInputs.oldLocalExitRoot = input["oldLocalExitRoot"];
-    cout << "loadGobals(): oldLocalExitRoot=" << publicInputs.oldLocalExitRoot << endl;
+    string2scalar(input["oldLocalExitRoot"], publicInputs.oldLocalExitRoot);
+    cout << "loadGobals(): oldLocalExitRoot=" << publicInputs.oldLocalExitRoot.get_str(16) << endl;
 
     // Input JSON file must contain a newLocalExitRoot key at the root level
     if ( !input.contains("newLocalExitRoot") ||
@@ -84,8 +84,8 @@ void Input::loadGlobals (json &input)
         cerr << "Error: newLocalExitRoot key not found in input JSON file" << endl;
         exitProcess();
     }
-    publicInputs.newLocalExitRoot = input["newLocalExitRoot"];
-    cout << "loadGobals(): newLocalExitRoot=" << publicInputs.newLocalExitRoot << endl;
+    string2scalar(input["newLocalExitRoot"], publicInputs.newLocalExitRoot);
+    cout << "loadGobals(): newLocalExitRoot=" << publicInputs.newLocalExitRoot.get_str(16) << endl;
 
     // Input JSON file must contain a sequencerAddr key at the root level
     if ( !input.contains("sequencerAddr") ||
@@ -94,8 +94,8 @@ void Input::loadGlobals (json &input)
         cerr << "Error: sequencerAddr key not found in input JSON file" << endl;
         exitProcess();
     }
-    publicInputs.sequencerAddr = input["sequencerAddr"];
-    cout << "loadGobals(): sequencerAddr=" << publicInputs.sequencerAddr << endl;
+    string2scalar(input["sequencerAddr"], publicInputs.sequencerAddr);
+    cout << "loadGobals(): sequencerAddr=" << publicInputs.sequencerAddr.get_str(16) << endl;
 
     // Input JSON file could contain a defaultChainId key at the root level (not mandatory)
     if ( !input.contains("defaultChainId") ||
@@ -137,56 +137,55 @@ void Input::loadGlobals (json &input)
         cerr << "Error: batchL2Data key not found in input JSON file" << endl;
         exitProcess();
     }
-    batchL2Data = Add0xIfMissing(input["batchL2Data"]);
-    cout << "loadGobals(): batchL2Data=" << batchL2Data << endl;
+    string2ba(input["batchL2Data"], batchL2Data);
+    cout << "loadGobals(): batchL2Data=" << input["batchL2Data"] << endl;
 }
 
 void Input::saveGlobals (json &input) const
 {
-    input["globalExitRoot"] = globalExitRoot;
-    input["oldStateRoot"] = publicInputs.oldStateRoot;
-    input["newStateRoot"] = publicInputs.newStateRoot;
-    input["oldLocalExitRoot"] = publicInputs.oldLocalExitRoot;
-    input["newLocalExitRoot"] = publicInputs.newLocalExitRoot;
-    input["sequencerAddr"] = publicInputs.sequencerAddr;
+    input["globalExitRoot"] = NormalizeTo0xNFormat(globalExitRoot.get_str(16), 64);
+    input["oldStateRoot"] = NormalizeTo0xNFormat(publicInputs.oldStateRoot.get_str(16), 64);
+    input["newStateRoot"] = NormalizeTo0xNFormat(publicInputs.newStateRoot.get_str(16), 64);
+    input["oldLocalExitRoot"] = NormalizeTo0xNFormat(publicInputs.oldLocalExitRoot.get_str(16), 64);
+    input["newLocalExitRoot"] = NormalizeTo0xNFormat(publicInputs.newLocalExitRoot.get_str(16), 64);
+    input["sequencerAddr"] = NormalizeTo0xNFormat(publicInputs.sequencerAddr.get_str(16), 40);
     input["defaultChainId"] = publicInputs.defaultChainId;
     input["numBatch"] = publicInputs.batchNum;
     input["timestamp"] = publicInputs.timestamp;
-    input["batchL2Data"] = batchL2Data;
+    input["batchL2Data"] = "0x" + ba2string(batchL2Data);
 }
 
 void Input::preprocessTxs (void)
 {
     cout << "Input::preprocessTxs() input.txsLen=" << txsLen << endl;
 
-    // Calculate the TX batch hash
-    string keccakInput = batchL2Data;
-    keccakInput += NormalizeToNFormat(Remove0xIfPresent(globalExitRoot), 64);
-    keccakInput += NormalizeToNFormat(publicInputs.sequencerAddr, 40);
-
-    string keccakOutput = keccak256(keccakInput);
-
-    batchHashData.set_str(Remove0xIfPresent(keccakOutput), 16);
-    cout << "Input::preprocessTxs() input.batchHashData=" << keccakOutput << endl;
-
-    // Calculate STARK input
-
-    // Prepare the string to calculate the new root hash
-    keccakInput = "0x";
-    keccakInput += NormalizeToNFormat(publicInputs.oldStateRoot, 64);
-    keccakInput += NormalizeToNFormat(publicInputs.oldLocalExitRoot, 64);
-    keccakInput += NormalizeToNFormat(publicInputs.newStateRoot, 64);
-    keccakInput += NormalizeToNFormat(publicInputs.newLocalExitRoot, 64);
-    keccakInput += NormalizeToNFormat(keccakOutput, 64); // batchHashData string
-    mpz_class aux3(publicInputs.batchNum);
-    keccakInput += NormalizeToNFormat(aux3.get_str(16), 16);
-    mpz_class aux1(publicInputs.timestamp);
-    keccakInput += NormalizeToNFormat(aux1.get_str(16), 16);
-
-    // Calculate the new root hash from the concatenated string
-    keccakOutput = keccak256(keccakInput);
-
-    globalHash.set_str(Remove0xIfPresent(keccakOutput), 16);
+    // Calculate the TX batch hash = keccak(batchL2Data | globalExitRoot | sequencerAddr)
+    uint64_t batchL2DataSize = batchL2Data.size();
+    vector<uint8_t> keccakInput(batchL2DataSize + 32 + 20);
+    memcpy(keccakInput.data(), batchL2Data.data(), batchL2DataSize);
+    scalar2bytesBE(globalExitRoot, keccakInput.data() + batchL2DataSize, 32);
+    scalar2bytesBE(publicInputs.sequencerAddr, keccakInput.data() + batchL2DataSize + 32, 20);
+
+    uint8_t keccakOutput[32];
+    keccak256(keccakInput.data(), keccakInput.size(), keccakOutput, 32);
+
+    ba2scalar(keccakOutput, 32, batchHashData);
+    cout << "Input::preprocessTxs() input.batchHashData=" << batchHashData.get_str(16) << endl;
+
+    // Calculate STARK input = keccak(oldStateRoot | oldLocalExitRoot | newStateRoot | newLocalExitRoot | batchHashData | batchNum | timestamp)
+    uint8_t starkInput[5*32 + 8 + 8];
+    scalar2bytesBE(publicInputs.oldStateRoot, starkInput, 32);
+    scalar2bytesBE(publicInputs.oldLocalExitRoot, starkInput + 32, 32);
+    scalar2bytesBE(publicInputs.newStateRoot, starkInput + 64, 32);
+    scalar2bytesBE(publicInputs.newLocalExitRoot, starkInput + 96, 32);
+    memcpy(starkInput + 128, keccakOutput, 32); // batchHashData
+    scalar2bytesBE(publicInputs.batchNum, starkInput + 160, 8);
+    scalar2bytesBE(publicInputs.timestamp, starkInput + 168, 8);
+
+    // Calculate the new root hash from the concatenated bytes
+    keccak256(starkInput, sizeof(starkInput), keccakOutput, 32);
+
+    ba2scalar(keccakOutput, 32, globalHash);
     cout << "Input::preprocessTxs() input.globalHash=" << globalHash.get_str(16) << endl;
 }
 
@@ -278,19 +277,11 @@ void Input::loadDatabase (json &input)
     cout << "loadDatabase() contractsBytecode content:" << endl;
     for (json::iterator it = input["contractsBytecode"].begin(); it != input["contractsBytecode"].end(); ++it)
     {
-        // Add the 16 fe elements into the database value
-        vector<uint8_t> dbValue;
-        string contractValue = string2ba(it.value());
-        for (uint64_t i=0; i<contractValue.size(); i++)
-        {
-            dbValue.push_back(contractValue.at(i));
-        }
-
         // Get the key fe element
         string key = NormalizeToNFormat(it.key(), 64);
 
-        // Add the key:value pair to the context database
-        contractsBytecode[key] = dbValue;
+        // Add the key:value pair to the context database, decoding the bytecode in place
+        string2ba(it.value(), contractsBytecode[key]);
         cout << "    key: " << it.key() << " value: " << it.value() << endl;
     }       
 }
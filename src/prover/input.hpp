@@ -11,6 +11,7 @@
 
 using json = nlohmann::json;
 
+// Input of a batch, in binary format; filled either from a gRPC request or from a JSON object (load)
 class Input
 {
     Goldilocks &fr;
@@ -18,12 +19,12 @@ class Input
     void contractsBytecode2json (json &input, const std::map<string, vector<uint8_t>> &contractsBytecode, string name) const;
 public:
     PublicInputs publicInputs;
-    string globalExitRoot;
-    string batchL2Data;
+    mpz_class globalExitRoot;
+    string batchL2Data; // Raw bytes, not hexa
     uint64_t txsLen;
     mpz_class batchHashData;
     mpz_class globalHash; // Used by executor, not by gRPC server
-    string from; // Used for unsigned transactions
+    mpz_class from; // Used for unsigned transactions
 
     // Constructor
     Input(Goldilocks &fr) : fr(fr), txsLen(0) {};
@@ -0,0 +1,162 @@
+#include <fstream>
+#include "input_saver.hpp"
+#include "utils.hpp"
+#include "timer.hpp"
+
+InputSaver::InputSaver (const Config &config) : config(config), requestCounter(0), bStop(false)
+{
+    if ((config.saveInputPolicy == "off") || (config.saveInputPolicy == ""))
+    {
+        policy = INPUT_SAVE_OFF;
+    }
+    else if (config.saveInputPolicy == "always")
+    {
+        policy = INPUT_SAVE_ALWAYS;
+    }
+    else if (config.saveInputPolicy == "sampled")
+    {
+        policy = INPUT_SAVE_SAMPLED;
+    }
+    else if (config.saveInputPolicy == "error")
+    {
+        policy = INPUT_SAVE_ERROR;
+    }
+    else
+    {
+        cerr << "Error: InputSaver::InputSaver() found invalid saveInputPolicy=" << config.saveInputPolicy << endl;
+        exitProcess();
+    }
+
+    if ((policy == INPUT_SAVE_SAMPLED) && (config.saveInputSampleRate == 0))
+    {
+        cerr << "Error: InputSaver::InputSaver() found saveInputSampleRate=0" << endl;
+        exitProcess();
+    }
+
+    if (policy != INPUT_SAVE_OFF)
+    {
+        pthread_mutex_init(&saveQueueMutex, NULL);
+        pthread_cond_init(&saveQueueCond, 0);
+        pthread_create(&saveThread, NULL, inputSaverThread, this);
+    }
+}
+
+InputSaver::~InputSaver ()
+{
+    if (policy != INPUT_SAVE_OFF)
+    {
+        // Stop the thread, once it has saved the pending inputs, before destroying what it waits on
+        pthread_mutex_lock(&saveQueueMutex);
+        bStop = true;
+        pthread_cond_signal(&saveQueueCond);
+        pthread_mutex_unlock(&saveQueueMutex);
+        pthread_join(saveThread, NULL);
+
+        pthread_mutex_destroy(&saveQueueMutex);
+        pthread_cond_destroy(&saveQueueCond);
+    }
+}
+
+void InputSaver::onRequestStart (const ProverRequest &proverRequest)
+{
+    if (policy == INPUT_SAVE_ALWAYS)
+    {
+        enqueue(proverRequest);
+    }
+    else if (policy == INPUT_SAVE_SAMPLED)
+    {
+        if ((requestCounter++ % config.saveInputSampleRate) == 0)
+        {
+            enqueue(proverRequest);
+        }
+    }
+}
+
+void InputSaver::onRequestEnd (const ProverRequest &proverRequest)
+{
+    if ((policy == INPUT_SAVE_ERROR) && (proverRequest.result != ZKR_SUCCESS))
+    {
+        enqueue(proverRequest);
+    }
+}
+
+void InputSaver::enqueue (const ProverRequest &proverRequest)
+{
+    // The request can be deleted as soon as it is completed, so we keep a copy of its input;
+    // copying the maps is much cheaper than serializing them to JSON in the caller thread
+    TimerStart(INPUT_SAVER_COPY);
+    SaveItem * pItem = new SaveItem(proverRequest.input, proverRequest.inputFile);
+    TimerStopAndLog(INPUT_SAVER_COPY);
+
+    pthread_mutex_lock(&saveQueueMutex);
+    if (saveQueue.size() >= config.saveInputQueueSize)
+    {
+        pthread_mutex_unlock(&saveQueueMutex);
+        cerr << "Error: InputSaver::enqueue() found save queue full, discarding input file " << proverRequest.inputFile << endl;
+        delete pItem;
+        return;
+    }
+    saveQueue.push_back(pItem);
+    pthread_cond_signal(&saveQueueCond);
+    pthread_mutex_unlock(&saveQueueMutex);
+}
+
+void InputSaver::processSaveQueue (void)
+{
+    cout << "InputSaver::processSaveQueue() started" << endl;
+
+    while (true)
+    {
+        pthread_mutex_lock(&saveQueueMutex);
+
+        // Wait for new inputs to save, if there are no more pending inputs
+        while ((saveQueue.size() == 0) && !bStop)
+        {
+            pthread_cond_wait(&saveQueueCond, &saveQueueMutex);
+        }
+
+        // Once stopped, return when all the pending inputs have been saved
+        if (saveQueue.size() == 0)
+        {
+            pthread_mutex_unlock(&saveQueueMutex);
+            break;
+        }
+
+        // Extract the oldest pending input
+        SaveItem * pItem = saveQueue[0];
+        saveQueue.erase(saveQueue.begin());
+        pthread_mutex_unlock(&saveQueueMutex);
+
+        TimerStart(INPUT_SAVER_SAVE);
+        json inputJson;
+        pItem->input.save(inputJson);
+        if (config.saveInputBinary)
+        {
+            // Save input to <timestamp>.input.cbor, a compact binary encoding of the same JSON object
+            string fileName = pItem->fileName;
+            if ((fileName.size() >= 5) && (fileName.substr(fileName.size() - 5) == ".json"))
+            {
+                fileName = fileName.substr(0, fileName.size() - 5);
+            }
+            fileName += ".cbor";
+            json2cborfile(inputJson, fileName);
+        }
+        else
+        {
+            // Save input to <timestamp>.input.json, as provided by client
+            json2file(inputJson, pItem->fileName);
+        }
+        TimerStopAndLog(INPUT_SAVER_SAVE);
+
+        delete pItem;
+    }
+
+    cout << "InputSaver::processSaveQueue() stopped" << endl;
+}
+
+void* inputSaverThread (void* arg)
+{
+    InputSaver * pInputSaver = (InputSaver *)arg;
+    pInputSaver->processSaveQueue();
+    return NULL;
+}
@@ -0,0 +1,57 @@
+#ifndef INPUT_SAVER_HPP
+#define INPUT_SAVER_HPP
+
+#include <pthread.h>
+#include <atomic>
+#include "config.hpp"
+#include "input.hpp"
+#include "prover_request.hpp"
+
+// Input saving policies, configured through config.saveInputPolicy
+enum InputSavePolicy
+{
+    INPUT_SAVE_OFF = 0,     // Never save the request input
+    INPUT_SAVE_ALWAYS = 1,  // Save the input of every request
+    INPUT_SAVE_SAMPLED = 2, // Save the input of one out of every config.saveInputSampleRate requests
+    INPUT_SAVE_ERROR = 3    // Save the input of the requests that did not succeed
+};
+
+class InputSaver
+{
+    class SaveItem
+    {
+    public:
+        Input input;
+        string fileName;
+        SaveItem(const Input &input, const string &fileName) : input(input), fileName(fileName) {};
+    };
+
+    const Config &config;
+    InputSavePolicy policy;
+    std::atomic<uint64_t> requestCounter;
+
+    vector<SaveItem *> saveQueue; // Inputs pending to be written to disk, oldest first
+    pthread_t saveThread;
+    pthread_mutex_t saveQueueMutex; // Mutex to protect saveQueue
+    pthread_cond_t saveQueueCond; // Cond to signal when queue has new items, or the thread must stop
+    bool bStop; // Set by the destructor; the thread saves the pending inputs and then returns
+
+    void enqueue (const ProverRequest &proverRequest);
+
+public:
+    InputSaver(const Config &config);
+    ~InputSaver();
+
+    // To be called before executing a request; saves its input if policy is always or sampled
+    void onRequestStart (const ProverRequest &proverRequest);
+
+    // To be called after executing a request; saves its input if policy is error and it failed
+    void onRequestEnd (const ProverRequest &proverRequest);
+
+    // Writes the queued inputs to disk, in the background thread, until the saver is destroyed
+    void processSaveQueue (void);
+};
+
+void* inputSaverThread (void* arg);
+
+#endif
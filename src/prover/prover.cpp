@@ -20,8 +20,10 @@ Prover::Prover( Goldilocks &fr,
                 const Config &config ) :
         fr(fr),
         poseidon(poseidon),
-        executor(fr, config, poseidon),
+        executorPool(fr, config, poseidon),
+        pProveExecutor(NULL),
         stark(config),
+        inputSaver(config),
         config(config)
 {
     mpz_init(altBbn128r);
@@ -71,6 +73,7 @@ Prover::Prover( Goldilocks &fr,
 
 Prover::~Prover ()
 {
+    if (pProveExecutor != NULL) delete pProveExecutor;
     mpz_clear(altBbn128r);
 }
 
@@ -226,14 +229,26 @@ void Prover::execute (ProverRequest * pProverRequest)
     cout << "Prover::execute() timestamp: " << pProverRequest->timestamp << endl;
     cout << "Prover::execute() UUID: " << pProverRequest->uuid << endl;
 
-    // Save input to <timestamp>.input.json, as provided by client
-    json inputJson;
-    pProverRequest->input.save(inputJson);
-    json2file(inputJson, pProverRequest->inputFile);
+    // Save input to <timestamp>.input.json, as provided by client, in the background
+    inputSaver.onRequestStart(*pProverRequest);
+
+    // Get a free executor context, or return busy if all of them are in use
+    Executor * pExecutor = executorPool.acquire(config.executorPoolTimeout);
+    if (pExecutor == NULL)
+    {
+        cerr << "Error: Prover::execute() found all " << executorPool.size() << " executor contexts busy" << endl;
+        pProverRequest->result = ZKR_EXECUTOR_BUSY;
+        TimerStopAndLog(PROVER_EXECUTE);
+        return;
+    }
 
     // Execute the program, in the fast way
     pProverRequest->bFastMode = true;
-    executor.execute_fast(*pProverRequest);
+    pExecutor->execute_fast(*pProverRequest);
+
+    executorPool.release(pExecutor);
+
+    inputSaver.onRequestEnd(*pProverRequest);
 
     TimerStopAndLog(PROVER_EXECUTE);
 }
@@ -246,15 +261,27 @@ void Prover::processBatch (ProverRequest * pProverRequest)
     cout << "Prover::processBatch() timestamp: " << pProverRequest->timestamp << endl;
     cout << "Prover::processBatch() UUID: " << pProverRequest->uuid << endl;
 
-    // Save input to <timestamp>.input.json, as provided by client
-    json inputJson;
-    pProverRequest->input.save(inputJson);
-    json2file(inputJson, pProverRequest->inputFile);
+    // Save input to <timestamp>.input.json, as provided by client, in the background
+    inputSaver.onRequestStart(*pProverRequest);
+
+    // Get a free executor context, or return busy if all of them are in use
+    Executor * pExecutor = executorPool.acquire(config.executorPoolTimeout);
+    if (pExecutor == NULL)
+    {
+        cerr << "Error: Prover::processBatch() found all " << executorPool.size() << " executor contexts busy" << endl;
+        pProverRequest->result = ZKR_EXECUTOR_BUSY;
+        TimerStopAndLog(PROVER_PROCESS_BATCH);
+        return;
+    }
 
     // Execute the program, in the fast way
     pProverRequest->bFastMode = true;
     pProverRequest->bProcessBatch = true;
-    executor.process_batch( *pProverRequest );
+    pExecutor->process_batch( *pProverRequest );
+
+    executorPool.release(pExecutor);
+
+    inputSaver.onRequestEnd(*pProverRequest);
 
     TimerStopAndLog(PROVER_PROCESS_BATCH);
 }
@@ -270,10 +297,8 @@ void Prover::prove (ProverRequest * pProverRequest)
     cout << "Prover::prove() public file: " << pProverRequest->publicFile << endl;
     cout << "Prover::prove() proof file: " << pProverRequest->proofFile << endl;
 
-    // Save input to <timestamp>.input.json, as provided by client
-    json inputJson;
-    pProverRequest->input.save(inputJson);
-    json2file(inputJson, pProverRequest->inputFile);
+    // Save input to <timestamp>.input.json, as provided by client, in the background
+    inputSaver.onRequestStart(*pProverRequest);
 
     /************/
     /* Executor */
@@ -302,13 +327,25 @@ void Prover::prove (ProverRequest * pProverRequest)
     }
     CommitPols cmPols(pAddress, CommitPols::pilDegree());
 
-    // Execute all the State Machines
+    // Execute all the State Machines, in a context of its own, so that executions for proving, which
+    // take much longer than batch processing, never hold the contexts of the executor service
+    if (pProveExecutor == NULL)
+    {
+        pProveExecutor = new Executor(fr, config, poseidon);
+        if (pProveExecutor == NULL)
+        {
+            cerr << "Error: Prover::prove() failed calling new Executor()" << endl;
+            exitProcess();
+        }
+    }
     TimerStart(EXECUTOR_EXECUTE);
-    executor.execute(*pProverRequest, cmPols);
+    pProveExecutor->execute(*pProverRequest, cmPols);
     TimerStopAndLog(EXECUTOR_EXECUTE);
+
+    inputSaver.onRequestEnd(*pProverRequest);
     
     // Save input to <timestamp>.input.json, after execution
-    /*Database * pDatabase = executor.mainExecutor.pStateDB->getDatabase();
+    /*Database * pDatabase = pProveExecutor->mainExecutor.pStateDB->getDatabase();
     if (pDatabase != NULL)
     {
         json inputJsonEx;
@@ -13,8 +13,10 @@
 #include "binfile_utils.hpp"
 #include "zkey_utils.hpp"
 #include "prover_request.hpp"
+#include "input_saver.hpp"
 #include "poseidon_goldilocks.hpp"
 #include "executor/executor.hpp"
+#include "executor/executor_pool.hpp"
 #include "sm/pols_generated/constant_pols.hpp"
 #include "starkpil/src/stark.hpp"
 #include "starkpil/src/stark_info.hpp"
@@ -23,8 +25,10 @@ class Prover
 {
     Goldilocks &fr;
     PoseidonGoldilocks &poseidon;
-    Executor executor;
+    ExecutorPool executorPool; // Contexts for execute and processBatch requests
+    Executor * pProveExecutor; // Context of prove, only used by the prover thread; created on first use
     Stark stark;
+    InputSaver inputSaver;
 
     std::unique_ptr<Groth16::Prover<AltBn128::Engine>> groth16Prover;
     std::unique_ptr<BinFileUtils::BinFile> zkey;
@@ -2,18 +2,19 @@
 #define PUBLIC_INPUTS_HPP
 
 #include <string>
+#include <gmpxx.h>
 
 using namespace std;
 
 class PublicInputs
 {
 public:
-    string oldStateRoot;
-    string newStateRoot;
-    string oldLocalExitRoot;
-    string newLocalExitRoot;
-    string sequencerAddr;
-    string batchHashData;
+    mpz_class oldStateRoot;
+    mpz_class newStateRoot;
+    mpz_class oldLocalExitRoot;
+    mpz_class newLocalExitRoot;
+    mpz_class sequencerAddr;
+    mpz_class batchHashData;
     uint32_t defaultChainId;
     uint32_t batchNum;
     uint32_t blockNum;
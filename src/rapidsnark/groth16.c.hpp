@@ -22,7 +22,8 @@ std::unique_ptr<Prover<Engine>> makeProver(
     void *pointsB1, 
     void *pointsB2, 
     void *pointsC, 
-    void *pointsH
+    void *pointsH,
+    bool precomputeBases
 ) {
     Prover<Engine> *p = new Prover<Engine>(
         Engine::engine, 
@@ -40,11 +41,87 @@ std::unique_ptr<Prover<Engine>> makeProver(
         (typename Engine::G1PointAffine *)pointsB1,
         (typename Engine::G2PointAffine *)pointsB2,
         (typename Engine::G1PointAffine *)pointsC,
-        (typename Engine::G1PointAffine *)pointsH
+        (typename Engine::G1PointAffine *)pointsH,
+        precomputeBases
     );
     return std::unique_ptr< Prover<Engine> >(p);
 }
 
+template <typename Engine>
+void Prover<Engine>::bucketCoefs() {
+
+    LOG_TRACE("Bucketing coefs by row");
+    u_int64_t nRows = 2*(u_int64_t)domainSize;
+    rowStart = new u_int64_t[nRows+1];
+
+    // Count the coefs of every row, and check if the zkey already has them sorted by (m, c)
+    bool bSorted = true;
+    u_int64_t lastRow = 0;
+    for (u_int64_t r=0; r<=nRows; r++) rowStart[r] = 0;
+    for (u_int64_t i=0; i<nCoefs; i++) {
+        u_int64_t r = (coefs[i].m == 0 ? 0 : domainSize) + coefs[i].c;
+        rowStart[r+1]++;
+        if (r < lastRow) bSorted = false;
+        lastRow = r;
+    }
+    for (u_int64_t r=0; r<nRows; r++) rowStart[r+1] += rowStart[r];
+
+    // The coefs live in the read-only zkey mapping, so they are never copied; if they are not
+    // sorted, a stable counting sort of their indexes is kept instead, so every row is always
+    // summed in zkey order using 4 bytes per coef (nCoefs is a u_int32_t in the zkey)
+    coefsOrder = NULL;
+    if (!bSorted) {
+        coefsOrder = new u_int32_t[nCoefs];
+        u_int64_t *next = new u_int64_t[nRows];
+        memcpy(next, rowStart, nRows*sizeof(u_int64_t));
+        for (u_int64_t i=0; i<nCoefs; i++) {
+            u_int64_t r = (coefs[i].m == 0 ? 0 : domainSize) + coefs[i].c;
+            coefsOrder[next[r]++] = i;
+        }
+        delete [] next;
+    }
+
+    // Split the rows in contiguous partitions holding about the same number of coefs
+    nPartitions = omp_get_max_threads();
+    if (nPartitions == 0) nPartitions = 1;
+    partitionStart = new u_int64_t[nPartitions+1];
+    partitionStart[0] = 0;
+    u_int64_t r = 0;
+    for (u_int32_t p=1; p<nPartitions; p++) {
+        u_int64_t target = (nCoefs*p)/nPartitions;
+        while ((r < nRows) && (rowStart[r] < target)) r++;
+        partitionStart[p] = r;
+    }
+    partitionStart[nPartitions] = nRows;
+}
+
+template <typename Engine>
+void Prover<Engine>::precomputeBases() {
+
+    // The bases never change between proofs, so their multiples for every multiexp chunk can be reused
+    u_int32_t sW = sizeof(typename Engine::FrElement);
+
+    LOG_TRACE("Precomputing bases A");
+    tableA = new MultiexpTable<typename Engine::G1>();
+    E.g1.precomputeMultiMulByScalar(*tableA, pointsA, sW, nVars);
+
+    LOG_TRACE("Precomputing bases B1");
+    tableB1 = new MultiexpTable<typename Engine::G1>();
+    E.g1.precomputeMultiMulByScalar(*tableB1, pointsB1, sW, nVars);
+
+    LOG_TRACE("Precomputing bases B2");
+    tableB2 = new MultiexpTable<typename Engine::G2>();
+    E.g2.precomputeMultiMulByScalar(*tableB2, pointsB2, sW, nVars);
+
+    LOG_TRACE("Precomputing bases C");
+    tableC = new MultiexpTable<typename Engine::G1>();
+    E.g1.precomputeMultiMulByScalar(*tableC, pointsC, sW, nVars-nPublic-1);
+
+    LOG_TRACE("Precomputing bases H");
+    tableH = new MultiexpTable<typename Engine::G1>();
+    E.g1.precomputeMultiMulByScalar(*tableH, pointsH, sW, domainSize);
+}
+
 template <typename Engine>
 std::unique_ptr<Proof<Engine>> Prover<Engine>::prove(typename Engine::FrElement *wtns) {
 
@@ -60,30 +137,22 @@ std::unique_ptr<Proof<Engine>> Prover<Engine>::prove(typename Engine::FrElement
     }
 
     LOG_TRACE("Processing coefs");
-    #define NLOCKS 1024
-    omp_lock_t locks[NLOCKS];
-    for (int i=0; i<NLOCKS; i++) omp_init_lock(&locks[i]);
-    #pragma omp parallel for 
-    for (u_int64_t i=0; i<nCoefs; i++) {
-        typename Engine::FrElement *ab = (coefs[i].m == 0) ? a : b;
-        typename Engine::FrElement aux;
-
-        E.fr.mul(
-            aux,
-            wtns[coefs[i].s],
-            coefs[i].coef
-        );
-
-        omp_set_lock(&locks[coefs[i].c % NLOCKS]);
-        E.fr.add(
-            ab[coefs[i].c],
-            ab[coefs[i].c],
-            aux
-        );
-        omp_unset_lock(&locks[coefs[i].c % NLOCKS]);
+    #pragma omp parallel for schedule(static, 1)
+    for (u_int32_t p=0; p<nPartitions; p++) {
+        for (u_int64_t r=partitionStart[p]; r<partitionStart[p+1]; r++) {
+            typename Engine::FrElement *ab = (r < domainSize) ? &a[r] : &b[r - domainSize];
+            typename Engine::FrElement aux;
+            for (u_int64_t i=rowStart[r]; i<rowStart[r+1]; i++) {
+                Coef<Engine> &coef = coefs[(coefsOrder == NULL) ? i : coefsOrder[i]];
+                E.fr.mul(
+                    aux,
+                    wtns[coef.s],
+                    coef.coef
+                );
+                E.fr.add(*ab, *ab, aux);
+            }
+        }
     }
-    for (int i=0; i<NLOCKS; i++) omp_destroy_lock(&locks[i]);
-
 
     LOG_TRACE("Calculating c");
     #pragma omp parallel for
@@ -170,7 +239,11 @@ std::unique_ptr<Proof<Engine>> Prover<Engine>::prove(typename Engine::FrElement
 
     LOG_TRACE("Start Multiexp H");
     typename Engine::G1Point pih;
-    E.g1.multiMulByScalar(pih, pointsH, (uint8_t *)a, sizeof(a[0]), domainSize);
+    if (tableH != NULL) {
+        E.g1.multiMulByScalar(pih, *tableH, (uint8_t *)a, sizeof(a[0]), domainSize);
+    } else {
+        E.g1.multiMulByScalar(pih, pointsH, (uint8_t *)a, sizeof(a[0]), domainSize);
+    }
     std::ostringstream ss1;
     ss1 << "pih: " << E.g1.toString(pih);
     LOG_DEBUG(ss1);
@@ -180,28 +253,44 @@ std::unique_ptr<Proof<Engine>> Prover<Engine>::prove(typename Engine::FrElement
     LOG_TRACE("Start Multiexp A");
     uint32_t sW = sizeof(wtns[0]);
     typename Engine::G1Point pi_a;
-    E.g1.multiMulByScalar(pi_a, pointsA, (uint8_t *)wtns, sW, nVars);
+    if (tableA != NULL) {
+        E.g1.multiMulByScalar(pi_a, *tableA, (uint8_t *)wtns, sW, nVars);
+    } else {
+        E.g1.multiMulByScalar(pi_a, pointsA, (uint8_t *)wtns, sW, nVars);
+    }
     std::ostringstream ss2;
     ss2 << "pi_a: " << E.g1.toString(pi_a);
     LOG_DEBUG(ss2);
 
     LOG_TRACE("Start Multiexp B1");
     typename Engine::G1Point pib1;
-    E.g1.multiMulByScalar(pib1, pointsB1, (uint8_t *)wtns, sW, nVars);
+    if (tableB1 != NULL) {
+        E.g1.multiMulByScalar(pib1, *tableB1, (uint8_t *)wtns, sW, nVars);
+    } else {
+        E.g1.multiMulByScalar(pib1, pointsB1, (uint8_t *)wtns, sW, nVars);
+    }
     std::ostringstream ss3;
     ss3 << "pib1: " << E.g1.toString(pib1);
     LOG_DEBUG(ss3);
 
     LOG_TRACE("Start Multiexp B2");
     typename Engine::G2Point pi_b;
-    E.g2.multiMulByScalar(pi_b, pointsB2, (uint8_t *)wtns, sW, nVars);
+    if (tableB2 != NULL) {
+        E.g2.multiMulByScalar(pi_b, *tableB2, (uint8_t *)wtns, sW, nVars);
+    } else {
+        E.g2.multiMulByScalar(pi_b, pointsB2, (uint8_t *)wtns, sW, nVars);
+    }
     std::ostringstream ss4;
     ss4 << "pi_b: " << E.g2.toString(pi_b);
     LOG_DEBUG(ss4);
 
     LOG_TRACE("Start Multiexp C");
     typename Engine::G1Point pi_c;
-    E.g1.multiMulByScalar(pi_c, pointsC, (uint8_t *)((uint64_t)wtns + (nPublic +1)*sW), sW, nVars-nPublic-1);
+    if (tableC != NULL) {
+        E.g1.multiMulByScalar(pi_c, *tableC, (uint8_t *)((uint64_t)wtns + (nPublic +1)*sW), sW, nVars-nPublic-1);
+    } else {
+        E.g1.multiMulByScalar(pi_c, pointsC, (uint8_t *)((uint64_t)wtns + (nPublic +1)*sW), sW, nVars-nPublic-1);
+    }
     std::ostringstream ss5;
     ss5 << "pi_c: " << E.g1.toString(pi_c);
     LOG_DEBUG(ss5);
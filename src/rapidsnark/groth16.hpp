@@ -7,6 +7,7 @@ using json = nlohmann::json;
 
 #include "binfile_utils.hpp"
 #include "fft.hpp"
+#include "multiexp.hpp"
 
 namespace Groth16 {
 
@@ -54,7 +55,26 @@ namespace Groth16 {
         typename Engine::G1PointAffine *pointsC;
         typename Engine::G1PointAffine *pointsH;
 
+        // Coefs bucketed by destination row (CSR-like): row r = m*domainSize + c owns the
+        // positions [rowStart[r], rowStart[r+1]) of coefs, or of coefsOrder if the zkey coefs
+        // are not sorted by row (NULL otherwise), and partition p owns rows
+        // [partitionStart[p], partitionStart[p+1]), so accumulation needs no locks
+        u_int32_t *coefsOrder;
+        u_int64_t *rowStart;
+        u_int32_t nPartitions;
+        u_int64_t *partitionStart;
+
+        // Optional precomputed multiples of the fixed bases, used by the multiexps when not NULL
+        MultiexpTable<typename Engine::G1> *tableA;
+        MultiexpTable<typename Engine::G1> *tableB1;
+        MultiexpTable<typename Engine::G2> *tableB2;
+        MultiexpTable<typename Engine::G1> *tableC;
+        MultiexpTable<typename Engine::G1> *tableH;
+
         FFT<typename Engine::Fr> *fft;
+
+        void bucketCoefs();
+        void precomputeBases();
     public:
         Prover(
             Engine &_E, 
@@ -72,7 +92,8 @@ namespace Groth16 {
             typename Engine::G1PointAffine *_pointsB1,
             typename Engine::G2PointAffine *_pointsB2,
             typename Engine::G1PointAffine *_pointsC,
-            typename Engine::G1PointAffine *_pointsH
+            typename Engine::G1PointAffine *_pointsH,
+            bool _precomputeBases = false
         ) : 
             E(_E), 
             nVars(_nVars),
@@ -89,13 +110,28 @@ namespace Groth16 {
             pointsB1(_pointsB1),
             pointsB2(_pointsB2),
             pointsC(_pointsC),
-            pointsH(_pointsH)
+            pointsH(_pointsH),
+            tableA(NULL),
+            tableB1(NULL),
+            tableB2(NULL),
+            tableC(NULL),
+            tableH(NULL)
         { 
             fft = new FFT<typename Engine::Fr>(domainSize*2);
+            bucketCoefs();
+            if (_precomputeBases) precomputeBases();
         };
 
         ~Prover() {
             delete fft;
+            delete [] coefsOrder;
+            delete [] rowStart;
+            delete [] partitionStart;
+            delete tableA;
+            delete tableB1;
+            delete tableB2;
+            delete tableC;
+            delete tableH;
         }
 
         std::unique_ptr<Proof<Engine>> prove(typename Engine::FrElement *wtns);
@@ -117,7 +153,8 @@ namespace Groth16 {
         void *pointsB1,
         void *pointsB2,
         void *pointsC,
-        void *pointsH
+        void *pointsH,
+        bool precomputeBases = false
     );
 };
 
@@ -0,0 +1,152 @@
+#include <iostream>
+#include "async_server.hpp"
+#include "metrics.hpp"
+#include "timer.hpp"
+#include "utils.hpp"
+
+struct AsyncServerPollingThreadArg
+{
+    AsyncServer * pServer;
+    uint64_t queue;
+};
+
+AsyncServer::AsyncServer (const string &name, const Config &config) :
+    name(name),
+    queueMetric(name + "_QUEUE_US"),
+    rejectedMetric(name + "_REJECTED"),
+    pollingThreads(config.asyncServerPollingThreads),
+    workerThreads(config.asyncServerWorkerThreads),
+    maxInFlight(config.asyncServerMaxInFlight),
+    inFlight(0)
+{
+    if ((pollingThreads == 0) || (workerThreads == 0) || (maxInFlight == 0))
+    {
+        cerr << "Error: AsyncServer::AsyncServer() got invalid config for " << name << ": asyncServerPollingThreads=" << pollingThreads << " asyncServerWorkerThreads=" << workerThreads << " asyncServerMaxInFlight=" << maxInFlight << endl;
+        exitProcess();
+    }
+    pthread_mutex_init(&mutex, NULL);
+    pthread_cond_init(&queueCond, NULL);
+}
+
+AsyncServer::~AsyncServer ()
+{
+    pthread_cond_destroy(&queueCond);
+    pthread_mutex_destroy(&mutex);
+}
+
+void AsyncServer::addCompletionQueues (grpc::ServerBuilder &builder)
+{
+    for (uint64_t i=0; i<pollingThreads; i++)
+    {
+        cqs.emplace_back(builder.AddCompletionQueue());
+    }
+}
+
+void AsyncServer::run (void)
+{
+    for (uint64_t i=0; i<workerThreads; i++)
+    {
+        pthread_t t;
+        pthread_create(&t, NULL, asyncServerWorkerThread, this);
+        threads.push_back(t);
+    }
+    for (uint64_t i=0; i<cqs.size(); i++)
+    {
+        AsyncServerPollingThreadArg * pArg = new AsyncServerPollingThreadArg;
+        pArg->pServer = this;
+        pArg->queue = i;
+        pthread_t t;
+        pthread_create(&t, NULL, asyncServerPollingThread, pArg);
+        threads.push_back(t);
+    }
+
+    cout << name << " async server running with " << cqs.size() << " polling threads, " << workerThreads << " worker threads and maxInFlight=" << maxInFlight << endl;
+
+    // Polling threads only return once their queue is shut down; then wake up the workers
+    for (uint64_t i=workerThreads; i<threads.size(); i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    pthread_mutex_lock(&mutex);
+    queue.push_back(NULL);
+    pthread_cond_broadcast(&queueCond);
+    pthread_mutex_unlock(&mutex);
+    for (uint64_t i=0; i<workerThreads; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    threads.clear();
+}
+
+bool AsyncServer::accept (AsyncCall * pCall)
+{
+    pthread_mutex_lock(&mutex);
+    if (inFlight >= maxInFlight)
+    {
+        pthread_mutex_unlock(&mutex);
+        metrics.counterAdd(rejectedMetric.c_str(), 1);
+        return false;
+    }
+    inFlight++;
+    queue.push_back(pCall);
+    pthread_cond_signal(&queueCond);
+    pthread_mutex_unlock(&mutex);
+    return true;
+}
+
+void AsyncServer::done (void)
+{
+    pthread_mutex_lock(&mutex);
+    inFlight--;
+    pthread_mutex_unlock(&mutex);
+}
+
+void AsyncServer::pollingThreadLoop (uint64_t i)
+{
+    void * tag;
+    bool ok;
+    while (cqs[i]->Next(&tag, &ok))
+    {
+        ((AsyncCall *)tag)->proceed(ok);
+    }
+}
+
+void AsyncServer::workerThreadLoop (void)
+{
+    while (true)
+    {
+        pthread_mutex_lock(&mutex);
+        while (queue.empty()) pthread_cond_wait(&queueCond, &mutex);
+        AsyncCall * pCall = queue.front();
+
+        // A NULL call means the server is stopping; leave it for the other workers
+        if (pCall == NULL)
+        {
+            pthread_mutex_unlock(&mutex);
+            return;
+        }
+        queue.pop_front();
+        pthread_mutex_unlock(&mutex);
+
+        metrics.histogramAdd(queueMetric.c_str(), TimeDiff(pCall->arrival));
+
+        // The call can be completed, and deleted by a polling thread, as soon as it is processed
+        pCall->process();
+        done();
+    }
+}
+
+void* asyncServerPollingThread (void* arg)
+{
+    AsyncServerPollingThreadArg * pArg = (AsyncServerPollingThreadArg *)arg;
+    pArg->pServer->pollingThreadLoop(pArg->queue);
+    delete pArg;
+    return NULL;
+}
+
+void* asyncServerWorkerThread (void* arg)
+{
+    AsyncServer * pServer = (AsyncServer *)arg;
+    pServer->workerThreadLoop();
+    return NULL;
+}
@@ -0,0 +1,147 @@
+#ifndef ASYNC_SERVER_HPP
+#define ASYNC_SERVER_HPP
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <pthread.h>
+#include <sys/time.h>
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/impl/codegen/async_unary_call.h>
+#include "config.hpp"
+
+using namespace std;
+
+/*
+    Asynchronous gRPC server, based on completion queues, used instead of the synchronous thread pool
+    when asyncServers is set
+
+    - Every polling thread owns a completion queue, and only receives calls and completes them
+    - Received calls are queued and executed by a fixed pool of worker threads, so a burst of calls
+      does not create a thread per call, all of them blocked on the same locks
+    - Calls received when maxInFlight calls are already queued or executing are rejected with
+      RESOURCE_EXHAUSTED, so that the queueing time, and therefore the tail latency, stays bounded
+    - The time every call waits in the queue is recorded in the <name>_QUEUE_US histogram metric
+
+    Unary methods are served through AsyncUnaryCall, reusing the handlers of the synchronous service
+    implementation; streaming methods are left synchronous
+*/
+
+class AsyncServer;
+
+// A call in flight; the polling threads call proceed() when its completion queue event arrives
+class AsyncCall
+{
+public:
+    struct timeval arrival;
+    virtual ~AsyncCall() {};
+    virtual void proceed (bool ok) = 0; // Polling thread
+    virtual void process (void) = 0; // Worker thread
+};
+
+class AsyncServer
+{
+private:
+    string name;
+    string queueMetric;
+    string rejectedMetric;
+    uint64_t pollingThreads;
+    uint64_t workerThreads;
+    uint64_t maxInFlight;
+    vector<unique_ptr<grpc::ServerCompletionQueue>> cqs;
+    vector<pthread_t> threads;
+
+    // Queue of received calls, pending to be processed
+    pthread_mutex_t mutex; // Mutex to protect queue and inFlight
+    pthread_cond_t queueCond; // Cond to signal when queue has new items
+    deque<AsyncCall *> queue;
+    uint64_t inFlight; // Calls queued or being processed
+
+public:
+    AsyncServer (const string &name, const Config &config);
+    ~AsyncServer ();
+
+    // Adds the completion queues to the builder; must be called before BuildAndStart()
+    void addCompletionQueues (grpc::ServerBuilder &builder);
+    uint64_t getQueues (void) { return cqs.size(); };
+    grpc::ServerCompletionQueue * getQueue (uint64_t i) { return cqs[i].get(); };
+
+    // Starts the polling and worker threads, and waits for them, i.e. until the queues are shut down
+    void run (void);
+
+    bool accept (AsyncCall * pCall); // Returns false if the call must be rejected
+    void done (void); // Called once an accepted call has been processed
+    void pollingThreadLoop (uint64_t queue);
+    void workerThreadLoop (void);
+};
+
+// Unary method of an async service; there is always one instance of every method and queue waiting
+// for the next call, and every received call creates its replacement
+template <class AsyncService, class Request, class Response>
+class AsyncUnaryCall : public AsyncCall
+{
+public:
+    typedef void (AsyncService::*RequestMethod) (grpc::ServerContext*, Request*, grpc::ServerAsyncResponseWriter<Response>*, grpc::CompletionQueue*, grpc::ServerCompletionQueue*, void*);
+    typedef std::function<grpc::Status (grpc::ServerContext*, const Request*, Response*)> Handler;
+
+private:
+    AsyncServer &server;
+    AsyncService &service;
+    grpc::ServerCompletionQueue * cq;
+    RequestMethod requestMethod;
+    Handler handler;
+    grpc::ServerContext context;
+    Request request;
+    Response response;
+    grpc::ServerAsyncResponseWriter<Response> responder;
+    bool bReceived;
+
+public:
+    AsyncUnaryCall (AsyncServer &server, AsyncService &service, grpc::ServerCompletionQueue * cq, RequestMethod requestMethod, Handler handler) :
+        server(server), service(service), cq(cq), requestMethod(requestMethod), handler(handler), responder(&context), bReceived(false)
+    {
+        (service.*requestMethod)(&context, &request, &responder, cq, cq, this);
+    };
+
+    void proceed (bool ok)
+    {
+        // Once finished, or if the queue is shutting down, the call is done
+        if (bReceived || !ok)
+        {
+            delete this;
+            return;
+        }
+
+        // Wait for the next call, and queue this one
+        new AsyncUnaryCall(server, service, cq, requestMethod, handler);
+        bReceived = true;
+        gettimeofday(&arrival, NULL);
+        if (!server.accept(this))
+        {
+            responder.FinishWithError(grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "too many requests in flight"), this);
+        }
+    };
+
+    void process (void)
+    {
+        grpc::Status status = handler(&context, &request, &response);
+        responder.Finish(response, status, this);
+    };
+};
+
+// Creates the first call of a unary method on every queue of the server
+template <class AsyncService, class Request, class Response>
+void asyncUnaryMethod (AsyncServer &server, AsyncService &service, typename AsyncUnaryCall<AsyncService, Request, Response>::RequestMethod requestMethod, typename AsyncUnaryCall<AsyncService, Request, Response>::Handler handler)
+{
+    for (uint64_t i=0; i<server.getQueues(); i++)
+    {
+        new AsyncUnaryCall<AsyncService, Request, Response>(server, service, server.getQueue(i), requestMethod, handler);
+    }
+}
+
+void* asyncServerPollingThread (void* arg);
+void* asyncServerWorkerThread (void* arg);
+
+#endif
@@ -6,6 +6,7 @@
 #include "config.hpp"
 #include "executor_server.hpp"
 #include "executor_service.hpp"
+#include "async_server.hpp"
 
 using grpc::Server;
 using grpc::ServerBuilder;
@@ -25,6 +26,12 @@ void ExecutorServer::run (void)
     // Listen on the given address without any authentication mechanism.
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
 
+    if (config.asyncServers)
+    {
+        runAsync(builder, service);
+        return;
+    }
+
     // Register "service" as the instance through which we'll communicate with
     // clients. In this case it corresponds to an *synchronous* service.
     builder.RegisterService(&service);
@@ -39,6 +46,23 @@ void ExecutorServer::run (void)
     server->Wait();
 }
 
+void ExecutorServer::runAsync (ServerBuilder &builder, ExecutorServiceImpl &service)
+{
+    ExecutorAsyncServiceImpl asyncService(service);
+    AsyncServer asyncServer("EXECUTOR_SERVER", config);
+    builder.RegisterService(&asyncService);
+    asyncServer.addCompletionQueues(builder);
+    std::unique_ptr<Server> server(builder.BuildAndStart());
+
+    asyncUnaryMethod<ExecutorAsyncServiceImpl, executor::v1::ProcessBatchRequest, executor::v1::ProcessBatchResponse>(asyncServer, asyncService, &ExecutorAsyncServiceImpl::RequestProcessBatch,
+        [&service](ServerContext* context, const executor::v1::ProcessBatchRequest* request, executor::v1::ProcessBatchResponse* response) { return service.ProcessBatch(context, request, response); });
+
+    std::cout << "Executor async server listening on 0.0.0.0:" << config.executorServerPort << std::endl;
+
+    // Serve until the queues are shut down
+    asyncServer.run();
+}
+
 void ExecutorServer::runThread (void)
 {
     pthread_create(&t, NULL, executorServerThread, this);
@@ -4,6 +4,8 @@
 #include "proof.hpp"
 #include "service/prover/prover_utils.hpp"
 #include "full_tracer.hpp"
+#include "rlp.hpp"
+#include "utils.hpp"
 
 #include <grpcpp/grpcpp.h>
 
@@ -22,61 +24,222 @@ using grpc::Status;
     ProverRequest proverRequest(fr);
     proverRequest.init(config);
 
+    // Parse the request into the prover request input
+    ::grpc::Status status = parseRequest(request, proverRequest);
+    if (!status.ok())
+    {
+        return status;
+    }
+
+    prover.processBatch(&proverRequest);
+
+    // Let the client know it should retry later, since all executor contexts are in use
+    if (proverRequest.result == ZKR_EXECUTOR_BUSY)
+    {
+        return Status(grpc::StatusCode::RESOURCE_EXHAUSTED, zkresult2string(ZKR_EXECUTOR_BUSY));
+    }
+
+    // If the batch does not fit in the state machines, execute instead the longest prefix of its
+    // transactions that does, and return it with the out of counters error, so that the client can
+    // resize the batch; the transaction being executed when the counters ran out does not fit
+    unique_ptr<ProverRequest> pPrefixRequest;
+    if (proverRequest.result == ZKR_SM_MAIN_OUT_OF_COUNTERS)
+    {
+        uint64_t startedTxs = proverRequest.fullTracer.finalTrace.responses.size();
+        status = processBatchPrefix(request, (startedTxs > 0) ? startedTxs - 1 : 0, pPrefixRequest);
+        if (!status.ok())
+        {
+            return status;
+        }
+    }
+    ProverRequest &executedRequest = pPrefixRequest ? *pPrefixRequest : proverRequest;
+
+    if (executedRequest.result != ZKR_SUCCESS)
+    {
+        cerr << "Error: ExecutorServiceImpl::ProcessBatch() detected proverRequest.result=" << executedRequest.result << "=" << zkresult2string(executedRequest.result) << endl;
+        return Status::CANCELLED;
+    }
+    
+    setBatchFields(executedRequest, response);
+    if (pPrefixRequest)
+    {
+        response->set_error(::executor::v1::ERROR_OUT_OF_COUNTERS);
+    }
+    vector<Response> &responses(executedRequest.fullTracer.finalTrace.responses);
+    for (uint64_t tx=0; tx<responses.size(); tx++)
+    {
+        executor::v1::ProcessTransactionResponse * pProcessTransactionResponse = response->add_responses();
+        setTransactionFields(responses[tx], pProcessTransactionResponse);
+        if (executedRequest.txHashToGenerateExecuteTrace == responses[tx].tx_hash)
+        {
+            for (uint64_t trace=0; trace<responses[tx].call_trace.steps.size(); trace++)
+            {
+                executor::v1::ExecutionTraceStep * pExecutionTraceStep = pProcessTransactionResponse->add_execution_trace();
+                setExecutionTraceStep(responses[tx].call_trace.steps[trace], pExecutionTraceStep);
+                pExecutionTraceStep->set_memory(string2ba(responses[tx].call_trace.steps[trace].memory)); // Content of memory
+                pExecutionTraceStep->set_memory_size(responses[tx].call_trace.steps[trace].memory_size);
+            }
+        }
+        if (executedRequest.txHashToGenerateCallTrace == responses[tx].tx_hash)
+        {
+            executor::v1::CallTrace * pCallTrace = new executor::v1::CallTrace();
+            setCallTraceContext(responses[tx].call_trace.context, pCallTrace);
+            for (uint64_t step=0; step<responses[tx].call_trace.steps.size(); step++)
+            {
+                setTransactionStep(responses[tx].call_trace.steps[step], pCallTrace->add_steps());
+            }
+            pProcessTransactionResponse->set_allocated_call_trace(pCallTrace);
+        }
+    }
+
+
+#ifdef LOG_SERVICE
+    cout << "ExecutorServiceImpl::ProcessBatch() returns:\n" << response->DebugString() << endl;
+#endif
+
+    return Status::OK;
+}
+
+::grpc::Status ExecutorServiceImpl::ProcessBatchStream(::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequest* request, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse>* writer)
+{
+#ifdef LOG_SERVICE
+    cout << "ExecutorServiceImpl::ProcessBatchStream() got request:\n" << request->DebugString() << endl;
+#endif
+
+    // Create and init an instance of ProverRequest
+    ProverRequest proverRequest(fr);
+    proverRequest.init(config);
+
+    // Parse the request into the prover request input
+    ::grpc::Status status = parseRequest(request, proverRequest);
+    if (!status.ok())
+    {
+        return status;
+    }
+
+    // Stream every transaction as soon as the full tracer completes it
+    ExecutorServiceStreamer streamer(*this, proverRequest, context, writer, config.executorStreamChunkSteps, config.executorStreamQueueSize);
+    proverRequest.fullTracer.pListener = &streamer;
+
+    prover.processBatch(&proverRequest);
+
+    proverRequest.fullTracer.pListener = NULL;
+
+    // Wait for the queued transactions to be written, once the executor context has been released
+    bool bWritten = streamer.finish();
+
+    // Let the client know it should retry later, since all executor contexts are in use
+    if (proverRequest.result == ZKR_EXECUTOR_BUSY)
+    {
+        return Status(grpc::StatusCode::RESOURCE_EXHAUSTED, zkresult2string(ZKR_EXECUTOR_BUSY));
+    }
+
+    // If the batch does not fit in the state machines, the transactions already streamed are those
+    // completed before running out of counters; the last message only carries the error and counters
+    if (proverRequest.result == ZKR_SM_MAIN_OUT_OF_COUNTERS)
+    {
+        ::executor::v1::ProcessBatchResponse response;
+        response.set_error(::executor::v1::ERROR_OUT_OF_COUNTERS);
+        response.set_cnt_keccak_hashes(proverRequest.counters.keccakF);
+        response.set_cnt_poseidon_hashes(proverRequest.counters.poseidonG);
+        response.set_cnt_poseidon_paddings(proverRequest.counters.paddingPG);
+        response.set_cnt_mem_aligns(proverRequest.counters.memAlign);
+        response.set_cnt_arithmetics(proverRequest.counters.arith);
+        response.set_cnt_binaries(proverRequest.counters.binary);
+        response.set_cnt_steps(proverRequest.counters.steps);
+        if (!bWritten || !writer->Write(response))
+        {
+            cerr << "Error: ExecutorServiceImpl::ProcessBatchStream() failed writing to the stream, probably closed by the client" << endl;
+            return Status::CANCELLED;
+        }
+        return Status::OK;
+    }
+
+    if (proverRequest.result != ZKR_SUCCESS)
+    {
+        cerr << "Error: ExecutorServiceImpl::ProcessBatchStream() detected proverRequest.result=" << proverRequest.result << "=" << zkresult2string(proverRequest.result) << endl;
+        return Status::CANCELLED;
+    }
+
+    if (!bWritten)
+    {
+        cerr << "Error: ExecutorServiceImpl::ProcessBatchStream() failed writing to the stream, probably closed by the client" << endl;
+        return Status::CANCELLED;
+    }
+
+    // Last message, with the batch fields and no transactions
+    ::executor::v1::ProcessBatchResponse response;
+    setBatchFields(proverRequest, &response);
+    if (!writer->Write(response))
+    {
+        cerr << "Error: ExecutorServiceImpl::ProcessBatchStream() failed writing the last message to the stream" << endl;
+        return Status::CANCELLED;
+    }
+
+#ifdef LOG_SERVICE
+    cout << "ExecutorServiceImpl::ProcessBatchStream() streamed " << streamer.messages << " messages" << endl;
+#endif
+
+    return Status::OK;
+}
+
+::grpc::Status ExecutorServiceImpl::parseRequest (const ::executor::v1::ProcessBatchRequest* request, ProverRequest &proverRequest)
+{
     // Get batchNum
     proverRequest.input.publicInputs.batchNum = request->batch_num();
 
     // Get sequencerAddr
-    proverRequest.input.publicInputs.sequencerAddr = Add0xIfMissing(request->coinbase());
-    if (proverRequest.input.publicInputs.sequencerAddr.size() > (2 + 40))
+    if (Remove0xIfPresent(request->coinbase()).size() > 40)
     {
-        cerr << "Error: ExecutorServiceImpl::ProcessBatch() got sequencer address too long, size=" << proverRequest.input.publicInputs.sequencerAddr.size() << endl;
+        cerr << "Error: ExecutorServiceImpl::parseRequest() got sequencer address too long, size=" << request->coinbase().size() << endl;
         return Status::CANCELLED;
     }
-    cout << "ExecutorServiceImpl::ProcessBatch() got sequencerAddr=" << proverRequest.input.publicInputs.sequencerAddr << endl;
+    string2scalar(request->coinbase(), proverRequest.input.publicInputs.sequencerAddr);
+    cout << "ExecutorServiceImpl::parseRequest() got sequencerAddr=" << proverRequest.input.publicInputs.sequencerAddr.get_str(16) << endl;
 
-    // Get batchL2Data
-    proverRequest.input.batchL2Data = "0x" + ba2string(request->batch_l2_data());
-    cout << "ExecutorServiceImpl::ProcessBatch() got batchL2Data=" << proverRequest.input.batchL2Data << endl;
+    // Get batchL2Data, as raw bytes
+    proverRequest.input.batchL2Data = request->batch_l2_data();
+    cout << "ExecutorServiceImpl::parseRequest() got batchL2Data size=" << proverRequest.input.batchL2Data.size() << endl;
 
     // Get oldStateRoot
-    proverRequest.input.publicInputs.oldStateRoot = "0x" + ba2string(request->old_state_root());
-    if (proverRequest.input.publicInputs.oldStateRoot.size() > (2 + 64))
+    if (request->old_state_root().size() > 32)
     {
-        cerr << "Error: ExecutorServiceImpl::ProcessBatch() got oldStateRoot too long, size=" << proverRequest.input.publicInputs.oldStateRoot.size() << endl;
+        cerr << "Error: ExecutorServiceImpl::parseRequest() got oldStateRoot too long, size=" << request->old_state_root().size() << endl;
         return Status::CANCELLED;
     }
-    cout << "ExecutorServiceImpl::ProcessBatch() got oldStateRoot=" << proverRequest.input.publicInputs.oldStateRoot << endl;
+    ba2scalar((const uint8_t *)request->old_state_root().data(), request->old_state_root().size(), proverRequest.input.publicInputs.oldStateRoot);
+    cout << "ExecutorServiceImpl::parseRequest() got oldStateRoot=" << proverRequest.input.publicInputs.oldStateRoot.get_str(16) << endl;
 
     // Get oldLocalExitRoot
-    proverRequest.input.publicInputs.oldLocalExitRoot = "0x" + ba2string(request->old_local_exit_root());
-    if (proverRequest.input.publicInputs.oldLocalExitRoot.size() > (2 + 64))
+    if (request->old_local_exit_root().size() > 32)
     {
-        cerr << "Error: ExecutorServiceImpl::ProcessBatch() got oldLocalExitRoot too long, size=" << proverRequest.input.publicInputs.oldLocalExitRoot.size() << endl;
+        cerr << "Error: ExecutorServiceImpl::parseRequest() got oldLocalExitRoot too long, size=" << request->old_local_exit_root().size() << endl;
         return Status::CANCELLED;
     }
-    cout << "ExecutorServiceImpl::ProcessBatch() got oldLocalExitRoot=" << proverRequest.input.publicInputs.oldLocalExitRoot << endl;
+    ba2scalar((const uint8_t *)request->old_local_exit_root().data(), request->old_local_exit_root().size(), proverRequest.input.publicInputs.oldLocalExitRoot);
+    cout << "ExecutorServiceImpl::parseRequest() got oldLocalExitRoot=" << proverRequest.input.publicInputs.oldLocalExitRoot.get_str(16) << endl;
 
     // Get globalExitRoot
-    proverRequest.input.globalExitRoot = "0x" + ba2string(request->global_exit_root());
-    if (proverRequest.input.globalExitRoot.size() > (2 + 64))
+    if (request->global_exit_root().size() > 32)
     {
-        cerr << "Error: ExecutorServiceImpl::ProcessBatch() got globalExitRoot too long, size=" << proverRequest.input.globalExitRoot.size() << endl;
+        cerr << "Error: ExecutorServiceImpl::parseRequest() got globalExitRoot too long, size=" << request->global_exit_root().size() << endl;
         return Status::CANCELLED;
     }
-    cout << "ExecutorServiceImpl::ProcessBatch() got globalExitRoot=" << proverRequest.input.globalExitRoot << endl;
+    ba2scalar((const uint8_t *)request->global_exit_root().data(), request->global_exit_root().size(), proverRequest.input.globalExitRoot);
+    cout << "ExecutorServiceImpl::parseRequest() got globalExitRoot=" << proverRequest.input.globalExitRoot.get_str(16) << endl;
 
     // Get timestamp
     proverRequest.input.publicInputs.timestamp = request->eth_timestamp();
-    cout << "ExecutorServiceImpl::ProcessBatch() got timestamp=" << proverRequest.input.publicInputs.timestamp << endl;
+    cout << "ExecutorServiceImpl::parseRequest() got timestamp=" << proverRequest.input.publicInputs.timestamp << endl;
 
     // Get from
-    proverRequest.input.from = Add0xIfMissing(request->from());
-    if (proverRequest.input.from.size() > (2 + 40))
+    if (Remove0xIfPresent(request->from()).size() > 40)
     {
-        cerr << "Error: ExecutorServiceImpl::ProcessBatch() got from too long, size=" << proverRequest.input.from.size() << endl;
+        cerr << "Error: ExecutorServiceImpl::parseRequest() got from too long, size=" << request->from().size() << endl;
         return Status::CANCELLED;
     }
-    cout << "ExecutorServiceImpl::ProcessBatch() got from=" << proverRequest.input.from << endl;
+    string2scalar(request->from(), proverRequest.input.from);
+    cout << "ExecutorServiceImpl::parseRequest() got from=" << proverRequest.input.from.get_str(16) << endl;
 
     // Flags
     proverRequest.bProcessBatch = true;
@@ -85,65 +248,106 @@ using grpc::Status;
     proverRequest.txHashToGenerateCallTrace = "0x" + ba2string(request->tx_hash_to_generate_call_trace());
 
     // Default values
-    proverRequest.input.publicInputs.newLocalExitRoot = "0x0";
-    proverRequest.input.publicInputs.newStateRoot = "0x0";
+    proverRequest.input.publicInputs.newLocalExitRoot = 0;
+    proverRequest.input.publicInputs.newStateRoot = 0;
 
-    // Parse db map
-    google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> > db;
-    db = request->db();
-    google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> >::iterator it;
+    // Parse db map, reading the request values in place
+    const google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> > &db = request->db();
+    google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> >::const_iterator it;
     for (it=db.begin(); it!=db.end(); it++)
     {
-        vector<Goldilocks::Element> dbValue;
-        string concatenatedValues = it->second;
-        if (concatenatedValues.size()%64!=0)
+        if (it->second.size()%64!=0)
         {
-            cerr << "Error: ExecutorServiceImpl::ProcessBatch() found invalid db value size: " << concatenatedValues.size() << endl;
+            cerr << "Error: ExecutorServiceImpl::parseRequest() found invalid db value size: " << it->second.size() << endl;
             return Status::CANCELLED;
         }
-        for (uint64_t i=0; i<concatenatedValues.size(); i+=16)
-        {
-            Goldilocks::Element fe;
-            string2fe(fr, concatenatedValues.substr(i, 16), fe);
-            dbValue.push_back(fe);
-        }
-        Goldilocks::Element fe;
-        string2fe(fr, it->first, fe);
-        proverRequest.input.db[it->first] = dbValue;
+        string2fea(fr, it->second, proverRequest.input.db[it->first]);
 #ifdef LOG_RPC_INPUT
         //cout << "input.db[" << it->first << "]: " << proverRequest.input.db[it->first] << endl;
 #endif
     }
 
-    // Parse contracts data
-    google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> > contractsBytecode;
-    contractsBytecode = request->contracts_bytecode();
-    google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> >::iterator itp;
+    // Parse contracts data, decoding every bytecode directly into the input
+    const google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> > &contractsBytecode = request->contracts_bytecode();
+    google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> >::const_iterator itp;
     for (itp=contractsBytecode.begin(); itp!=contractsBytecode.end(); itp++)
     {
-        vector<uint8_t> dbValue;
-        string contractValue = string2ba(itp->second);
-        for (uint64_t i=0; i<contractValue.size(); i++)
-        {
-            dbValue.push_back(contractValue.at(i));
-        }
-        proverRequest.input.contractsBytecode[itp->first] = dbValue;
+        string2ba(itp->second, proverRequest.input.contractsBytecode[itp->first]);
 #ifdef LOG_RPC_INPUT
         //cout << "proverRequest.input.contractsBytecode[" << itp->first << "]: " << itp->second << endl;
 #endif
-    }     
+    }
 
     // Preprocess the transactions
     proverRequest.input.preprocessTxs();
 
-    prover.processBatch(&proverRequest);
+    return Status::OK;
+}
 
-    if (proverRequest.result != ZKR_SUCCESS)
+::grpc::Status ExecutorServiceImpl::processBatchPrefix (const ::executor::v1::ProcessBatchRequest* request, uint64_t maxTxs, unique_ptr<ProverRequest> &pPrefixRequest)
+{
+    vector<uint64_t> txsEnds;
+    if (!getBatchTxsEnds(request->batch_l2_data(), txsEnds))
     {
-        cerr << "Error: ExecutorServiceImpl::ProcessBatch() detected proverRequest.result=" << proverRequest.result << "=" << zkresult2string(proverRequest.result) << endl;
+        cerr << "Error: ExecutorServiceImpl::processBatchPrefix() failed splitting batchL2Data into transactions" << endl;
         return Status::CANCELLED;
     }
-    
+
+    // Usually the transactions completed before running out of counters fit, but the batch
+    // finalization also uses counters, so if they do not, binary search the longest prefix that fits;
+    // every try executes the whole prefix again, so at most log2(maxTxs) + 2 executions are done
+    uint64_t low = 0; // longest prefix known to fit, once pPrefixRequest is set
+    uint64_t high = (maxTxs < txsEnds.size()) ? maxTxs : txsEnds.size(); // longest prefix that may fit
+    uint64_t txs = high;
+    pPrefixRequest.reset();
+    while (true)
+    {
+        cout << "ExecutorServiceImpl::processBatchPrefix() executing the first " << txs << " of " << txsEnds.size() << " transactions" << endl;
+
+        unique_ptr<ProverRequest> pRequest(new ProverRequest(fr));
+        pRequest->init(config);
+        ::grpc::Status status = parseRequest(request, *pRequest);
+        if (!status.ok())
+        {
+            return status;
+        }
+        pRequest->input.batchL2Data.resize((txs > 0) ? txsEnds[txs - 1] : 0);
+        pRequest->input.preprocessTxs();
+
+        prover.processBatch(pRequest.get());
+
+        if (pRequest->result == ZKR_EXECUTOR_BUSY)
+        {
+            return Status(grpc::StatusCode::RESOURCE_EXHAUSTED, zkresult2string(ZKR_EXECUTOR_BUSY));
+        }
+
+        // Without transactions there is nothing shorter to try, so return whatever the result is
+        if ((pRequest->result == ZKR_SM_MAIN_OUT_OF_COUNTERS) && (txs == 0))
+        {
+            pPrefixRequest = move(pRequest);
+            return Status::OK;
+        }
+
+        // Narrow the range, keeping the longest prefix that fits so far
+        if (pRequest->result != ZKR_SM_MAIN_OUT_OF_COUNTERS)
+        {
+            low = txs;
+            pPrefixRequest = move(pRequest);
+        }
+        else
+        {
+            high = txs - 1;
+        }
+        if (pPrefixRequest && (low == high))
+        {
+            return Status::OK;
+        }
+        txs = (low + high + 1) / 2;
+    }
+}
+
+void ExecutorServiceImpl::setBatchFields (ProverRequest &proverRequest, ::executor::v1::ProcessBatchResponse* response)
+{
     response->set_cumulative_gas_used(proverRequest.fullTracer.finalTrace.cumulative_gas_used);
     response->set_cnt_keccak_hashes(proverRequest.counters.keccakF);
     response->set_cnt_poseidon_hashes(proverRequest.counters.poseidonG);
@@ -154,108 +358,275 @@ using grpc::Status;
     response->set_cnt_steps(proverRequest.counters.steps);
     response->set_new_state_root(string2ba(proverRequest.fullTracer.finalTrace.new_state_root));
     response->set_new_local_exit_root(string2ba(proverRequest.fullTracer.finalTrace.new_local_exit_root));
-    vector<Response> &responses(proverRequest.fullTracer.finalTrace.responses);
-    for (uint64_t tx=0; tx<responses.size(); tx++)
+}
+
+void ExecutorServiceImpl::setTransactionFields (Response &response, ::executor::v1::ProcessTransactionResponse* pProcessTransactionResponse)
+{
+    pProcessTransactionResponse->set_tx_hash(string2ba(response.tx_hash));
+    pProcessTransactionResponse->set_type(response.type); // Type indicates legacy transaction; it will be always 0 (legacy) in the executor
+    pProcessTransactionResponse->set_return_value(string2ba(response.return_value)); // Returned data from the runtime (function result or data supplied with revert opcode)
+    pProcessTransactionResponse->set_gas_left(response.gas_left); // Total gas left as result of execution
+    pProcessTransactionResponse->set_gas_used(response.gas_used); // Total gas used as result of execution or gas estimation
+    pProcessTransactionResponse->set_gas_refunded(response.gas_refunded); // Total gas refunded as result of execution
+    pProcessTransactionResponse->set_error(string2error(response.error)); // Any error encountered during the execution
+    pProcessTransactionResponse->set_create_address(response.create_address); // New SC Address in case of SC creation
+    pProcessTransactionResponse->set_state_root(string2ba(response.state_root));
+    pProcessTransactionResponse->set_unprocessed_transaction(response.unprocessed_transaction); // Indicates if this tx didn't fit into the batch
+    for (uint64_t log=0; log<response.logs.size(); log++)
     {
-        executor::v1::ProcessTransactionResponse * pProcessTransactionResponse = response->add_responses();
-        pProcessTransactionResponse->set_tx_hash(string2ba(responses[tx].tx_hash));
-        pProcessTransactionResponse->set_type(responses[tx].type); // Type indicates legacy transaction; it will be always 0 (legacy) in the executor
-        pProcessTransactionResponse->set_return_value(string2ba(responses[tx].return_value)); // Returned data from the runtime (function result or data supplied with revert opcode)
-        pProcessTransactionResponse->set_gas_left(responses[tx].gas_left); // Total gas left as result of execution
-        pProcessTransactionResponse->set_gas_used(responses[tx].gas_used); // Total gas used as result of execution or gas estimation
-        pProcessTransactionResponse->set_gas_refunded(responses[tx].gas_refunded); // Total gas refunded as result of execution
-        pProcessTransactionResponse->set_error(string2error(responses[tx].error)); // Any error encountered during the execution
-        pProcessTransactionResponse->set_create_address(responses[tx].create_address); // New SC Address in case of SC creation
-        pProcessTransactionResponse->set_state_root(string2ba(responses[tx].state_root));
-        pProcessTransactionResponse->set_unprocessed_transaction(responses[tx].unprocessed_transaction); // Indicates if this tx didn't fit into the batch
-        for (uint64_t log=0; log<responses[tx].logs.size(); log++)
+        executor::v1::Log * pLog = pProcessTransactionResponse->add_logs();
+        pLog->set_address(response.logs[log].address); // Address of the contract that generated the event
+        for (uint64_t topic=0; topic<response.logs[log].topics.size(); topic++)
         {
-            executor::v1::Log * pLog = pProcessTransactionResponse->add_logs();
-            pLog->set_address(responses[tx].logs[log].address); // Address of the contract that generated the event
-            for (uint64_t topic=0; topic<responses[tx].logs[log].topics.size(); topic++)
-            {
-                std::string * pTopic = pLog->add_topics();
-                *pTopic = string2ba(responses[tx].logs[log].topics[topic]); // List of topics provided by the contract
-            }
-            // data is a vector of strings :(
-            //pLog->set_data(string2ba(responses[tx].logs[log].data[0])); // Supplied by the contract, usually ABI-encoded // TODO: Replace by real data
-            pLog->set_batch_number(responses[tx].logs[log].batch_number); // Batch in which the transaction was included
-            pLog->set_tx_hash(string2ba(responses[tx].logs[log].tx_hash)); // Hash of the transaction
-            pLog->set_tx_index(responses[tx].logs[log].tx_index); // Index of the transaction in the block
-            pLog->set_batch_hash(string2ba(responses[tx].logs[log].batch_hash)); // Hash of the batch in which the transaction was included
-            pLog->set_index(responses[tx].logs[log].index); // Index of the log in the block
+            std::string * pTopic = pLog->add_topics();
+            *pTopic = string2ba(response.logs[log].topics[topic]); // List of topics provided by the contract
         }
-        if (proverRequest.txHashToGenerateExecuteTrace == responses[tx].tx_hash)
+        // data is a vector of strings :(
+        //pLog->set_data(string2ba(response.logs[log].data[0])); // Supplied by the contract, usually ABI-encoded // TODO: Replace by real data
+        pLog->set_batch_number(response.logs[log].batch_number); // Batch in which the transaction was included
+        pLog->set_tx_hash(string2ba(response.logs[log].tx_hash)); // Hash of the transaction
+        pLog->set_tx_index(response.logs[log].tx_index); // Index of the transaction in the block
+        pLog->set_batch_hash(string2ba(response.logs[log].batch_hash)); // Hash of the batch in which the transaction was included
+        pLog->set_index(response.logs[log].index); // Index of the log in the block
+    }
+}
+
+void ExecutorServiceImpl::setExecutionTraceStep (Opcode &step, ::executor::v1::ExecutionTraceStep * pExecutionTraceStep)
+{
+    pExecutionTraceStep->set_pc(step.pc); // Program Counter
+    pExecutionTraceStep->set_op(step.opcode); // OpCode
+    pExecutionTraceStep->set_remaining_gas(0);
+    pExecutionTraceStep->set_gas_cost(step.gasCost); // Gas cost of the operation
+    for (uint64_t stack=0; stack<step.stack.size() ; stack++)
+        pExecutionTraceStep->add_stack(step.stack[stack]); // Content of the stack
+    //pExecutionTraceStep->set_return_data(string2ba(step.return_data[0])); TODO
+    google::protobuf::Map<std::string, std::string>  * pStorage = pExecutionTraceStep->mutable_storage();
+    map<string,string>::iterator it;
+    for (it=step.storage.begin(); it!=step.storage.end(); it++)
+        (*pStorage)[it->first] = it->second; // Content of the storage
+    pExecutionTraceStep->set_depth(step.depth); // Call depth
+    pExecutionTraceStep->set_gas_refund(step.refund);
+    pExecutionTraceStep->set_error(string2error(step.error));
+}
+
+void ExecutorServiceImpl::setCallTraceContext (TxTraceContext &context, ::executor::v1::CallTrace * pCallTrace)
+{
+    executor::v1::TransactionContext * pTransactionContext = pCallTrace->mutable_context();
+    pTransactionContext->set_type(context.type); // "CALL" or "CREATE"
+    pTransactionContext->set_from(context.from); // Sender of the transaction
+    pTransactionContext->set_to(context.to); // Target of the transaction
+    pTransactionContext->set_data(string2ba(context.data)); // Input data of the transaction
+    pTransactionContext->set_gas(context.gas);
+    pTransactionContext->set_gas_price(context.gasPrice);
+    pTransactionContext->set_value(context.value);
+    pTransactionContext->set_batch(string2ba(context.batch)); // Hash of the batch in which the transaction was included
+    pTransactionContext->set_output(string2ba(context.output)); // Returned data from the runtime (function result or data supplied with revert opcode)
+    pTransactionContext->set_gas_used(context.gas_used); // Total gas used as result of execution
+    pTransactionContext->set_execution_time(context.execution_time);
+    pTransactionContext->set_old_state_root(string2ba(context.old_state_root)); // Starting state root
+}
+
+void ExecutorServiceImpl::setTransactionStep (Opcode &step, ::executor::v1::TransactionStep * pTransactionStep)
+{
+    pTransactionStep->set_state_root(string2ba(step.state_root));
+    pTransactionStep->set_depth(step.depth); // Call depth
+    pTransactionStep->set_pc(step.pc); // Program counter
+    pTransactionStep->set_gas(step.remaining_gas); // Remaining gas
+    pTransactionStep->set_gas_cost(step.gasCost); // Gas cost of the operation
+    pTransactionStep->set_gas_refund(step.refund); // Gas refunded during the operation
+    pTransactionStep->set_op(step.op); // Opcode
+    //for (uint64_t stack=0; stack<3; stack++)
+    //    pTransactionStep->add_stack(0); // Content of the stack   TODO
+    pTransactionStep->set_memory(string2ba(step.memory)); // Content of the memory
+    //pTransactionStep->set_return_data(string2ba(step.return_data[0])); // TODO
+    executor::v1::Contract * pContract = pTransactionStep->mutable_contract(); // Contract information
+    pContract->set_address(step.contract.address);
+    pContract->set_caller(step.contract.caller);
+    pContract->set_value(step.contract.value);
+    pContract->set_data(string2ba(step.contract.data));
+    pContract->set_gas(step.contract.gas);
+    pTransactionStep->set_error(string2error(step.error));
+}
+
+ExecutorServiceStreamer::ExecutorServiceStreamer (ExecutorServiceImpl &service, ProverRequest &proverRequest, ::grpc::ServerContext * context, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse> * writer, uint64_t chunkSteps, uint64_t queueSize) :
+    service(service),
+    proverRequest(proverRequest),
+    context(context),
+    writer(writer),
+    chunkSteps(chunkSteps),
+    queueSize(zkmax(queueSize, 1)),
+    bStop(false),
+    bStarted(true),
+    bWriteFailed(false),
+    messages(0)
+{
+    pthread_mutex_init(&writeQueueMutex, NULL);
+    pthread_cond_init(&writeQueueCond, 0);
+    pthread_create(&writeThread, NULL, executorServiceStreamerThread, this);
+}
+
+ExecutorServiceStreamer::~ExecutorServiceStreamer ()
+{
+    // Stop the thread before destroying what it waits on
+    finish();
+
+    pthread_mutex_destroy(&writeQueueMutex);
+    pthread_cond_destroy(&writeQueueCond);
+}
+
+bool ExecutorServiceStreamer::finish (void)
+{
+    if (bStarted)
+    {
+        pthread_mutex_lock(&writeQueueMutex);
+        bStop = true;
+        pthread_cond_signal(&writeQueueCond);
+        pthread_mutex_unlock(&writeQueueMutex);
+        pthread_join(writeThread, NULL);
+        bStarted = false;
+    }
+    return !bWriteFailed;
+}
+
+bool ExecutorServiceStreamer::isCancelled (void)
+{
+    pthread_mutex_lock(&writeQueueMutex);
+    bool bFailed = bWriteFailed;
+    pthread_mutex_unlock(&writeQueueMutex);
+    return bFailed || context->IsCancelled();
+}
+
+void ExecutorServiceStreamer::processWriteQueue (void)
+{
+    while (true)
+    {
+        pthread_mutex_lock(&writeQueueMutex);
+
+        // Wait for new messages to write, if there are no more pending messages
+        while ((writeQueue.size() == 0) && !bStop)
         {
-            for (uint64_t trace=0; trace<responses[tx].call_trace.steps.size(); trace++)
+            pthread_cond_wait(&writeQueueCond, &writeQueueMutex);
+        }
+
+        // Once stopped, return when all the pending messages have been written
+        if (writeQueue.size() == 0)
+        {
+            pthread_mutex_unlock(&writeQueueMutex);
+            break;
+        }
+
+        ::executor::v1::ProcessBatchResponse message = std::move(writeQueue.front());
+        writeQueue.pop_front();
+        pthread_mutex_unlock(&writeQueueMutex);
+
+        if (!writer->Write(message))
+        {
+            // The stream is broken, so discard the pending messages
+            pthread_mutex_lock(&writeQueueMutex);
+            bWriteFailed = true;
+            writeQueue.clear();
+            pthread_mutex_unlock(&writeQueueMutex);
+            continue;
+        }
+        messages++;
+    }
+}
+
+void* executorServiceStreamerThread (void* arg)
+{
+    ExecutorServiceStreamer * pStreamer = (ExecutorServiceStreamer *)arg;
+    pStreamer->processWriteQueue();
+    return NULL;
+}
+
+void ExecutorServiceStreamer::onFinishTx (Response &response)
+{
+    // Once the stream is broken, the transactions are not sent any more
+    if (isCancelled())
+    {
+        vector<Opcode>().swap(response.call_trace.steps);
+        vector<Opcode>().swap(response.execution_trace);
+        return;
+    }
+
+    bool bExecuteTrace = (proverRequest.txHashToGenerateExecuteTrace == response.tx_hash);
+    bool bCallTrace = (proverRequest.txHashToGenerateCallTrace == response.tx_hash);
+    vector<Opcode> &steps = response.call_trace.steps;
+    uint64_t chunk = zkmax(chunkSteps, 1);
+    string previousMemory; // Execution trace memory of the previous step, as raw bytes
+
+    // Send one message per chunk of steps; the first one also carries all the transaction fields
+    uint64_t offset = 0;
+    do
+    {
+        ::executor::v1::ProcessBatchResponse message;
+        executor::v1::ProcessTransactionResponse * pProcessTransactionResponse = message.add_responses();
+        if (offset == 0)
+        {
+            service.setTransactionFields(response, pProcessTransactionResponse);
+        }
+        else
+        {
+            pProcessTransactionResponse->set_tx_hash(string2ba(response.tx_hash));
+        }
+
+        uint64_t end = zkmin(offset + chunk, steps.size());
+        if (bExecuteTrace)
+        {
+            for (uint64_t step=offset; step<end; step++)
             {
                 executor::v1::ExecutionTraceStep * pExecutionTraceStep = pProcessTransactionResponse->add_execution_trace();
-                pExecutionTraceStep->set_pc(responses[tx].call_trace.steps[trace].pc); // Program Counter
-                pExecutionTraceStep->set_op(responses[tx].call_trace.steps[trace].opcode); // OpCode
-                pExecutionTraceStep->set_remaining_gas(0);
-                pExecutionTraceStep->set_gas_cost(responses[tx].call_trace.steps[trace].gasCost); // Gas cost of the operation
-                pExecutionTraceStep->set_memory(string2ba(responses[tx].call_trace.steps[trace].memory)); // Content of memory
-                pExecutionTraceStep->set_memory_size(responses[tx].call_trace.steps[trace].memory_size);
-                for (uint64_t stack=0; stack<responses[tx].call_trace.steps[trace].stack.size() ; stack++)
-                    pExecutionTraceStep->add_stack(responses[tx].call_trace.steps[trace].stack[stack]); // Content of the stack
-                //pExecutionTraceStep->set_return_data(string2ba(responses[tx].call_trace.steps[trace].return_data[0])); TODO
-                google::protobuf::Map<std::string, std::string>  * pStorage = pExecutionTraceStep->mutable_storage();
-                map<string,string>::iterator it;
-                for (it=responses[tx].call_trace.steps[trace].storage.begin(); it!=responses[tx].call_trace.steps[trace].storage.end(); it++)
-                    (*pStorage)[it->first] = it->second; // Content of the storage
-                pExecutionTraceStep->set_depth(responses[tx].call_trace.steps[trace].depth); // Call depth
-                pExecutionTraceStep->set_gas_refund(responses[tx].call_trace.steps[trace].refund);
-                pExecutionTraceStep->set_error(string2error(responses[tx].call_trace.steps[trace].error));
+                service.setExecutionTraceStep(steps[step], pExecutionTraceStep);
+
+                // Send only the memory bytes from the first one that changed since the previous step
+                string memory = string2ba(steps[step].memory);
+                uint64_t common = 0;
+                uint64_t maxCommon = zkmin(memory.size(), previousMemory.size());
+                while ((common < maxCommon) && (memory[common] == previousMemory[common])) common++;
+                pExecutionTraceStep->set_memory(memory.substr(common));
+                pExecutionTraceStep->set_memory_size(memory.size());
+                previousMemory.swap(memory);
             }
         }
-        if (proverRequest.txHashToGenerateCallTrace == responses[tx].tx_hash)
+        if (bCallTrace)
         {
-            executor::v1::CallTrace * pCallTrace = new executor::v1::CallTrace();
-            executor::v1::TransactionContext * pTransactionContext = pCallTrace->mutable_context();
-            pTransactionContext->set_type(responses[tx].call_trace.context.type); // "CALL" or "CREATE"
-            pTransactionContext->set_from(responses[tx].call_trace.context.from); // Sender of the transaction
-            pTransactionContext->set_to(responses[tx].call_trace.context.to); // Target of the transaction
-            pTransactionContext->set_data(string2ba(responses[tx].call_trace.context.data)); // Input data of the transaction
-            pTransactionContext->set_gas(responses[tx].call_trace.context.gas);
-            pTransactionContext->set_gas_price(responses[tx].call_trace.context.gasPrice);
-            pTransactionContext->set_value(responses[tx].call_trace.context.value);
-            pTransactionContext->set_batch(string2ba(responses[tx].call_trace.context.batch)); // Hash of the batch in which the transaction was included
-            pTransactionContext->set_output(string2ba(responses[tx].call_trace.context.output)); // Returned data from the runtime (function result or data supplied with revert opcode)
-            pTransactionContext->set_gas_used(responses[tx].call_trace.context.gas_used); // Total gas used as result of execution
-            pTransactionContext->set_execution_time(responses[tx].call_trace.context.execution_time);
-            pTransactionContext->set_old_state_root(string2ba(responses[tx].call_trace.context.old_state_root)); // Starting state root
-            for (uint64_t step=0; step<responses[tx].call_trace.steps.size(); step++)
+            executor::v1::CallTrace * pCallTrace = pProcessTransactionResponse->mutable_call_trace();
+            if (offset == 0)
             {
-                executor::v1::TransactionStep * pTransactionStep = pCallTrace->add_steps();
-                pTransactionStep->set_state_root(string2ba(responses[tx].call_trace.steps[step].state_root));
-                pTransactionStep->set_depth(responses[tx].call_trace.steps[step].depth); // Call depth
-                pTransactionStep->set_pc(responses[tx].call_trace.steps[step].pc); // Program counter
-                pTransactionStep->set_gas(responses[tx].call_trace.steps[step].remaining_gas); // Remaining gas
-                pTransactionStep->set_gas_cost(responses[tx].call_trace.steps[step].gasCost); // Gas cost of the operation
-                pTransactionStep->set_gas_refund(responses[tx].call_trace.steps[step].refund); // Gas refunded during the operation
-                pTransactionStep->set_op(responses[tx].call_trace.steps[step].op); // Opcode
-                //for (uint64_t stack=0; stack<3; stack++)
-                //    pTransactionStep->add_stack(0); // Content of the stack   TODO
-                pTransactionStep->set_memory(string2ba(responses[tx].call_trace.steps[step].memory)); // Content of the memory
-                //pTransactionStep->set_return_data(string2ba(responses[tx].call_trace.steps[step].return_data[0])); // TODO
-                executor::v1::Contract * pContract = pTransactionStep->mutable_contract(); // Contract information
-                pContract->set_address(responses[tx].call_trace.steps[step].contract.address);
-                pContract->set_caller(responses[tx].call_trace.steps[step].contract.caller);
-                pContract->set_value(responses[tx].call_trace.steps[step].contract.value);
-                pContract->set_data(string2ba(responses[tx].call_trace.steps[step].contract.data));
-                pContract->set_gas(responses[tx].call_trace.steps[step].contract.gas);
-                pTransactionStep->set_error(string2error(responses[tx].call_trace.steps[step].error));
+                service.setCallTraceContext(response.call_trace.context, pCallTrace);
+            }
+            for (uint64_t step=offset; step<end; step++)
+            {
+                service.setTransactionStep(steps[step], pCallTrace->add_steps());
             }
-            pProcessTransactionResponse->set_allocated_call_trace(pCallTrace);
         }
-    }
 
+        // Queue the message for the write thread; if the client cannot keep up, cancel the execution
+        // rather than buffering without limit
+        pthread_mutex_lock(&writeQueueMutex);
+        if (!bWriteFailed)
+        {
+            if (writeQueue.size() >= queueSize)
+            {
+                cerr << "Error: ExecutorServiceStreamer::onFinishTx() found write queue full with " << writeQueue.size() << " messages, the client is too slow" << endl;
+                bWriteFailed = true;
+                writeQueue.clear();
+            }
+            else
+            {
+                writeQueue.push_back(std::move(message));
+                pthread_cond_signal(&writeQueueCond);
+            }
+        }
+        bool bFailed = bWriteFailed;
+        pthread_mutex_unlock(&writeQueueMutex);
+        if (bFailed) break;
+        offset = end;
+    } while (offset < steps.size());
 
-#ifdef LOG_SERVICE
-    cout << "ExecutorServiceImpl::ProcessBatch() returns:\n" << response->DebugString() << endl;
-#endif
-
-    return Status::OK;
+    // The steps are not needed any more, so release their memory
+    vector<Opcode>().swap(response.call_trace.steps);
+    vector<Opcode>().swap(response.execution_trace);
 }
 
 ::executor::v1::Error ExecutorServiceImpl::string2error (string &errorString)
@@ -1,11 +1,15 @@
 #ifndef EXECUTOR_SERVICE_HPP
 #define EXECUTOR_SERVICE_HPP
 
+#include <memory>
+#include <list>
+#include <pthread.h>
 #include "grpc/gen/executor.grpc.pb.h"
 #include "proof.hpp"
 #include "goldilocks_base_field.hpp"
 #include "prover.hpp"
 #include "config.hpp"
+#include "full_tracer.hpp"
 
 class ExecutorServiceImpl final : public executor::v1::ExecutorService::Service
 {
@@ -15,7 +19,69 @@ class ExecutorServiceImpl final : public executor::v1::ExecutorService::Service
 public:
     ExecutorServiceImpl (Goldilocks &fr, Config &config, Prover &prover) : fr(fr), config(config), prover(prover) {};
     ::grpc::Status ProcessBatch (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequest* request, ::executor::v1::ProcessBatchResponse* response) override;
+    ::grpc::Status ProcessBatchStream (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequest* request, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse>* writer) override;
     ::executor::v1::Error string2error (string &errorString);
+
+    // Request parsing and response building, shared by the unary and the streaming versions
+    ::grpc::Status parseRequest (const ::executor::v1::ProcessBatchRequest* request, ProverRequest &proverRequest);
+    ::grpc::Status processBatchPrefix (const ::executor::v1::ProcessBatchRequest* request, uint64_t maxTxs, unique_ptr<ProverRequest> &pPrefixRequest); // Longest prefix of up to maxTxs transactions that fits
+    void setBatchFields (ProverRequest &proverRequest, ::executor::v1::ProcessBatchResponse* response);
+    void setTransactionFields (Response &response, ::executor::v1::ProcessTransactionResponse* pProcessTransactionResponse); // All but the traces
+    void setExecutionTraceStep (Opcode &step, ::executor::v1::ExecutionTraceStep * pExecutionTraceStep); // All but the memory
+    void setCallTraceContext (TxTraceContext &context, ::executor::v1::CallTrace * pCallTrace);
+    void setTransactionStep (Opcode &step, ::executor::v1::TransactionStep * pTransactionStep);
+};
+
+// Service registered by the async server: ProcessBatch is asynchronous, and processed by the async
+// server worker threads, while ProcessBatchStream stays synchronous; both use the same implementation
+class ExecutorAsyncServiceImpl final : public executor::v1::ExecutorService::WithAsyncMethod_ProcessBatch<executor::v1::ExecutorService::Service>
+{
+    ExecutorServiceImpl &service;
+public:
+    ExecutorAsyncServiceImpl (ExecutorServiceImpl &service) : service(service) {};
+    ::grpc::Status ProcessBatchStream (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequest* request, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse>* writer) override
+    {
+        return service.ProcessBatchStream(context, request, writer);
+    };
 };
 
+// Streams every transaction to the ProcessBatchStream writer as soon as it has been traced, in
+// messages of up to chunkSteps trace steps, and then frees its steps
+// The messages are queued and written by a dedicated thread, so that a slow client does not stall
+// the executor context; the execution is cancelled if the client is gone, a write fails, or the
+// client is so slow that more than queueSize messages are pending
+class ExecutorServiceStreamer : public FullTracerListener
+{
+    ExecutorServiceImpl &service;
+    ProverRequest &proverRequest;
+    ::grpc::ServerContext * context;
+    ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse> * writer;
+    uint64_t chunkSteps;
+    uint64_t queueSize;
+
+    list< ::executor::v1::ProcessBatchResponse > writeQueue; // Messages pending to be written, oldest first
+    pthread_t writeThread;
+    pthread_mutex_t writeQueueMutex; // Mutex to protect writeQueue, bStop and bWriteFailed
+    pthread_cond_t writeQueueCond; // Cond to signal when queue has new items, or the thread must stop
+    bool bStop; // Set by finish(); the thread writes the pending messages and then returns
+    bool bStarted; // The write thread is running, until finish() joins it
+    bool bWriteFailed; // Set if a write failed, e.g. because the client closed the stream, or the queue overflowed
+
+public:
+    uint64_t messages; // Number of messages written
+    ExecutorServiceStreamer (ExecutorServiceImpl &service, ProverRequest &proverRequest, ::grpc::ServerContext * context, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponse> * writer, uint64_t chunkSteps, uint64_t queueSize);
+    ~ExecutorServiceStreamer();
+
+    void onFinishTx (Response &response) override;
+    bool isCancelled (void) override;
+
+    // Waits until all the queued messages have been written; returns false if any write failed
+    bool finish (void);
+
+    // Writes the queued messages to the stream, in the background thread, until finish() is called
+    void processWriteQueue (void);
+};
+
+void* executorServiceStreamerThread (void* arg);
+
 #endif
\ No newline at end of file
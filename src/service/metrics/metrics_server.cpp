@@ -0,0 +1,94 @@
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <unistd.h>
+#include <string.h>
+#include "metrics_server.hpp"
+#include "metrics.hpp"
+#include "utils.hpp"
+
+void MetricsServer::run (void)
+{
+    int serverSocket = socket(AF_INET, SOCK_STREAM, 0);
+    if (serverSocket < 0)
+    {
+        cerr << "Error: MetricsServer::run() failed calling socket() errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+
+    int reuse = 1;
+    setsockopt(serverSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(config.metricsServerPort);
+    if (bind(serverSocket, (struct sockaddr *)&address, sizeof(address)) < 0)
+    {
+        cerr << "Error: MetricsServer::run() failed calling bind() port=" << config.metricsServerPort << " errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+    if (listen(serverSocket, 16) < 0)
+    {
+        cerr << "Error: MetricsServer::run() failed calling listen() errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+
+    cout << "Metrics server listening on 0.0.0.0:" << config.metricsServerPort << endl;
+
+    // Serve one request per connection, sequentially; exports are cheap and infrequent
+    while (true)
+    {
+        int clientSocket = accept(serverSocket, NULL, NULL);
+        if (clientSocket < 0)
+        {
+            cerr << "Error: MetricsServer::run() failed calling accept() errno=" << errno << "=" << strerror(errno) << endl;
+            continue;
+        }
+
+        // Do not let a silent client block the server
+        struct timeval timeout = {5, 0};
+        setsockopt(clientSocket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+        // Read the request line; the rest of the request is ignored
+        char request[1024];
+        ssize_t requestSize = recv(clientSocket, request, sizeof(request)-1, 0);
+        string response;
+        if ((requestSize >= 4) && (memcmp(request, "GET ", 4) == 0))
+        {
+            string body = metrics.toText();
+            response = "HTTP/1.1 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: " + to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+        }
+        else
+        {
+            response = "HTTP/1.1 405 Method Not Allowed\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+        }
+
+        // Send the whole response
+        uint64_t sent = 0;
+        while (sent < response.size())
+        {
+            ssize_t result = send(clientSocket, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+            if (result <= 0) break;
+            sent += result;
+        }
+        close(clientSocket);
+    }
+}
+
+void MetricsServer::runThread (void)
+{
+    pthread_create(&t, NULL, metricsServerThread, this);
+}
+
+void MetricsServer::waitForThread (void)
+{
+    pthread_join(t, NULL);
+}
+
+void* metricsServerThread (void* arg)
+{
+    MetricsServer *pMetricsServer = (MetricsServer *)arg;
+    pMetricsServer->run();
+    return NULL;
+}
@@ -0,0 +1,20 @@
+#ifndef METRICS_SERVER_HPP
+#define METRICS_SERVER_HPP
+
+#include "config.hpp"
+
+// Minimal HTTP server that returns the metrics registry in Prometheus text format to any GET request
+class MetricsServer
+{
+    Config &config;
+    pthread_t t;
+public:
+    MetricsServer(Config &config) : config(config) {};
+    void run (void);
+    void runThread (void);
+    void waitForThread (void);
+};
+
+void* metricsServerThread(void* arg);
+
+#endif
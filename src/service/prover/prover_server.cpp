@@ -6,6 +6,7 @@
 #include "config.hpp"
 #include "prover_server.hpp"
 #include "prover_service.hpp"
+#include "async_server.hpp"
 
 using grpc::Server;
 using grpc::ServerBuilder;
@@ -25,6 +26,12 @@ void ZkServer::run (void)
     // Listen on the given address without any authentication mechanism.
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
 
+    if (config.asyncServers)
+    {
+        runAsync(builder, service);
+        return;
+    }
+
     // Register "service" as the instance through which we'll communicate with
     // clients. In this case it corresponds to an *synchronous* service.
     builder.RegisterService(&service);
@@ -39,6 +46,27 @@ void ZkServer::run (void)
     server->Wait();
 }
 
+void ZkServer::runAsync (ServerBuilder &builder, ZKProverServiceImpl &service)
+{
+    ZKProverAsyncServiceImpl asyncService(service);
+    AsyncServer asyncServer("PROVER_SERVER", config);
+    builder.RegisterService(&asyncService);
+    asyncServer.addCompletionQueues(builder);
+    std::unique_ptr<Server> server(builder.BuildAndStart());
+
+    asyncUnaryMethod<ZKProverAsyncServiceImpl, zkprover::v1::GetStatusRequest, zkprover::v1::GetStatusResponse>(asyncServer, asyncService, &ZKProverAsyncServiceImpl::RequestGetStatus,
+        [&service](ServerContext* context, const zkprover::v1::GetStatusRequest* request, zkprover::v1::GetStatusResponse* response) { return service.GetStatus(context, request, response); });
+    asyncUnaryMethod<ZKProverAsyncServiceImpl, zkprover::v1::GenProofRequest, zkprover::v1::GenProofResponse>(asyncServer, asyncService, &ZKProverAsyncServiceImpl::RequestGenProof,
+        [&service](ServerContext* context, const zkprover::v1::GenProofRequest* request, zkprover::v1::GenProofResponse* response) { return service.GenProof(context, request, response); });
+    asyncUnaryMethod<ZKProverAsyncServiceImpl, zkprover::v1::CancelRequest, zkprover::v1::CancelResponse>(asyncServer, asyncService, &ZKProverAsyncServiceImpl::RequestCancel,
+        [&service](ServerContext* context, const zkprover::v1::CancelRequest* request, zkprover::v1::CancelResponse* response) { return service.Cancel(context, request, response); });
+
+    std::cout << "zkProver async server listening on 0.0.0.0:" << config.proverServerPort << std::endl;
+
+    // Serve until the queues are shut down
+    asyncServer.run();
+}
+
 void ZkServer::runThread (void)
 {
     pthread_create(&t, NULL, proverServerThread, this);
@@ -4,6 +4,9 @@
 #include "goldilocks_base_field.hpp"
 #include "prover.hpp"
 #include "config.hpp"
+#include <grpcpp/grpcpp.h>
+
+class ZKProverServiceImpl;
 
 class ZkServer
 {
@@ -14,6 +17,7 @@ class ZkServer
 public:
     ZkServer(Goldilocks &fr, Prover &prover, Config &config) : fr(fr), prover(prover), config(config) {};
     void run (void);
+    void runAsync (grpc::ServerBuilder &builder, ZKProverServiceImpl &service);
     void runThread (void);
     void waitForThread (void);
 };
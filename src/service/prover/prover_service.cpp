@@ -3,6 +3,8 @@
 #include "input.hpp"
 #include "proof.hpp"
 #include "prover_utils.hpp"
+#include "metrics.hpp"
+#include "scalar.hpp"
 
 #include <grpcpp/grpcpp.h>
 
@@ -47,6 +49,9 @@ using grpc::Status;
     // Unlock the prover
     prover.unlock();
 
+    // Set the metrics, out of the prover lock since they have their own
+    response->set_metrics(metrics.toText());
+
 #ifdef LOG_SERVICE
     cout << "ZKProverServiceImpl::GetStatus() returns: " << response->DebugString() << endl;
 #endif
@@ -184,12 +189,12 @@ using grpc::Status;
                 zkprover::v1::PublicInputsExtended* pPublicInputsExtended = new(zkprover::v1::PublicInputsExtended);
                 pPublicInputsExtended->set_input_hash(pProverRequest->proof.publicInputsExtended.inputHash);
                 zkprover::v1::PublicInputs* pPublicInputs = new(zkprover::v1::PublicInputs);
-                pPublicInputs->set_old_state_root(pProverRequest->proof.publicInputsExtended.publicInputs.oldStateRoot);
-                pPublicInputs->set_old_local_exit_root(pProverRequest->proof.publicInputsExtended.publicInputs.oldLocalExitRoot);
-                pPublicInputs->set_new_state_root(pProverRequest->proof.publicInputsExtended.publicInputs.newStateRoot);
-                pPublicInputs->set_new_local_exit_root(pProverRequest->proof.publicInputsExtended.publicInputs.newLocalExitRoot);
-                pPublicInputs->set_sequencer_addr(pProverRequest->proof.publicInputsExtended.publicInputs.sequencerAddr);
-                pPublicInputs->set_batch_hash_data(pProverRequest->proof.publicInputsExtended.publicInputs.batchHashData);
+                pPublicInputs->set_old_state_root(NormalizeTo0xNFormat(pProverRequest->proof.publicInputsExtended.publicInputs.oldStateRoot.get_str(16), 64));
+                pPublicInputs->set_old_local_exit_root(NormalizeTo0xNFormat(pProverRequest->proof.publicInputsExtended.publicInputs.oldLocalExitRoot.get_str(16), 64));
+                pPublicInputs->set_new_state_root(NormalizeTo0xNFormat(pProverRequest->proof.publicInputsExtended.publicInputs.newStateRoot.get_str(16), 64));
+                pPublicInputs->set_new_local_exit_root(NormalizeTo0xNFormat(pProverRequest->proof.publicInputsExtended.publicInputs.newLocalExitRoot.get_str(16), 64));
+                pPublicInputs->set_sequencer_addr(NormalizeTo0xNFormat(pProverRequest->proof.publicInputsExtended.publicInputs.sequencerAddr.get_str(16), 40));
+                pPublicInputs->set_batch_hash_data(NormalizeTo0xNFormat(pProverRequest->proof.publicInputsExtended.publicInputs.batchHashData.get_str(16), 64));
                 pPublicInputs->set_batch_num(pProverRequest->proof.publicInputsExtended.publicInputs.batchNum);
                 pPublicInputs->set_eth_timestamp(pProverRequest->proof.publicInputsExtended.publicInputs.timestamp);
                 pPublicInputsExtended->set_allocated_public_inputs(pPublicInputs);
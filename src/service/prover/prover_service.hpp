@@ -18,4 +18,17 @@ public:
     ::grpc::Status GetProof(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::zkprover::v1::GetProofResponse, ::zkprover::v1::GetProofRequest>* stream) override;
 };
 
+// Service registered by the async server: the unary methods are asynchronous, and processed by the
+// async server worker threads, while GetProof stays synchronous; all use the same implementation
+class ZKProverAsyncServiceImpl final : public zkprover::v1::ZKProverService::WithAsyncMethod_GetStatus<zkprover::v1::ZKProverService::WithAsyncMethod_GenProof<zkprover::v1::ZKProverService::WithAsyncMethod_Cancel<zkprover::v1::ZKProverService::Service>>>
+{
+    ZKProverServiceImpl &service;
+public:
+    ZKProverAsyncServiceImpl(ZKProverServiceImpl &service) : service(service) {};
+    ::grpc::Status GetProof(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::zkprover::v1::GetProofResponse, ::zkprover::v1::GetProofRequest>* stream) override
+    {
+        return service.GetProof(context, stream);
+    };
+};
+
 #endif
\ No newline at end of file
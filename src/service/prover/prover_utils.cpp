@@ -6,52 +6,51 @@
 void inputProver2Input (Goldilocks &fr, const zkprover::v1::InputProver &inputProver, Input &input)
 {
     // Parse public inputs
-    zkprover::v1::PublicInputs publicInputs = inputProver.public_inputs();
-    input.publicInputs.oldStateRoot = publicInputs.old_state_root();
-    input.publicInputs.oldLocalExitRoot = publicInputs.old_local_exit_root();
-    input.publicInputs.newStateRoot = publicInputs.new_state_root();
-    input.publicInputs.newLocalExitRoot = publicInputs.new_local_exit_root();
-    input.publicInputs.sequencerAddr = publicInputs.sequencer_addr();
-    input.publicInputs.batchHashData = publicInputs.batch_hash_data();
+    const zkprover::v1::PublicInputs &publicInputs = inputProver.public_inputs();
+    string2scalar(publicInputs.old_state_root(), input.publicInputs.oldStateRoot);
+    string2scalar(publicInputs.old_local_exit_root(), input.publicInputs.oldLocalExitRoot);
+    string2scalar(publicInputs.new_state_root(), input.publicInputs.newStateRoot);
+    string2scalar(publicInputs.new_local_exit_root(), input.publicInputs.newLocalExitRoot);
+    string2scalar(publicInputs.sequencer_addr(), input.publicInputs.sequencerAddr);
+    string2scalar(publicInputs.batch_hash_data(), input.publicInputs.batchHashData);
     input.publicInputs.batchNum = publicInputs.batch_num();
     input.publicInputs.timestamp = publicInputs.eth_timestamp();
 
 #ifdef LOG_RPC_INPUT
-    cout << "input.publicInputs.oldStateRoot: " << input.publicInputs.oldStateRoot << endl;
-    cout << "input.publicInputs.oldLocalExitRoot: " << input.publicInputs.oldLocalExitRoot << endl;
-    cout << "input.publicInputs.newStateRoot: " << input.publicInputs.newStateRoot << endl;
-    cout << "input.publicInputs.newLocalExitRoot: " << input.publicInputs.newLocalExitRoot << endl;
-    cout << "input.publicInputs.sequencerAddr: " << input.publicInputs.sequencerAddr << endl;
-    cout << "input.publicInputs.batchHashData: " << input.publicInputs.batchHashData << endl;
+    cout << "input.publicInputs.oldStateRoot: " << input.publicInputs.oldStateRoot.get_str(16) << endl;
+    cout << "input.publicInputs.oldLocalExitRoot: " << input.publicInputs.oldLocalExitRoot.get_str(16) << endl;
+    cout << "input.publicInputs.newStateRoot: " << input.publicInputs.newStateRoot.get_str(16) << endl;
+    cout << "input.publicInputs.newLocalExitRoot: " << input.publicInputs.newLocalExitRoot.get_str(16) << endl;
+    cout << "input.publicInputs.sequencerAddr: " << input.publicInputs.sequencerAddr.get_str(16) << endl;
+    cout << "input.publicInputs.batchHashData: " << input.publicInputs.batchHashData.get_str(16) << endl;
     cout << "input.publicInputs.batchNum: " << to_string(input.publicInputs.batchNum) << endl;
     cout << "input.publicInputs.blockNum: " << to_string(input.publicInputs.blockNum) << endl;
     cout << "input.publicInputs.timestamp: " << to_string(input.publicInputs.timestamp) << endl;
 #endif
 
     // Parse global exit root
-    input.globalExitRoot = inputProver.global_exit_root();
+    string2scalar(inputProver.global_exit_root(), input.globalExitRoot);
 #ifdef LOG_RPC_INPUT
-    cout << "input.globalExitRoot: " << input.globalExitRoot << endl;
+    cout << "input.globalExitRoot: " << input.globalExitRoot.get_str(16) << endl;
 #endif
 
     // Parse batch L2 data
-    input.batchL2Data = Add0xIfMissing(inputProver.batch_l2_data());
+    string2ba(inputProver.batch_l2_data(), input.batchL2Data);
 
 #ifdef LOG_RPC_INPUT
-    cout << "input.batchL2Data: " << input.batchL2Data << endl;
+    cout << "input.batchL2Data: " << inputProver.batch_l2_data() << endl;
 #endif
 
     // Preprocess the transactions
     input.preprocessTxs();
 
     // Parse keys map
-    google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> > db;
-    db = inputProver.db();
-    google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> >::iterator it;
+    const google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> > &db = inputProver.db();
+    google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> >::const_iterator it;
     for (it=db.begin(); it!=db.end(); it++)
     {
         vector<Goldilocks::Element> dbValue;
-        string concatenatedValues = it->second;
+        const string &concatenatedValues = it->second;
         if (concatenatedValues.size()%64!=0)
         {
             cerr << "Error: inputProver2Input() found invalid db value size: " << concatenatedValues.size() << endl;
@@ -70,18 +69,11 @@ void inputProver2Input (Goldilocks &fr, const zkprover::v1::InputProver &inputPr
     }
 
     // Parse contracts data
-    google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> > contractsBytecode;
-    contractsBytecode = inputProver.contracts_bytecode();
-    google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> >::iterator itp;
+    const google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> > &contractsBytecode = inputProver.contracts_bytecode();
+    google::protobuf::Map<std::__cxx11::basic_string<char>, std::__cxx11::basic_string<char> >::const_iterator itp;
     for (itp=contractsBytecode.begin(); itp!=contractsBytecode.end(); itp++)
     {
-        vector<uint8_t> dbValue;
-        string contractValue = string2ba(itp->second);
-        for (uint64_t i=0; i<contractValue.size(); i++)
-        {
-            dbValue.push_back(contractValue.at(i));
-        }
-        input.contractsBytecode[itp->first] = dbValue;
+        string2ba(itp->second, input.contractsBytecode[itp->first]);
 #ifdef LOG_RPC_INPUT
         cout << "input.contractsBytecode[" << itp->first << "]: " << itp->second << endl;
 #endif
@@ -92,21 +84,21 @@ void input2InputProver (Goldilocks &fr, const Input &input, zkprover::v1::InputP
 {
     // Parse public inputs
     zkprover::v1::PublicInputs * pPublicInputs = new zkprover::v1::PublicInputs();
-    pPublicInputs->set_old_state_root(input.publicInputs.oldStateRoot);
-    pPublicInputs->set_old_local_exit_root(input.publicInputs.oldStateRoot);
-    pPublicInputs->set_new_state_root(input.publicInputs.newStateRoot);
-    pPublicInputs->set_new_local_exit_root(input.publicInputs.newLocalExitRoot);
-    pPublicInputs->set_sequencer_addr(input.publicInputs.sequencerAddr);
-    pPublicInputs->set_batch_hash_data(input.publicInputs.batchHashData);
+    pPublicInputs->set_old_state_root(NormalizeTo0xNFormat(input.publicInputs.oldStateRoot.get_str(16), 64));
+    pPublicInputs->set_old_local_exit_root(NormalizeTo0xNFormat(input.publicInputs.oldStateRoot.get_str(16), 64));
+    pPublicInputs->set_new_state_root(NormalizeTo0xNFormat(input.publicInputs.newStateRoot.get_str(16), 64));
+    pPublicInputs->set_new_local_exit_root(NormalizeTo0xNFormat(input.publicInputs.newLocalExitRoot.get_str(16), 64));
+    pPublicInputs->set_sequencer_addr(NormalizeTo0xNFormat(input.publicInputs.sequencerAddr.get_str(16), 40));
+    pPublicInputs->set_batch_hash_data(NormalizeTo0xNFormat(input.publicInputs.batchHashData.get_str(16), 64));
     pPublicInputs->set_batch_num(input.publicInputs.batchNum);
     pPublicInputs->set_eth_timestamp(input.publicInputs.timestamp);
     inputProver.set_allocated_public_inputs(pPublicInputs);
 
     // Parse global exit root
-    inputProver.set_global_exit_root(input.globalExitRoot);
+    inputProver.set_global_exit_root(NormalizeTo0xNFormat(input.globalExitRoot.get_str(16), 64));
 
     // Parse batch L2 data
-    inputProver.set_batch_l2_data(input.batchL2Data);
+    inputProver.set_batch_l2_data("0x" + ba2string(input.batchL2Data));
 
     // Parse keys map
     map< string, vector<Goldilocks::Element>>::const_iterator it;
@@ -28,6 +28,13 @@ zkresult StateDB::set (const Goldilocks::Element (&oldRoot)[4], const Goldilocks
     return zkr;
 }
 
+zkresult StateDB::setBatch (const Goldilocks::Element (&oldRoot)[4], const vector<SmtBatchEntry> &entries, const bool persistent, Goldilocks::Element (&newRoot)[4])
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return smt.setBatch (db, oldRoot, entries, persistent, newRoot);
+}
+
 zkresult StateDB::get (const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result)
 {
     std::lock_guard<std::mutex> lock(mutex);
@@ -58,11 +65,11 @@ zkresult StateDB::getProgram (const Goldilocks::Element (&key)[4], vector<uint8_
     return db.getProgram (fea2string(fr, key), data);
 }
 
-void StateDB::flush()
+zkresult StateDB::flush()
 {
     std::lock_guard<std::mutex> lock(mutex);
     
-    db.flush();
+    return db.flush();
 }
 
 Database * StateDB::getDatabase (void)
@@ -70,6 +77,35 @@ Database * StateDB::getDatabase (void)
     return &db;
 }
 
+zkresult StateDB::readNodes (const vector<string> &keys, vector<vector<Goldilocks::Element>> &values)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Nodes that are not found are returned empty
+    values.resize(keys.size());
+    for (uint64_t i=0; i<keys.size(); i++)
+    {
+        zkresult r = db.read(keys[i], values[i]);
+        if (r == ZKR_DB_KEY_NOT_FOUND) values[i].clear();
+        else if (r != ZKR_SUCCESS) return r;
+    }
+
+    return ZKR_SUCCESS;
+}
+
+zkresult StateDB::writeNodes (const vector<string> &keys, const vector<vector<Goldilocks::Element>> &values, const bool persistent)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (uint64_t i=0; i<keys.size(); i++)
+    {
+        zkresult r = db.write(keys[i], values[i], persistent);
+        if (r != ZKR_SUCCESS) return r;
+    }
+
+    return ZKR_SUCCESS;
+}
+
 void StateDB::setAutoCommit (const bool autoCommit)
 {
     db.setAutoCommit (autoCommit);
@@ -19,12 +19,17 @@ private:
 public:
     StateDB (Goldilocks &fr, const Config &config);
     zkresult set (const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const bool persistent, Goldilocks::Element (&newRoot)[4], SmtSetResult *result);
+    zkresult setBatch (const Goldilocks::Element (&oldRoot)[4], const vector<SmtBatchEntry> &entries, const bool persistent, Goldilocks::Element (&newRoot)[4]);
     zkresult get (const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result);
     zkresult setProgram (const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const bool persistent);
     zkresult getProgram (const Goldilocks::Element (&key)[4], vector<uint8_t> &data);
-    void flush ();
+    zkresult flush ();
     Database * getDatabase (void);
 
+    // Node level access, for clients that run the SMT themselves
+    zkresult readNodes (const vector<string> &keys, vector<vector<Goldilocks::Element>> &values);
+    zkresult writeNodes (const vector<string> &keys, const vector<vector<Goldilocks::Element>> &values, const bool persistent);
+
     // Methods added for testing purposes
     void setAutoCommit (const bool autoCommit);
     void commit ();
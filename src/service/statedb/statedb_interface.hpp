@@ -13,10 +13,11 @@ class StateDBInterface
 public:
     virtual ~StateDBInterface() {};
     virtual zkresult set (const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const bool persistent, Goldilocks::Element (&newRoot)[4], SmtSetResult *result) = 0;
+    virtual zkresult setBatch (const Goldilocks::Element (&oldRoot)[4], const vector<SmtBatchEntry> &entries, const bool persistent, Goldilocks::Element (&newRoot)[4]) = 0;
     virtual zkresult get (const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result) = 0;
     virtual zkresult setProgram (const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const bool persistent) = 0;
     virtual zkresult getProgram (const Goldilocks::Element (&key)[4], vector<uint8_t> &data) = 0;
-    virtual void flush() = 0;
+    virtual zkresult flush() = 0;
     virtual Database * getDatabase (void) = 0; // Returns NULL if remote, &db if local; for testing purposes only
 };
 
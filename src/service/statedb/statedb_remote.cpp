@@ -75,6 +75,23 @@ zkresult StateDBRemote::set (const Goldilocks::Element (&oldRoot)[4], const Gold
     return static_cast<zkresult>(response.result().code());
 }
 
+// The StateDB service has no batch method, so the keys are set one by one
+zkresult StateDBRemote::setBatch (const Goldilocks::Element (&oldRoot)[4], const vector<SmtBatchEntry> &entries, const bool persistent, Goldilocks::Element (&newRoot)[4])
+{
+    for (uint64_t i=0; i<4; i++) newRoot[i] = oldRoot[i];
+    for (uint64_t i=0; i<entries.size(); i++)
+    {
+        Goldilocks::Element root[4];
+        for (uint64_t j=0; j<4; j++) root[j] = newRoot[j];
+        zkresult zkr = set(root, entries[i].key, entries[i].value, persistent, newRoot, NULL);
+        if (zkr != ZKR_SUCCESS)
+        {
+            return zkr;
+        }
+    }
+    return ZKR_SUCCESS;
+}
+
 zkresult StateDBRemote::get (const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result)
 {
     ::grpc::ClientContext context;
@@ -135,11 +152,7 @@ zkresult StateDBRemote::setProgram (const Goldilocks::Element (&key)[4], const v
     fea2grpc(fr, key, reqKey);
     request.set_allocated_key(reqKey);
 
-    std::string sData;
-    for (uint64_t i=0; i<data.size(); i++) {
-        sData.push_back((char)data.at(i));
-    }
-    request.set_data(sData);  
+    request.set_data(string(data.begin(), data.end()));
 
     stub->SetProgram(&context, request, &response);
 
@@ -162,13 +175,8 @@ zkresult StateDBRemote::getProgram (const Goldilocks::Element (&key)[4], vector<
 
     stub->GetProgram(&context, request, &response);
 
-    std:string sData;
-    
-    sData = response.data();
-
-    for (uint64_t i=0; i<sData.size(); i++) {
-        data.push_back(sData.at(i));
-    }
+    const string &sData = response.data();
+    data.assign(sData.begin(), sData.end());
 
 #ifdef LOG_STATEDB_REMOTE
     cout << "StateDBRemote::getProgram() response: " << response.DebugString() << endl;
@@ -177,16 +185,23 @@ zkresult StateDBRemote::getProgram (const Goldilocks::Element (&key)[4], vector<
     return static_cast<zkresult>(response.result().code());
 }
 
-void StateDBRemote::flush()
+zkresult StateDBRemote::flush()
 {
     ::grpc::ClientContext context;
     ::google::protobuf::Empty request;
     ::google::protobuf::Empty response;
-    stub->Flush(&context, request, &response);
+    ::grpc::Status s = stub->Flush(&context, request, &response);
+    if (!s.ok())
+    {
+        cerr << "Error: StateDBRemote::flush() failed calling Flush() error=" << s.error_message() << endl;
+        return ZKR_DB_ERROR;
+    }
 
 #ifdef LOG_STATEDB_REMOTE
     cout << "StateDBRemote::Flush() response: " << response.DebugString() << endl;
 #endif      
+
+    return ZKR_SUCCESS;
 }
 
 Database * StateDBRemote::getDatabase (void)
@@ -4,6 +4,7 @@
 #include <grpcpp/health_check_service_interface.h>
 #include "statedb_server.hpp"
 #include "statedb_service.hpp"
+#include "async_server.hpp"
 
 using grpc::Server;
 using grpc::ServerBuilder;
@@ -23,6 +24,12 @@ void StateDBServer::run (void)
     // Listen on the given address without any authentication mechanism.
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
 
+    if (config.asyncServers)
+    {
+        runAsync(builder, service);
+        return;
+    }
+
     // Register "service" as the instance through which we'll communicate with
     // clients. In this case it corresponds to an *synchronous* service.
     builder.RegisterService(&service);
@@ -37,6 +44,38 @@ void StateDBServer::run (void)
     server->Wait();
 }
 
+void StateDBServer::runAsync (ServerBuilder &builder, StateDBServiceImpl &service)
+{
+    // All the methods are unary, so the whole service is asynchronous, and its calls are processed
+    // by the synchronous implementation in the worker threads
+    typedef statedb::v1::StateDBService::AsyncService AsyncService;
+    AsyncService asyncService;
+    AsyncServer asyncServer("STATEDB_SERVER", config);
+    builder.RegisterService(&asyncService);
+    asyncServer.addCompletionQueues(builder);
+    std::unique_ptr<Server> server(builder.BuildAndStart());
+
+    asyncUnaryMethod<AsyncService, statedb::v1::SetRequest, statedb::v1::SetResponse>(asyncServer, asyncService, &AsyncService::RequestSet,
+        [&service](ServerContext* context, const statedb::v1::SetRequest* request, statedb::v1::SetResponse* response) { return service.Set(context, request, response); });
+    asyncUnaryMethod<AsyncService, statedb::v1::GetRequest, statedb::v1::GetResponse>(asyncServer, asyncService, &AsyncService::RequestGet,
+        [&service](ServerContext* context, const statedb::v1::GetRequest* request, statedb::v1::GetResponse* response) { return service.Get(context, request, response); });
+    asyncUnaryMethod<AsyncService, statedb::v1::SetProgramRequest, statedb::v1::SetProgramResponse>(asyncServer, asyncService, &AsyncService::RequestSetProgram,
+        [&service](ServerContext* context, const statedb::v1::SetProgramRequest* request, statedb::v1::SetProgramResponse* response) { return service.SetProgram(context, request, response); });
+    asyncUnaryMethod<AsyncService, statedb::v1::GetProgramRequest, statedb::v1::GetProgramResponse>(asyncServer, asyncService, &AsyncService::RequestGetProgram,
+        [&service](ServerContext* context, const statedb::v1::GetProgramRequest* request, statedb::v1::GetProgramResponse* response) { return service.GetProgram(context, request, response); });
+    asyncUnaryMethod<AsyncService, google::protobuf::Empty, google::protobuf::Empty>(asyncServer, asyncService, &AsyncService::RequestFlush,
+        [&service](ServerContext* context, const google::protobuf::Empty* request, google::protobuf::Empty* response) { return service.Flush(context, request, response); });
+    asyncUnaryMethod<AsyncService, statedb::v1::GetNodesRequest, statedb::v1::GetNodesResponse>(asyncServer, asyncService, &AsyncService::RequestGetNodes,
+        [&service](ServerContext* context, const statedb::v1::GetNodesRequest* request, statedb::v1::GetNodesResponse* response) { return service.GetNodes(context, request, response); });
+    asyncUnaryMethod<AsyncService, statedb::v1::PutNodesRequest, statedb::v1::PutNodesResponse>(asyncServer, asyncService, &AsyncService::RequestPutNodes,
+        [&service](ServerContext* context, const statedb::v1::PutNodesRequest* request, statedb::v1::PutNodesResponse* response) { return service.PutNodes(context, request, response); });
+
+    std::cout << "StateDB async server listening on 0.0.0.0:" << config.stateDBServerPort << std::endl;
+
+    // Serve until the queues are shut down
+    asyncServer.run();
+}
+
 void StateDBServer::runThread (void)
 {
     pthread_create(&t, NULL, stateDBServerThread, this);
@@ -3,6 +3,9 @@
 
 #include "goldilocks_base_field.hpp"
 #include "database.hpp"
+#include <grpcpp/grpcpp.h>
+
+class StateDBServiceImpl;
 
 class StateDBServer
 {
@@ -14,6 +17,7 @@ private:
 public:
     StateDBServer (Goldilocks &fr, Config &config) : fr(fr), config(config) {}; 
     void run (void);
+    void runAsync (grpc::ServerBuilder &builder, StateDBServiceImpl &service);
     void runThread (void);
     void waitForThread (void);
 };
@@ -158,14 +158,8 @@ using grpc::Status;
         Goldilocks::Element key[4];
         grpc2fea (fr, request->key(), key);
 
-        vector<uint8_t> data;
-        std:string sData;
-
-        sData = request->data();
-
-        for (uint64_t i=0; i<sData.size(); i++) {
-            data.push_back(sData.at(i));
-        }
+        const string &sData = request->data();
+        vector<uint8_t> data(sData.begin(), sData.end());
 #ifdef LOG_STATEDB_SERVICE
         cout << "StateDBServiceImpl::SetProgram() called.";
         cout << " key=" << fea2string(fr, key[0], key[1], key[2], key[3]);
@@ -205,9 +199,7 @@ using grpc::Status;
         vector<uint8_t> value;
         zkresult r = stateDB.getProgram(key, value);
 
-        for (uint64_t i=0; i<value.size(); i++) {
-            sData.push_back((char)value.at(i));
-        }
+        sData.assign(value.begin(), value.end());
         response->set_data(sData);
 
         ::statedb::v1::ResultCode* result = new ::statedb::v1::ResultCode();
@@ -236,7 +228,12 @@ using grpc::Status;
 #endif
     try
     { 
-        stateDB.flush();
+        zkresult r = stateDB.flush();
+        if (r != ZKR_SUCCESS)
+        {
+            cerr << "Error: StateDBServiceImpl::Flush() failed calling stateDB.flush() result=" << zkresult2string(r) << endl;
+            return Status::CANCELLED;
+        }
     }
     catch (const std::exception &e)
     {
@@ -249,6 +246,97 @@ using grpc::Status;
     return Status::OK;
 }
 
+::grpc::Status StateDBServiceImpl::GetNodes(::grpc::ServerContext* context, const ::statedb::v1::GetNodesRequest* request, ::statedb::v1::GetNodesResponse* response)
+{
+    try
+    {
+        // Unpack the requested keys
+        const string &sKeys = request->keys();
+        vector<string> keys;
+        string key;
+        uint64_t offset = 0;
+        while (offset < sKeys.size())
+        {
+            if (!grpc2key(sKeys, offset, key))
+            {
+                cerr << "StateDBServiceImpl::GetNodes() got invalid keys of size=" << sKeys.size() << endl;
+                return Status::CANCELLED;
+            }
+            keys.push_back(key);
+        }
+#ifdef LOG_STATEDB_SERVICE
+        cout << "StateDBServiceImpl::GetNodes() called. keys=" << keys.size() << endl;
+#endif
+        vector<vector<Goldilocks::Element>> values;
+        zkresult r = stateDB.readNodes(keys, values);
+
+        // Pack the nodes, in the same order; the ones not found have no value words
+        string sNodes;
+        if (r == ZKR_SUCCESS)
+        {
+            for (uint64_t i=0; i<keys.size(); i++)
+            {
+                node2grpc(fr, keys[i], values[i], sNodes);
+            }
+        }
+        response->set_nodes(sNodes);
+
+        ::statedb::v1::ResultCode* result = new ::statedb::v1::ResultCode();
+        result->set_code(static_cast<::statedb::v1::ResultCode_Code>(r));
+        response->set_allocated_result(result);
+    }
+    catch (const std::exception &e)
+    {
+        cerr << "StateDBServiceImpl::GetNodes() exception: " << e.what() << endl;
+        return Status::CANCELLED;
+    }
+#ifdef LOG_STATEDB_SERVICE
+    cout << "StateDBServiceImpl::GetNodes() completed." << endl;
+#endif
+    return Status::OK;
+}
+
+::grpc::Status StateDBServiceImpl::PutNodes(::grpc::ServerContext* context, const ::statedb::v1::PutNodesRequest* request, ::statedb::v1::PutNodesResponse* response)
+{
+    try
+    {
+        // Unpack the nodes
+        const string &sNodes = request->nodes();
+        vector<string> keys;
+        vector<vector<Goldilocks::Element>> values;
+        string key;
+        vector<Goldilocks::Element> value;
+        uint64_t offset = 0;
+        while (offset < sNodes.size())
+        {
+            if (!grpc2node(fr, sNodes, offset, key, value))
+            {
+                cerr << "StateDBServiceImpl::PutNodes() got invalid nodes of size=" << sNodes.size() << endl;
+                return Status::CANCELLED;
+            }
+            keys.push_back(key);
+            values.push_back(value);
+        }
+#ifdef LOG_STATEDB_SERVICE
+        cout << "StateDBServiceImpl::PutNodes() called. nodes=" << keys.size() << " persistent=" << request->persistent() << endl;
+#endif
+        zkresult r = stateDB.writeNodes(keys, values, request->persistent());
+
+        ::statedb::v1::ResultCode* result = new ::statedb::v1::ResultCode();
+        result->set_code(static_cast<::statedb::v1::ResultCode_Code>(r));
+        response->set_allocated_result(result);
+    }
+    catch (const std::exception &e)
+    {
+        cerr << "StateDBServiceImpl::PutNodes() exception: " << e.what() << endl;
+        return Status::CANCELLED;
+    }
+#ifdef LOG_STATEDB_SERVICE
+    cout << "StateDBServiceImpl::PutNodes() completed." << endl;
+#endif
+    return Status::OK;
+}
+
 
 
 
@@ -19,6 +19,8 @@ public:
     ::grpc::Status SetProgram (::grpc::ServerContext* context, const ::statedb::v1::SetProgramRequest* request, ::statedb::v1::SetProgramResponse* response) override;
     ::grpc::Status GetProgram (::grpc::ServerContext* context, const ::statedb::v1::GetProgramRequest* request, ::statedb::v1::GetProgramResponse* response) override;
     ::grpc::Status Flush (::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) override;
+    ::grpc::Status GetNodes (::grpc::ServerContext* context, const ::statedb::v1::GetNodesRequest* request, ::statedb::v1::GetNodesResponse* response) override;
+    ::grpc::Status PutNodes (::grpc::ServerContext* context, const ::statedb::v1::PutNodesRequest* request, ::statedb::v1::PutNodesResponse* response) override;
 };
 
 #endif
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include "statedb.grpc.pb.h"
 #include "goldilocks_base_field.hpp"
+#include "statedb_utils.hpp"
+#include "scalar.hpp"
+#include <cstring>
 
 void fea2grpc (Goldilocks &fr, const Goldilocks::Element (&fea)[4], ::statedb::v1::Fea* grpcFea) {
     grpcFea->set_fe0(fr.toU64(fea[0]));
@@ -13,4 +16,52 @@ void grpc2fea (Goldilocks &fr, const ::statedb::v1::Fea& grpcFea, Goldilocks::El
     fea[1] = fr.fromU64(grpcFea.fe1());
     fea[2] = fr.fromU64(grpcFea.fe2());
     fea[3] = fr.fromU64(grpcFea.fe3());
-}
\ No newline at end of file
+}
+
+// Packed nodes are sequences of little-endian uint64 words; a key is 4 words, the least significant first
+
+void key2grpc (const string &key, string &packed) {
+    string hexKey = NormalizeToNFormat(key, 64);
+    for (uint64_t i=0; i<4; i++) {
+        uint64_t word = strtoull(hexKey.substr(48 - 16*i, 16).c_str(), NULL, 16);
+        packed.append((const char *)&word, 8);
+    }
+}
+
+void node2grpc (Goldilocks &fr, const string &key, const vector<Goldilocks::Element> &value, string &packed) {
+    key2grpc(key, packed);
+    uint64_t size = value.size();
+    packed.append((const char *)&size, 8);
+    for (uint64_t i=0; i<size; i++) {
+        uint64_t word = fr.toU64(value[i]);
+        packed.append((const char *)&word, 8);
+    }
+}
+
+bool grpc2key (const string &packed, uint64_t &offset, string &key) {
+    if (offset + 32 > packed.size()) return false;
+    uint64_t word[4];
+    memcpy(word, packed.data() + offset, 32);
+    offset += 32;
+    char hexKey[65];
+    snprintf(hexKey, sizeof(hexKey), "%016lx%016lx%016lx%016lx", word[3], word[2], word[1], word[0]);
+    key = hexKey;
+    return true;
+}
+
+bool grpc2node (Goldilocks &fr, const string &packed, uint64_t &offset, string &key, vector<Goldilocks::Element> &value) {
+    if (!grpc2key(packed, offset, key)) return false;
+    if (offset + 8 > packed.size()) return false;
+    uint64_t size;
+    memcpy(&size, packed.data() + offset, 8);
+    offset += 8;
+    if ((size > (packed.size() - offset)/8)) return false;
+    value.resize(size);
+    for (uint64_t i=0; i<size; i++) {
+        uint64_t word;
+        memcpy(&word, packed.data() + offset, 8);
+        offset += 8;
+        value[i] = fr.fromU64(word);
+    }
+    return true;
+}
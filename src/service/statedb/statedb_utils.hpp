@@ -3,8 +3,18 @@
 
 #include "statedb.grpc.pb.h"
 #include "goldilocks_base_field.hpp"
+#include <string>
+#include <vector>
+
+using namespace std;
 
 void fea2grpc (Goldilocks &fr, const Goldilocks::Element (&fea)[4], ::statedb::v1::Fea* grpcFea);
 void grpc2fea (Goldilocks &fr, const ::statedb::v1::Fea& grpcFea, Goldilocks::Element (&fea)[4]);
 
+// Packed node format of GetNodes and PutNodes; keys are database keys, i.e. normalized hex strings
+void key2grpc (const string &key, string &packed);
+void node2grpc (Goldilocks &fr, const string &key, const vector<Goldilocks::Element> &value, string &packed);
+bool grpc2key (const string &packed, uint64_t &offset, string &key);
+bool grpc2node (Goldilocks &fr, const string &packed, uint64_t &offset, string &key, vector<Goldilocks::Element> &value);
+
 #endif
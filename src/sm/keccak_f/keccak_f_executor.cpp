@@ -287,41 +287,31 @@ void KeccakFExecutor::execute (KeccakFExecuteInput &input, KeccakFExecuteOutput
 /* Input is fe[54][1600], output is KeccakPols */
 void KeccakFExecutor::execute (const Goldilocks::Element *input, const uint64_t inputLength, KeccakFCommitPols &pols)
 {
-    if (inputLength != numberOfSlots*1600)
-    {
-        cerr << "Error: KeccakFExecutor::execute() got input size=" << inputLength << " different from numberOfSlots=" << numberOfSlots << "x1600" << endl;
-        exitProcess();
-    }
-    vector<vector<Goldilocks::Element>> inputVector;
-    for (uint64_t slot=0; slot<numberOfSlots; slot++)
-    {
-        vector<Goldilocks::Element> aux;
-        for (uint64_t i=0; i<1600; i++)
-        {
-            aux.push_back(input[slot*1600+i]);
-        }
-        inputVector.push_back(aux);
-    }
     vector<NormGate9ExecutorInput> required;
-    execute(inputVector, pols, required);
+    execute(input, inputLength, pols, required);
 }
 
-/* Input is a vector of numberOfSlots*1600 fe, output is KeccakPols */
-void KeccakFExecutor::execute (const vector<vector<Goldilocks::Element>> &input, KeccakFCommitPols &pols, vector<NormGate9ExecutorInput> &required)
+/* Input is a contiguous vector of numberOfSlots*1600 fe, output is KeccakPols */
+void KeccakFExecutor::execute (const vector<Goldilocks::Element> &input, KeccakFCommitPols &pols, vector<NormGate9ExecutorInput> &required)
 {
-    if (input.size() != numberOfSlots)
+    execute(input.data(), input.size(), pols, required);
+}
+
+void KeccakFExecutor::execute (const Goldilocks::Element *input, const uint64_t inputLength, KeccakFCommitPols &pols, vector<NormGate9ExecutorInput> &required)
+{
+    if (inputLength != numberOfSlots*1600)
     {
-        cerr << "Error: KeccakFExecutor::execute() got input size=" << input.size() << " different from numberOfSlots=" << numberOfSlots << endl;
+        cerr << "Error: KeccakFExecutor::execute() got input size=" << inputLength << " different from numberOfSlots=" << numberOfSlots << "x1600" << endl;
         exitProcess();
     }
-    for (uint64_t i=0; i<numberOfSlots; i++)
+
+    // Every xorn and andp gate of every slot generates one NormGate9 input; reserve them all at once
+    uint64_t normGatesPerSlot = 0;
+    for (uint64_t i=0; i<program.size(); i++)
     {
-        if (input[i].size() != 1600)
-        {
-            cerr << "Error: KeccakFExecutor::execute() got input i=" << i << " size=" << input[i].size() << " different from 1600" << endl;
-            exitProcess();
-        }
+        if ((program[i].op == gop_xorn) || (program[i].op == gop_andp)) normGatesPerSlot++;
     }
+    required.reserve(required.size() + numberOfSlots*normGatesPerSlot);
 
     // Set ZeroRef values
     pols.a[ZeroRef] = fr.zero();
@@ -333,7 +323,7 @@ void KeccakFExecutor::execute (const vector<vector<Goldilocks::Element>> &input,
     {
         for (uint64_t i=0; i<1600; i++)
         {
-            pols.a[relRef2AbsRef(SinRef0 + i*9, slot)] = input[slot][i];
+            pols.a[relRef2AbsRef(SinRef0 + i*9, slot)] = input[slot*1600 + i];
         }
     }
 
@@ -71,9 +71,10 @@ public:
 
     /* Input is fe[numberOfSlots*1600], output is KeccakPols */
     void execute (const Goldilocks::Element *input, const uint64_t inputLength, KeccakFCommitPols &pols);
+    void execute (const Goldilocks::Element *input, const uint64_t inputLength, KeccakFCommitPols &pols, vector<NormGate9ExecutorInput> &required);
 
-    /* Input is a vector of numberOfSlots*1600 fe, output is KeccakPols */
-    void execute (const vector<vector<Goldilocks::Element>> &input, KeccakFCommitPols &pols, vector<NormGate9ExecutorInput> &required);
+    /* Input is a contiguous vector of numberOfSlots*1600 fe, output is KeccakPols */
+    void execute (const vector<Goldilocks::Element> &input, KeccakFCommitPols &pols, vector<NormGate9ExecutorInput> &required);
 
     /* Calculates keccak hash of input data.  Output must be 32-bytes long. */
     /* Internally, it calls execute(KeccakState) */
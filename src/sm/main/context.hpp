@@ -59,6 +59,22 @@ public:
     LastSWrite(Goldilocks &fr) : fr(fr) { reset(); }
 };
 
+// Last elliptic curve point addition or doubling, reused because the ROM asks for x3 and y3 in two
+// consecutive commands with the same input points
+class LastPointEc
+{
+public:
+    bool bValid;
+    bool dbl;
+    RawFec::Element x1;
+    RawFec::Element y1;
+    RawFec::Element x2;
+    RawFec::Element y2;
+    RawFec::Element x3;
+    RawFec::Element y3;
+    LastPointEc() : bValid(false), dbl(false) {};
+};
+
 class Fea
 {
 public:
@@ -95,6 +111,7 @@ public:
     MainCommitPols &pols; // PIL JSON file polynomials data
     const Rom &rom; // Rom reference
     LastSWrite lastSWrite; // Keep track of the last storage write
+    LastPointEc lastPointEc; // Keep track of the last elliptic curve point addition or doubling
     ProverRequest &proverRequest;
     uint64_t lastStep;
     Context(Goldilocks &fr, RawFec &fec, RawFnec &fnec, MainCommitPols &pols, const Rom &rom, ProverRequest &proverRequest) : fr(fr), fec(fec), fnec(fnec), pols(pols), rom(rom), lastSWrite(fr), proverRequest(proverRequest), lastStep(0) { ; }; // Constructor, setting references
@@ -609,8 +609,7 @@ void eval_getGlobalExitRoot(Context &ctx, const RomCommand &cmd, CommandResult &
 
     // Return ctx.proverRequest.input.globalExitRoot as a field element array
     cr.type = crt_fea;
-    mpz_class globalExitRoot(ctx.proverRequest.input.globalExitRoot);
-    scalar2fea(ctx.fr, globalExitRoot, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
+    scalar2fea(ctx.fr, ctx.proverRequest.input.globalExitRoot, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
 }
 
 void eval_getSequencerAddr(Context &ctx, const RomCommand &cmd, CommandResult &cr)
@@ -623,8 +622,7 @@ void eval_getSequencerAddr(Context &ctx, const RomCommand &cmd, CommandResult &c
 
     // Return ctx.proverRequest.input.publicInputs.sequencerAddr as a field element array
     cr.type = crt_fea;
-    mpz_class sequencerAddr(ctx.proverRequest.input.publicInputs.sequencerAddr);
-    scalar2fea(ctx.fr, sequencerAddr, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
+    scalar2fea(ctx.fr, ctx.proverRequest.input.publicInputs.sequencerAddr, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
 }
 
 void eval_getBatchNum(Context &ctx, const RomCommand &cmd, CommandResult &cr)
@@ -657,8 +655,7 @@ void eval_getOldStateRoot(Context &ctx, const RomCommand &cmd, CommandResult &cr
 
     // Return ctx.proverRequest.input.publicInputs.oldStateRoot as a field element array
     cr.type = crt_fea;
-    mpz_class oldStateRoot(ctx.proverRequest.input.publicInputs.oldStateRoot); // This field could be parsed out of the main loop, but it is only called once
-    scalar2fea(ctx.fr, oldStateRoot, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
+    scalar2fea(ctx.fr, ctx.proverRequest.input.publicInputs.oldStateRoot, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
 }
 
 void eval_getNewStateRoot(Context &ctx, const RomCommand &cmd, CommandResult &cr)
@@ -671,8 +668,7 @@ void eval_getNewStateRoot(Context &ctx, const RomCommand &cmd, CommandResult &cr
 
     // Return ctx.proverRequest.input.publicInputs.newStateRoot as a field element array
     cr.type = crt_fea;
-    mpz_class newStateRoot(ctx.proverRequest.input.publicInputs.newStateRoot); // This field could be parsed out of the main loop, but it is only called once
-    scalar2fea(ctx.fr, newStateRoot, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
+    scalar2fea(ctx.fr, ctx.proverRequest.input.publicInputs.newStateRoot, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
 }
 
 void eval_getOldLocalExitRoot(Context &ctx, const RomCommand &cmd, CommandResult &cr)
@@ -685,8 +681,7 @@ void eval_getOldLocalExitRoot(Context &ctx, const RomCommand &cmd, CommandResult
 
     // Return ctx.proverRequest.input.publicInputs.oldLocalExitRoot as a field element array
     cr.type = crt_fea;
-    mpz_class oldLocalExitRoot(ctx.proverRequest.input.publicInputs.oldLocalExitRoot);
-    scalar2fea(ctx.fr, oldLocalExitRoot, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
+    scalar2fea(ctx.fr, ctx.proverRequest.input.publicInputs.oldLocalExitRoot, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
 }
 
 void eval_getNewLocalExitRoot(Context &ctx, const RomCommand &cmd, CommandResult &cr)
@@ -699,8 +694,7 @@ void eval_getNewLocalExitRoot(Context &ctx, const RomCommand &cmd, CommandResult
 
     // Return ctx.proverRequest.input.publicInputs.newLocalExitRoot as a field element array
     cr.type = crt_fea;
-    mpz_class newLocalExitRoot(ctx.proverRequest.input.publicInputs.newLocalExitRoot);
-    scalar2fea(ctx.fr, newLocalExitRoot, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
+    scalar2fea(ctx.fr, ctx.proverRequest.input.publicInputs.newLocalExitRoot, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
 }
 
 void eval_getTxsLen(Context &ctx, const RomCommand &cmd, CommandResult &cr)
@@ -711,9 +705,9 @@ void eval_getTxsLen(Context &ctx, const RomCommand &cmd, CommandResult &cr)
         exitProcess();
     }
 
-    // Return ctx.proverRequest.input.txsLen/2 as a field element array
+    // Return the ctx.proverRequest.input.batchL2Data size in bytes as a field element array
     cr.type = crt_fea;
-    cr.fea0 = ctx.fr.fromU64((ctx.proverRequest.input.batchL2Data.size() - 2) / 2);
+    cr.fea0 = ctx.fr.fromU64(ctx.proverRequest.input.batchL2Data.size());
     cr.fea1 = ctx.fr.zero();
     cr.fea2 = ctx.fr.zero();
     cr.fea3 = ctx.fr.zero();
@@ -747,11 +741,15 @@ void eval_getTxs(Context &ctx, const RomCommand &cmd, CommandResult &cr)
     }
     uint64_t len = cr.scalar.get_ui();
 
-    string resultString = ctx.proverRequest.input.batchL2Data.substr(2+offset*2, len*2);
-    if (resultString.size() == 0) resultString += "0";
+    // Read the requested bytes, truncated to the batch L2 data size
+    const string &batchL2Data = ctx.proverRequest.input.batchL2Data;
+    mpz_class resultScalar;
+    if (offset < batchL2Data.size())
+    {
+        ba2scalar((const uint8_t *)batchL2Data.data() + offset, zkmin(len, batchL2Data.size() - offset), resultScalar);
+    }
 
     // Return result as a field element array
-    mpz_class resultScalar(resultString, 16);
     cr.type = crt_fea;
     scalar2fea(ctx.fr, resultScalar, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
 }
@@ -909,7 +907,8 @@ void eval_getBytecode (Context &ctx, const RomCommand &cmd, CommandResult &cr)
         len = cr.scalar.get_si();
     }
 
-    if (ctx.proverRequest.input.contractsBytecode.find(hashcontract) == ctx.proverRequest.input.contractsBytecode.end())
+    map< string, vector<uint8_t> >::const_iterator it = ctx.proverRequest.input.contractsBytecode.find(hashcontract);
+    if (it == ctx.proverRequest.input.contractsBytecode.end())
     {
         cr.type = crt_fea;
         cr.fea0 = ctx.fr.zero();
@@ -923,13 +922,12 @@ void eval_getBytecode (Context &ctx, const RomCommand &cmd, CommandResult &cr)
         return;
     }
 
-    string d = "0x";
-    for (uint64_t i=offset; i<offset+len; i++)
+    // Read the requested bytes, truncated to the bytecode size
+    mpz_class auxScalar;
+    if (offset < it->second.size())
     {
-        d += byte2string(ctx.proverRequest.input.contractsBytecode[hashcontract][i]);
+        ba2scalar(it->second.data() + offset, zkmin(len, it->second.size() - offset), auxScalar);
     }
-    if (len == 0) d += "0";
-    mpz_class auxScalar(d);
     cr.type = crt_fea;
     scalar2fea(ctx.fr, auxScalar, cr.fea0, cr.fea1, cr.fea2, cr.fea3, cr.fea4, cr.fea5, cr.fea6, cr.fea7);
 }
@@ -1579,7 +1577,7 @@ void eval_inverseFpEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
         exitProcess();
     }
     RawFec::Element a;
-    ctx.fec.fromString(a, cr.scalar.get_str(16), 16);
+    scalar2fec(ctx.fec, a, cr.scalar);
     if (ctx.fec.isZero(a))
     {
         cerr << "Error: eval_inverseFpEc() Division by zero" << " zkPC=" << *ctx.pZKPC << endl;
@@ -1590,7 +1588,7 @@ void eval_inverseFpEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
     ctx.fec.inv(r, a);
 
     cr.type = crt_scalar;
-    cr.scalar.set_str(ctx.fec.toString(r,16), 16);
+    fec2scalar(ctx.fec, r, cr.scalar);
 }
 
 void eval_inverseFnEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
@@ -1622,59 +1620,36 @@ void eval_inverseFnEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
     cr.scalar.set_str(ctx.fnec.toString(r,16), 16);
 }
 
-mpz_class pow ( const mpz_class &x, const mpz_class &n, const mpz_class &p ) 
+// Square root in the secp256k1 base field; since p = 3 mod 4, r = a^((p+1)/4) is a root of a if a
+// has any; returns the root that is not greater than p/2, or 0 if a has none or is not in [0, p)
+void sqrtFpEc (RawFec &fec, const mpz_class &a, mpz_class &r)
 {
-    if (n == 0) return 1;
-    if ((n & 1) == 1) {
-        return (pow(x, n-1, p) * x) % p;
+    // Exponent (p+1)/4, as little-endian bytes, as RawFec::exp() expects
+    static const vector<uint8_t> exponent = []()
+    {
+        mpz_class e = (FecP + 1) / 4;
+        vector<uint8_t> bytes(32, 0);
+        mpz_export(bytes.data(), NULL, -1, 1, -1, 0, e.get_mpz_t());
+        return bytes;
+    }();
+
+    if ((a < 0) || (a >= FecP))
+    {
+        r = 0;
+        return;
     }
-    mpz_class x2 = pow(x, n/2, p);
-    return (x2 * x2) % p;
-}
 
-mpz_class sqrtTonelliShanks ( const mpz_class &n, const mpz_class &p )
-{
-    mpz_class s = 1;
-    mpz_class q = p - 1;
-    while ((q & 1) == 0) {
-        q = q / 2;
-        ++s;
-    }
-    if (s == 1) {
-        mpz_class r = pow(n, (p+1)/4, p);
-        if ((r * r) % p == n) return r;
-        return 0;
-    }
-
-    mpz_class z = 1;
-    while (pow(++z, (p - 1)/2, p) != (p - 1));
-//    std::cout << "Z found: " << z << "\n";
-    mpz_class c = pow(z, q, p);
-    mpz_class r = pow(n, (q+1)/2, p);
-    mpz_class t = pow(n, q, p);
-    mpz_class m = s;
-    while (t != 1) {
-        mpz_class tt = t;
-        mpz_class i = 0;
-        while (tt != 1) {
-            tt = (tt * tt) % p;
-            ++i;
-            if (i == m) return 0;
-        }
-        mpz_class b = pow(c, pow(2, m-i-1, p-1), p);
-        mpz_class b2 = (b * b) % p;
-        r = (r * b) % p;
-        t = (t * b2) % p;
-        c = b2;
-        m = i;
-    }
-    if (((r * r) % p) == n)
+    RawFec::Element fa, fr, fr2;
+    scalar2fec(fec, fa, a);
+    fec.exp(fr, fa, (uint8_t *)exponent.data(), exponent.size());
+    fec.square(fr2, fr);
+    if (!fec.eq(fr2, fa))
     {
-        r = r % p;
-        if (r > (p/2)) r = p - r; // return only the possitive solution of the square root
-        return r;
+        r = 0;
+        return;
     }
-    return 0;
+    fec2scalar(fec, fr, r);
+    if (r > FecHalfP) r = FecP - r;
 }
 
 void eval_sqrtFpEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
@@ -1692,12 +1667,9 @@ void eval_sqrtFpEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
         exitProcess();
     }
 
-    RawFec::Element pfe = ctx.fec.negOne();
-    mpz_class p(ctx.fec.toString(pfe,16),16);
-    p++;
     mpz_class a = cr.scalar;
     cr.type = crt_scalar;
-    cr.scalar = sqrtTonelliShanks(a, p);
+    sqrtFpEc(ctx.fec, a, cr.scalar);
 }
 
 void eval_AddPointEc (Context &ctx, const RomCommand &cmd, bool dbl, RawFec::Element &x3, RawFec::Element &y3);
@@ -1708,7 +1680,7 @@ void eval_xAddPointEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
     RawFec::Element y3;
     eval_AddPointEc(ctx, cmd, false, x3, y3);
     cr.type = crt_scalar;
-    cr.scalar.set_str(ctx.fec.toString(x3, 16),16);
+    fec2scalar(ctx.fec, x3, cr.scalar);
 }
 
 void eval_yAddPointEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
@@ -1717,7 +1689,7 @@ void eval_yAddPointEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
     RawFec::Element y3;
     eval_AddPointEc(ctx, cmd, false, x3, y3);
     cr.type = crt_scalar;
-    cr.scalar.set_str(ctx.fec.toString(y3, 16),16);
+    fec2scalar(ctx.fec, y3, cr.scalar);
 }
 
 void eval_xDblPointEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
@@ -1726,7 +1698,7 @@ void eval_xDblPointEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
     RawFec::Element y3;
     eval_AddPointEc(ctx, cmd, true, x3, y3);
     cr.type = crt_scalar;
-    cr.scalar.set_str(ctx.fec.toString(x3, 16),16);
+    fec2scalar(ctx.fec, x3, cr.scalar);
 }
 
 void eval_yDblPointEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
@@ -1735,7 +1707,7 @@ void eval_yDblPointEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
     RawFec::Element y3;
     eval_AddPointEc(ctx, cmd, true, x3, y3);
     cr.type = crt_scalar;
-    cr.scalar.set_str(ctx.fec.toString(y3, 16),16);
+    fec2scalar(ctx.fec, y3, cr.scalar);
 }
 
 void eval_AddPointEc (Context &ctx, const RomCommand &cmd, bool dbl, RawFec::Element &x3, RawFec::Element &y3)
@@ -1755,7 +1727,7 @@ void eval_AddPointEc (Context &ctx, const RomCommand &cmd, bool dbl, RawFec::Ele
         exitProcess();
     }
     RawFec::Element x1;
-    ctx.fec.fromString(x1, cr.scalar.get_str(16), 16);
+    scalar2fec(ctx.fec, x1, cr.scalar);
 
     // Get y1 by executing cmd.params[1]
     evalCommand(ctx, *cmd.params[1], cr);
@@ -1764,7 +1736,7 @@ void eval_AddPointEc (Context &ctx, const RomCommand &cmd, bool dbl, RawFec::Ele
         exitProcess();
     }
     RawFec::Element y1;
-    ctx.fec.fromString(y1, cr.scalar.get_str(16), 16);
+    scalar2fec(ctx.fec, y1, cr.scalar);
 
     RawFec::Element x2, y2;
     if (dbl)
@@ -1780,7 +1752,7 @@ void eval_AddPointEc (Context &ctx, const RomCommand &cmd, bool dbl, RawFec::Ele
             cerr << "Error: eval_AddPointEc() 2 unexpected command result type: " << cr.type << " zkPC=" << *ctx.pZKPC << endl;
             exitProcess();
         }
-        ctx.fec.fromString(x2, cr.scalar.get_str(16), 16);
+        scalar2fec(ctx.fec, x2, cr.scalar);
 
         // Get y2 by executing cmd.params[3]
         evalCommand(ctx, *cmd.params[3], cr);
@@ -1788,7 +1760,17 @@ void eval_AddPointEc (Context &ctx, const RomCommand &cmd, bool dbl, RawFec::Ele
             cerr << "Error: eval_AddPointEc() 3 unexpected command result type: " << cr.type << " zkPC=" << *ctx.pZKPC << endl;
             exitProcess();
         }
-        ctx.fec.fromString(y2, cr.scalar.get_str(16), 16);
+        scalar2fec(ctx.fec, y2, cr.scalar);
+    }
+
+    // Reuse the last result if the points are the same, e.g. when computing y3 after x3
+    LastPointEc &last = ctx.lastPointEc;
+    if (last.bValid && (last.dbl == dbl) &&
+        ctx.fec.eq(last.x1, x1) && ctx.fec.eq(last.y1, y1) && ctx.fec.eq(last.x2, x2) && ctx.fec.eq(last.y2, y2))
+    {
+        x3 = last.x3;
+        y3 = last.y3;
+        return;
     }
     
     RawFec::Element aux1, aux2, s;
@@ -1821,4 +1803,13 @@ void eval_AddPointEc (Context &ctx, const RomCommand &cmd, bool dbl, RawFec::Ele
     ctx.fec.sub(aux1, x1, x3);;
     ctx.fec.mul(aux1, aux1, s);
     ctx.fec.sub(y3, aux1, y1);
+
+    last.bValid = true;
+    last.dbl = dbl;
+    last.x1 = x1;
+    last.y1 = y1;
+    last.x2 = x2;
+    last.y2 = y2;
+    last.x3 = x3;
+    last.y3 = y3;
 }
\ No newline at end of file
@@ -49,4 +49,7 @@ void cr2fe (Goldilocks &fr, const CommandResult &cr, Goldilocks::Element &fe);
 // Converts a returned command result into a scalar
 void cr2scalar (Goldilocks &fr, const CommandResult &cr, mpz_class &s);
 
+// Square root in the secp256k1 base field, as returned by the sqrtFpEc ROM command
+void sqrtFpEc (RawFec &fec, const mpz_class &a, mpz_class &r);
+
 #endif
\ No newline at end of file
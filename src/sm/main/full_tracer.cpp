@@ -333,6 +333,12 @@ void FullTracer::onFinishTx (Context &ctx, const RomCommand &cmd)
     // Increase transaction count
     txCount++;
 
+    // Notify the listener, if any, that this transaction is complete
+    if (pListener != NULL)
+    {
+        pListener->onFinishTx(finalTrace.responses[finalTrace.responses.size() - 1]);
+    }
+
 #ifdef LOG_FULL_TRACER
     cout << "FullTracer::onFinishTx() txCount=" << txCount << " finalTrace.responses.size()=" << finalTrace.responses.size() << " create_address=" << response.create_address << " state_root=" << response.state_root << endl;
 #endif
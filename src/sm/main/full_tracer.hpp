@@ -128,6 +128,15 @@ public:
     FinalTrace() : bInitialized(false) {};
 };
 
+// Listener notified every time a transaction has been completely traced, e.g. to stream it to the client
+class FullTracerListener
+{
+public:
+    virtual ~FullTracerListener() {};
+    virtual void onFinishTx (Response &response) = 0; // It can free the transaction steps, once consumed
+    virtual bool isCancelled (void) = 0; // If true, the execution is aborted, e.g. because the client is gone
+};
+
 class FullTracer
 {
 public:
@@ -145,6 +154,7 @@ public:
     map<uint64_t,map<uint64_t,Log>> logs;
     vector<Opcode> call_trace;
     vector<Opcode> execution_trace;
+    FullTracerListener * pListener; // Optional, not owned
 private:
     void onError (Context &ctx, const RomCommand &cmd);
     void onStoreLog (Context &ctx, const RomCommand &cmd);
@@ -162,7 +172,7 @@ private:
     uint64_t getCurrentTime (void);
     string getTransactionHash(string &to, uint64_t value, uint64_t nonce, uint64_t gasLimit, uint64_t gasPrice, string &data, mpz_class &r, mpz_class &s, uint64_t v);
 public:
-    FullTracer(Goldilocks &fr) : fr(fr), depth(1), txCount(0), txTime(0)
+    FullTracer(Goldilocks &fr) : fr(fr), depth(1), txCount(0), txTime(0), pListener(NULL)
     {
         depth = 1;
         initGas = 0;
@@ -0,0 +1,370 @@
+#include <fstream>
+#include "main_exec_required.hpp"
+#include "utils.hpp"
+
+/*
+    Binary dump of the secondary state machines inputs, as generated by the main executor
+    Layout: magic, then every section as a uint64 number of items followed by the items;
+    integers are stored as little endian uint64, fe as their canonical uint64 value,
+    mpz_class values and strings as a uint64 byte length followed by the bytes
+*/
+
+#define MAIN_EXEC_REQUIRED_MAGIC "ZKMER003"
+
+class RequiredWriter
+{
+public:
+    ofstream stream;
+    RequiredWriter(const string &fileName) : stream(fileName, ios::binary) {};
+    void u64 (uint64_t value) { stream.write((const char *)&value, sizeof(value)); };
+    void fe (const Goldilocks::Element &value) { u64(Goldilocks::toU64(value)); };
+    void fea (const Goldilocks::Element *value, uint64_t size) { for (uint64_t i=0; i<size; i++) fe(value[i]); };
+    void bytes (const void *data, uint64_t size) { u64(size); stream.write((const char *)data, size); };
+    void str (const string &value) { bytes(value.data(), value.size()); };
+    void scalar (const mpz_class &value)
+    {
+        size_t size = (mpz_sizeinbase(value.get_mpz_t(), 2) + 7) / 8;
+        vector<uint8_t> data(size);
+        mpz_export(data.data(), &size, -1, 1, -1, 0, value.get_mpz_t());
+        bytes(data.data(), size);
+    };
+    void siblings (const map< uint64_t, vector<Goldilocks::Element> > &value)
+    {
+        u64(value.size());
+        for (map< uint64_t, vector<Goldilocks::Element> >::const_iterator it=value.begin(); it!=value.end(); it++)
+        {
+            u64(it->first);
+            u64(it->second.size());
+            fea(it->second.data(), it->second.size());
+        }
+    };
+    void hashes (const vector< array<Goldilocks::Element, 16> > &value)
+    {
+        u64(value.size());
+        for (uint64_t i=0; i<value.size(); i++) fea(value[i].data(), 16);
+    };
+};
+
+class RequiredReader
+{
+public:
+    ifstream stream;
+    uint64_t fileSize;
+    RequiredReader(const string &fileName) : stream(fileName, ios::binary), fileSize(0)
+    {
+        stream.seekg(0, ios::end);
+        if (stream.good()) fileSize = stream.tellg();
+        stream.seekg(0, ios::beg);
+    };
+    void read (void *data, uint64_t size)
+    {
+        stream.read((char *)data, size);
+        if (!stream.good())
+        {
+            cerr << "Error: MainExecRequired::load() found truncated file" << endl;
+            exitProcess();
+        }
+    };
+    uint64_t u64 (void)
+    {
+        uint64_t value = 0;
+        read(&value, sizeof(value));
+        return value;
+    };
+    // Reads a number of items, or of bytes; every item takes at least itemSize bytes of the file, so a
+    // length that does not fit in the rest of the file is invalid, and rejected before allocating it
+    uint64_t length (uint64_t itemSize)
+    {
+        uint64_t value = u64();
+        uint64_t position = stream.tellg();
+        if (value > (fileSize - position) / itemSize)
+        {
+            cerr << "Error: MainExecRequired::load() found invalid length=" << value << " at position=" << position - sizeof(value) << " of file with size=" << fileSize << endl;
+            exitProcess();
+        }
+        return value;
+    };
+    Goldilocks::Element fe (void) { return Goldilocks::fromU64(u64()); };
+    void fea (Goldilocks::Element *value, uint64_t size) { for (uint64_t i=0; i<size; i++) value[i] = fe(); };
+    string str (void)
+    {
+        string value(length(1), '\0');
+        if (value.size() > 0) read(&value[0], value.size());
+        return value;
+    };
+    void bytes (vector<uint8_t> &value)
+    {
+        value.resize(length(1));
+        if (value.size() > 0) read(value.data(), value.size());
+    };
+    void scalar (mpz_class &value)
+    {
+        string data = str();
+        mpz_import(value.get_mpz_t(), data.size(), -1, 1, -1, 0, data.data());
+    };
+    void siblings (map< uint64_t, vector<Goldilocks::Element> > &value)
+    {
+        value.clear();
+        uint64_t size = length(16);
+        for (uint64_t i=0; i<size; i++)
+        {
+            uint64_t level = u64();
+            vector<Goldilocks::Element> &sibling = value[level];
+            sibling.resize(length(8));
+            fea(sibling.data(), sibling.size());
+        }
+    };
+    void hashes (vector< array<Goldilocks::Element, 16> > &value)
+    {
+        value.resize(length(16*8));
+        for (uint64_t i=0; i<value.size(); i++) fea(value[i].data(), 16);
+    };
+};
+
+static void writePadding (RequiredWriter &w, const vector<uint8_t> &dataBytes, const string &data, uint64_t realLen, const vector<uint64_t> &reads, const mpz_class &hash)
+{
+    w.str(data);
+    w.bytes(dataBytes.data(), dataBytes.size());
+    w.u64(realLen);
+    w.u64(reads.size());
+    for (uint64_t j=0; j<reads.size(); j++) w.u64(reads[j]);
+    w.scalar(hash);
+}
+
+static void readPadding (RequiredReader &r, vector<uint8_t> &dataBytes, string &data, uint64_t &realLen, vector<uint64_t> &reads, mpz_class &hash)
+{
+    data = r.str();
+    r.bytes(dataBytes);
+    realLen = r.u64();
+    reads.resize(r.length(8));
+    for (uint64_t j=0; j<reads.size(); j++) reads[j] = r.u64();
+    r.scalar(hash);
+}
+
+void MainExecRequired::save (const string &fileName) const
+{
+    RequiredWriter w(fileName);
+    if (!w.stream.good())
+    {
+        cerr << "Error: MainExecRequired::save() failed creating file " << fileName << endl;
+        exitProcess();
+    }
+    w.stream.write(MAIN_EXEC_REQUIRED_MAGIC, 8);
+
+    w.u64(Storage.size());
+    for (uint64_t i=0; i<Storage.size(); i++)
+    {
+        const SmtAction &action = Storage[i];
+        w.u64(action.bIsSet);
+        if (action.bIsSet)
+        {
+            const SmtSetResult &res = action.setResult;
+            w.fea(res.oldRoot, 4);
+            w.fea(res.newRoot, 4);
+            w.fea(res.key, 4);
+            w.siblings(res.siblings);
+            w.fea(res.insKey, 4);
+            w.scalar(res.insValue);
+            w.u64(res.isOld0);
+            w.scalar(res.oldValue);
+            w.scalar(res.newValue);
+            w.str(res.mode);
+            w.u64(res.proofHashCounter);
+            w.hashes(res.hashes);
+        }
+        else
+        {
+            const SmtGetResult &res = action.getResult;
+            w.fea(res.root, 4);
+            w.fea(res.key, 4);
+            w.siblings(res.siblings);
+            w.fea(res.insKey, 4);
+            w.scalar(res.insValue);
+            w.u64(res.isOld0);
+            w.scalar(res.value);
+            w.u64(res.proofHashCounter);
+        }
+    }
+
+    w.u64(Memory.size());
+    for (uint64_t i=0; i<Memory.size(); i++)
+    {
+        const MemoryAccess &access = Memory[i];
+        w.u64(access.bIsWrite);
+        w.u64(access.address);
+        w.u64(access.pc);
+        w.fe(access.fe0); w.fe(access.fe1); w.fe(access.fe2); w.fe(access.fe3);
+        w.fe(access.fe4); w.fe(access.fe5); w.fe(access.fe6); w.fe(access.fe7);
+    }
+
+    w.u64(Binary.size());
+    for (uint64_t i=0; i<Binary.size(); i++)
+    {
+        w.scalar(Binary[i].a);
+        w.scalar(Binary[i].b);
+        w.scalar(Binary[i].c);
+        w.u64(Binary[i].opcode);
+    }
+
+    w.u64(Arith.size());
+    for (uint64_t i=0; i<Arith.size(); i++)
+    {
+        const ArithAction &action = Arith[i];
+        w.scalar(action.x1); w.scalar(action.y1);
+        w.scalar(action.x2); w.scalar(action.y2);
+        w.scalar(action.x3); w.scalar(action.y3);
+        w.u64(action.selEq0); w.u64(action.selEq1); w.u64(action.selEq2); w.u64(action.selEq3);
+    }
+
+    w.u64(PaddingKK.size());
+    for (uint64_t i=0; i<PaddingKK.size(); i++)
+    {
+        writePadding(w, PaddingKK[i].dataBytes, PaddingKK[i].data, PaddingKK[i].realLen, PaddingKK[i].reads, PaddingKK[i].hash);
+    }
+
+    w.u64(Byte4.size());
+    for (map<uint32_t, bool>::const_iterator it=Byte4.begin(); it!=Byte4.end(); it++)
+    {
+        w.u64(it->first);
+        w.u64(it->second);
+    }
+
+    w.u64(PaddingPG.size());
+    for (uint64_t i=0; i<PaddingPG.size(); i++)
+    {
+        writePadding(w, PaddingPG[i].dataBytes, PaddingPG[i].data, PaddingPG[i].realLen, PaddingPG[i].reads, PaddingPG[i].hash);
+    }
+
+    w.u64(PoseidonG.size());
+    for (uint64_t i=0; i<PoseidonG.size(); i++)
+    {
+        w.fea(PoseidonG[i].data(), 16);
+    }
+
+    w.u64(MemAlign.size());
+    for (uint64_t i=0; i<MemAlign.size(); i++)
+    {
+        const MemAlignAction &action = MemAlign[i];
+        w.scalar(action.m0); w.scalar(action.m1); w.scalar(action.v); w.scalar(action.w0); w.scalar(action.w1);
+        w.u64(action.offset); w.u64(action.wr8); w.u64(action.wr256);
+    }
+
+    w.stream.close();
+    if (!w.stream.good())
+    {
+        cerr << "Error: MainExecRequired::save() failed writing file " << fileName << endl;
+        exitProcess();
+    }
+}
+
+void MainExecRequired::load (const string &fileName)
+{
+    RequiredReader r(fileName);
+    char magic[8];
+    r.stream.read(magic, 8);
+    if (!r.stream.good() || (memcmp(magic, MAIN_EXEC_REQUIRED_MAGIC, 8) != 0))
+    {
+        cerr << "Error: MainExecRequired::load() found invalid file " << fileName << endl;
+        exitProcess();
+    }
+
+    clear();
+
+    Storage.resize(r.length(8));
+    for (uint64_t i=0; i<Storage.size(); i++)
+    {
+        SmtAction &action = Storage[i];
+        action.bIsSet = r.u64();
+        if (action.bIsSet)
+        {
+            SmtSetResult &res = action.setResult;
+            r.fea(res.oldRoot, 4);
+            r.fea(res.newRoot, 4);
+            r.fea(res.key, 4);
+            r.siblings(res.siblings);
+            r.fea(res.insKey, 4);
+            r.scalar(res.insValue);
+            res.isOld0 = r.u64();
+            r.scalar(res.oldValue);
+            r.scalar(res.newValue);
+            res.mode = r.str();
+            res.proofHashCounter = r.u64();
+            r.hashes(res.hashes);
+        }
+        else
+        {
+            SmtGetResult &res = action.getResult;
+            r.fea(res.root, 4);
+            r.fea(res.key, 4);
+            r.siblings(res.siblings);
+            r.fea(res.insKey, 4);
+            r.scalar(res.insValue);
+            res.isOld0 = r.u64();
+            r.scalar(res.value);
+            res.proofHashCounter = r.u64();
+        }
+    }
+
+    Memory.resize(r.length(11*8));
+    for (uint64_t i=0; i<Memory.size(); i++)
+    {
+        MemoryAccess &access = Memory[i];
+        access.bIsWrite = r.u64();
+        access.address = r.u64();
+        access.pc = r.u64();
+        access.fe0 = r.fe(); access.fe1 = r.fe(); access.fe2 = r.fe(); access.fe3 = r.fe();
+        access.fe4 = r.fe(); access.fe5 = r.fe(); access.fe6 = r.fe(); access.fe7 = r.fe();
+    }
+
+    Binary.resize(r.length(4*8));
+    for (uint64_t i=0; i<Binary.size(); i++)
+    {
+        r.scalar(Binary[i].a);
+        r.scalar(Binary[i].b);
+        r.scalar(Binary[i].c);
+        Binary[i].opcode = r.u64();
+    }
+
+    Arith.resize(r.length(10*8));
+    for (uint64_t i=0; i<Arith.size(); i++)
+    {
+        ArithAction &action = Arith[i];
+        r.scalar(action.x1); r.scalar(action.y1);
+        r.scalar(action.x2); r.scalar(action.y2);
+        r.scalar(action.x3); r.scalar(action.y3);
+        action.selEq0 = r.u64(); action.selEq1 = r.u64(); action.selEq2 = r.u64(); action.selEq3 = r.u64();
+    }
+
+    PaddingKK.resize(r.length(5*8));
+    for (uint64_t i=0; i<PaddingKK.size(); i++)
+    {
+        readPadding(r, PaddingKK[i].dataBytes, PaddingKK[i].data, PaddingKK[i].realLen, PaddingKK[i].reads, PaddingKK[i].hash);
+    }
+
+    uint64_t byte4Size = r.length(2*8);
+    for (uint64_t i=0; i<byte4Size; i++)
+    {
+        uint32_t key = r.u64();
+        Byte4[key] = r.u64();
+    }
+
+    PaddingPG.resize(r.length(5*8));
+    for (uint64_t i=0; i<PaddingPG.size(); i++)
+    {
+        readPadding(r, PaddingPG[i].dataBytes, PaddingPG[i].data, PaddingPG[i].realLen, PaddingPG[i].reads, PaddingPG[i].hash);
+    }
+
+    PoseidonG.resize(r.length(16*8));
+    for (uint64_t i=0; i<PoseidonG.size(); i++)
+    {
+        r.fea(PoseidonG[i].data(), 16);
+    }
+
+    MemAlign.resize(r.length(8*8));
+    for (uint64_t i=0; i<MemAlign.size(); i++)
+    {
+        MemAlignAction &action = MemAlign[i];
+        r.scalar(action.m0); r.scalar(action.m1); r.scalar(action.v); r.scalar(action.w0); r.scalar(action.w1);
+        action.offset = r.u64(); action.wr8 = r.u64(); action.wr256 = r.u64();
+    }
+}
@@ -14,6 +14,7 @@
 #include "sm/memory/memory_executor.hpp"
 #include "sm/padding_pg/padding_pg_executor.hpp"
 #include "sm/mem_align/mem_align_executor.hpp"
+#include "counters.hpp"
 
 using namespace std;
 
@@ -27,12 +28,46 @@ public:
     vector<PaddingKKExecutorInput> PaddingKK;
     vector<PaddingKKBitExecutorInput> PaddingKKBit;
     vector<Nine2OneExecutorInput> Nine2One;
-    vector<vector<Goldilocks::Element>> KeccakF;
+    vector<Goldilocks::Element> KeccakF; // Contiguous Keccak-f inputs, 1600 fe per slot
     vector<NormGate9ExecutorInput> NormGate9;
     map<uint32_t, bool> Byte4;
     vector<PaddingPGExecutorInput> PaddingPG;
     vector<array<Goldilocks::Element, 16>> PoseidonG;
     vector<MemAlignAction> MemAlign;
+
+    // Saves the inputs generated by the main executor into a binary file, and loads them back,
+    // so that the secondary state machines can be replayed and benchmarked in isolation
+    void save (const string &fileName) const;
+    void load (const string &fileName);
+
+    // Reserves room for the actions of an execution with the given counters, since every arith,
+    // binary, mem align and poseidon operation of the main executor pushes one action
+    void reserve (const Counters &counters)
+    {
+        Arith.reserve(counters.arith);
+        Binary.reserve(counters.binary);
+        MemAlign.reserve(counters.memAlign);
+        PoseidonG.reserve(counters.poseidonG);
+    }
+
+    // Removes all the actions but keeps the allocated buffers, so that an instance reused across
+    // executions does not reallocate (and copy) them while the main executor pushes into them
+    void clear (void)
+    {
+        Storage.clear();
+        Memory.clear();
+        Binary.clear();
+        Arith.clear();
+        PaddingKK.clear();
+        PaddingKKBit.clear();
+        Nine2One.clear();
+        KeccakF.clear();
+        NormGate9.clear();
+        Byte4.clear();
+        PaddingPG.clear();
+        PoseidonG.clear();
+        MemAlign.clear();
+    }
 };
 
 #endif
\ No newline at end of file
@@ -50,6 +50,12 @@ MainExecutor::MainExecutor (Goldilocks &fr, PoseidonGoldilocks &poseidon, const
         exitProcess();
     }
 
+    /* Get the contract bytecode digests cache, if enabled */
+    pProgramCache = ProgramCache::getInstance(config);
+
+    /* Get the counters limits, from the degree of the secondary state machines polynomials */
+    getCountersLimits(countersLimits);
+
     /* Load and parse ROM JSON file */
 
     TimerStart(ROM_LOAD);
@@ -95,22 +101,36 @@ MainExecutor::~MainExecutor ()
     StateDBClientFactory::freeStateDBClient(pStateDB);
 }
 
+void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols, MainExecRequired &required)
+{
+    // Every bFastMode check of the step loop is resolved at compile time
+    if (proverRequest.bFastMode)
+    {
+        execute<true>(proverRequest, pols, required);
+    }
+    else
+    {
+        execute<false>(proverRequest, pols, required);
+    }
+}
+
+template <bool bFastMode>
 void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols, MainExecRequired &required)
 {
     TimerStart(EXECUTE_INITIALIZATION);
     
-#ifdef LOG_TIME
     uint64_t poseidonTime=0, poseidonTimes=0;
     uint64_t smtTime=0, smtTimes=0;
     uint64_t keccakTime=0, keccakTimes=0;
-#endif
 
-    bool &bFastMode(proverRequest.bFastMode);
     bool &bProcessBatch(proverRequest.bProcessBatch);
 
     // Create context and store a finite field reference in it
     Context ctx(fr, fec, fnec, pols, rom, proverRequest);
 
+    // Only the Storage SM uses the hashes calculated by the SMT, so do not record them in fast mode
+    ctx.lastSWrite.res.bHashes = !bFastMode;
+
 #ifdef LOG_COMPLETED_STEPS_TO_FILE
     remove("c.txt");
 #endif
@@ -187,6 +207,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
 
         uint64_t incHashPos = 0;
         uint64_t incCounter = 0;
+        bool bIncCounters = false;
 
 #ifdef LOG_START_STEPS
         cout << "--> Starting step=" << step << " zkPC=" << zkPC << " zkasm=" << rom.line[zkPC].lineStr << endl;
@@ -732,10 +753,8 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                     Kin1[6] = pols.B0[i];
                     Kin1[7] = pols.B1[i];
 
-#ifdef LOG_TIME
                     struct timeval t;
                     gettimeofday(&t, NULL);
-#endif
                     // Prepare PoseidonG required data
                     array<Goldilocks::Element,16> pg;
                     if (!bFastMode) for (uint64_t j=0; j<12; j++) pg[j] = Kin0[j];
@@ -782,10 +801,8 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                     key[1] = Kin1Hash[1];
                     key[2] = Kin1Hash[2];
                     key[3] = Kin1Hash[3];
-#ifdef LOG_TIME
                     poseidonTime += TimeDiff(t);
                     poseidonTimes+=3;
-#endif
 
 #ifdef LOG_STORAGE
                     cout << "Storage read sRD got poseidon key: " << ctx.fr.toString(ctx.lastSWrite.key, 16) << endl;
@@ -862,10 +879,8 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                     Kin1[6] = pols.B0[i];
                     Kin1[7] = pols.B1[i];
 
-#ifdef LOG_TIME
                     struct timeval t;
                     gettimeofday(&t, NULL);
-#endif
 
                     // Prepare PoseidonG required data
                     array<Goldilocks::Element,16> pg;
@@ -916,10 +931,8 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                     ctx.lastSWrite.key[1] = Kin1Hash[1];
                     ctx.lastSWrite.key[2] = Kin1Hash[2];
                     ctx.lastSWrite.key[3] = Kin1Hash[3];
-#ifdef LOG_TIME
                     poseidonTime += TimeDiff(t);
                     poseidonTimes++;
-#endif
 
 #ifdef LOG_STORAGE
                     cout << "Storage write sWR got poseidon key: " << ctx.fr.toString(ctx.lastSWrite.key, 16) << endl;
@@ -937,9 +950,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                     // Call SMT to get the new Merkel Tree root hash
                     mpz_class scalarD;
                     fea2scalar(fr, scalarD, pols.D0[i], pols.D1[i], pols.D2[i], pols.D3[i], pols.D4[i], pols.D5[i], pols.D6[i], pols.D7[i]);
-#ifdef LOG_TIME
                     gettimeofday(&t, NULL);
-#endif
                     Goldilocks::Element oldRoot[4];
                     sr8to4(fr, pols.SR0[i], pols.SR1[i], pols.SR2[i], pols.SR3[i], pols.SR4[i], pols.SR5[i], pols.SR6[i], pols.SR7[i], oldRoot[0], oldRoot[1], oldRoot[2], oldRoot[3]);
                     
@@ -951,10 +962,10 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                         return;
                     }
                     incCounter = ctx.lastSWrite.res.proofHashCounter + 2;
-#ifdef LOG_TIME
-                    smtTime += TimeDiff(t);
+                    uint64_t smtSetTime = TimeDiff(t);
+                    smtTime += smtSetTime;
                     smtTimes++;
-#endif
+                    metrics.histogramAdd("MAIN_EXECUTOR_SMT_SET_US", smtSetTime);
                     ctx.lastSWrite.step = i;
 
                     sr4to8(fr, ctx.lastSWrite.newRoot[0], ctx.lastSWrite.newRoot[1], ctx.lastSWrite.newRoot[2], ctx.lastSWrite.newRoot[3], fi0, fi1, fi2, fi3, fi4, fi5, fi6, fi7);
@@ -1504,10 +1515,8 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
             Kin1[6] = pols.B0[i];
             Kin1[7] = pols.B1[i];
 
-#ifdef LOG_TIME
             struct timeval t;
             gettimeofday(&t, NULL);
-#endif
             // Call poseidon and get the hash key
             Goldilocks::Element Kin0Hash[4];
             poseidon.hash(Kin0Hash, Kin0);
@@ -1532,10 +1541,8 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
             key[2] = Kin1Hash[2];
             key[3] = Kin1Hash[3];
 
-#ifdef LOG_TIME
             poseidonTime += TimeDiff(t);
             poseidonTimes+=3;
-#endif
 
 #ifdef LOG_STORAGE
             cout << "Storage read sRD got poseidon key: " << ctx.fr.toString(ctx.lastSWrite.key, 16) << endl;
@@ -1637,10 +1644,8 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 Kin1[6] = pols.B0[i];
                 Kin1[7] = pols.B1[i];
 
-#ifdef LOG_TIME
                 struct timeval t;
                 gettimeofday(&t, NULL);
-#endif
                 // Call poseidon and get the hash key
                 Goldilocks::Element Kin0Hash[4];
                 poseidon.hash(Kin0Hash, Kin0);
@@ -1663,10 +1668,8 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 ctx.lastSWrite.key[2] = Kin1Hash[2];
                 ctx.lastSWrite.key[3] = Kin1Hash[3];
                 
-#ifdef LOG_TIME
                 poseidonTime += TimeDiff(t);
                 poseidonTimes++;
-#endif
 
 #ifdef USE_LOCAL_STORAGE
                 // Check that storage entry exists
@@ -1681,9 +1684,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // Call SMT to get the new Merkel Tree root hash
                 mpz_class scalarD;
                 fea2scalar(fr, scalarD, pols.D0[i], pols.D1[i], pols.D2[i], pols.D3[i], pols.D4[i], pols.D5[i], pols.D6[i], pols.D7[i]);
-#ifdef LOG_TIME
                 gettimeofday(&t, NULL);
-#endif
                 Goldilocks::Element oldRoot[4];
                 sr8to4(fr, pols.SR0[i], pols.SR1[i], pols.SR2[i], pols.SR3[i], pols.SR4[i], pols.SR5[i], pols.SR6[i], pols.SR7[i], oldRoot[0], oldRoot[1], oldRoot[2], oldRoot[3]);
 
@@ -1695,10 +1696,10 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                     return;
                 }
                 incCounter = ctx.lastSWrite.res.proofHashCounter + 2;
-#ifdef LOG_TIME
-                smtTime += TimeDiff(t);
+                uint64_t smtSetTime = TimeDiff(t);
+                smtTime += smtSetTime;
                 smtTimes++;
-#endif
+                metrics.histogramAdd("MAIN_EXECUTOR_SMT_SET_US", smtSetTime);
                 ctx.lastSWrite.step = i;
             }
 
@@ -1856,17 +1857,13 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
             }
             if (!ctx.hashK[addr].bDigested)
             {
-#ifdef LOG_TIME
                 struct timeval t;
                 gettimeofday(&t, NULL);
-#endif
                 string digestString = keccak256(ctx.hashK[addr].data.data(), ctx.hashK[addr].data.size());
                 ctx.hashK[addr].digest.set_str(Remove0xIfPresent(digestString),16);
                 ctx.hashK[addr].bDigested = true;
-#ifdef LOG_TIME
                 keccakTime += TimeDiff(t);
                 keccakTimes++;
-#endif
 
 #ifdef LOG_HASHK
                 cout << "hashKLen 2 calculate hashKLen: addr:" << addr << " hash:" << ctx.hashK[addr].digest.get_str(16) << " size:" << ctx.hashK[addr].data.size() << " data:";
@@ -2009,10 +2006,8 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
             }
             if (!ctx.hashP[addr].bDigested)
             {
-#ifdef LOG_TIME
                 struct timeval t;
                 gettimeofday(&t, NULL);
-#endif
                 if (ctx.hashP[addr].data.size() == 0)
                 {
                     cerr << "Error: hashPLen 2 found data empty" << endl;
@@ -2020,51 +2015,76 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                     return;
                 }
 
-                // Get a local copy of the bytes vector
-                vector<uint8_t> data = ctx.hashP[addr].data;
-
-                // Add padding = 0b1000...00001  up to a length of 56xN (7x8xN)
-                data.push_back(0x01);
-                while((data.size() % 56) != 0) data.push_back(0);
-                data[data.size()-1] |= 0x80;
-
-                // Create a FE buffer to store the transformed bytes into fe
-                uint64_t bufferSize = data.size()/7;
-                Goldilocks::Element * pBuffer = new Goldilocks::Element[bufferSize];
-                if (pBuffer == NULL)
+                // Get the digest from the cache, if present, and check if the program is already stored
+                const vector<uint8_t> &data = ctx.hashP[addr].data;
+                Goldilocks::Element result[4];
+                bool bCached = false;
+                bool bStored = false;
+                if (pProgramCache != NULL)
                 {
-                    cerr << "Error: hashPLen 2 failed allocating memory of " << bufferSize << " field elements" << endl;
-                    exitProcess();
+                    bCached = pProgramCache->get(data, result, bStored);
+                    metrics.counterAdd(bCached ? "PROGRAM_CACHE_HITS" : "PROGRAM_CACHE_MISSES", 1);
                 }
-                for (uint64_t j=0; j<bufferSize; j++) pBuffer[j] = fr.zero();
 
-                // Copy the bytes into the fe lower 7 sections
-                for (uint64_t j=0; j<data.size(); j++)
+                if (!bCached)
                 {
-                    uint64_t fePos = j/7;
-                    uint64_t shifted = uint64_t(data[j]) << ((j%7)*8);
-                    pBuffer[fePos] = fr.add(pBuffer[fePos], fr.fromU64(shifted));
-                    //cout << "fePos=" << fePos << " data=" << to_string(data[j]) << " shifted=" << shifted << " fe=" << fr.toString(pBuffer[fePos],16) << endl;
+                    // Add padding = 0b1000...00001  up to a length of 56xN (7x8xN)
+                    uint64_t paddedSize = ((data.size() + 1 + 55) / 56) * 56;
+
+                    // Create a FE buffer to store the transformed bytes into fe
+                    uint64_t bufferSize = paddedSize/7;
+                    Goldilocks::Element * pBuffer = new Goldilocks::Element[bufferSize];
+                    if (pBuffer == NULL)
+                    {
+                        cerr << "Error: hashPLen 2 failed allocating memory of " << bufferSize << " field elements" << endl;
+                        exitProcess();
+                    }
+
+                    // Copy the padded bytes into the fe lower 7 sections; 7 bytes are always lower than the field prime
+                    for (uint64_t fePos=0; fePos<bufferSize; fePos++)
+                    {
+                        uint64_t fe = 0;
+                        for (uint64_t k=0; k<7; k++)
+                        {
+                            uint64_t j = fePos*7 + k;
+                            uint64_t byte = (j < data.size()) ? data[j] : 0;
+                            if (j == data.size()) byte |= 0x01;
+                            if (j == paddedSize - 1) byte |= 0x80;
+                            fe |= byte << (k*8);
+                        }
+                        pBuffer[fePos] = fr.fromU64(fe);
+                    }
+
+                    poseidon.linear_hash(result, pBuffer, bufferSize);
+                    delete[] pBuffer;
                 }
 
-                Goldilocks::Element result[4];
-                poseidon.linear_hash(result, pBuffer, bufferSize);
                 fea2scalar(fr, ctx.hashP[addr].digest, result);
                 //cout << "ctx.hashP[" << addr << "].digest=" << ctx.hashP[addr].digest.get_str(16) << endl;
-                delete[] pBuffer;
                 ctx.hashP[addr].bDigested = true;
 
-                zkresult zkResult = pStateDB->setProgram(result, ctx.hashP[addr].data, proverRequest.bUpdateMerkleTree);
-                if (zkResult != ZKR_SUCCESS)
+                // Store the program in the StateDB, unless it is known to be there already
+                if (bStored)
                 {
-                    cerr << "MainExecutor::Execute() failed calling pStateDB->setProgram() result=" << zkresult2string(zkResult) << endl;
-                    proverRequest.result = zkResult;
-                    return;
+                    metrics.counterAdd("PROGRAM_CACHE_SET_PROGRAM_SKIPPED", 1);
+                }
+                else
+                {
+                    zkresult zkResult = pStateDB->setProgram(result, data, proverRequest.bUpdateMerkleTree);
+                    if (zkResult != ZKR_SUCCESS)
+                    {
+                        cerr << "MainExecutor::Execute() failed calling pStateDB->setProgram() result=" << zkresult2string(zkResult) << endl;
+                        proverRequest.result = zkResult;
+                        return;
+                    }
+                    if (pProgramCache != NULL)
+                    {
+                        // Only a persistent program in the local StateDB is known to survive until the next batch
+                        pProgramCache->set(data, result, proverRequest.bUpdateMerkleTree && (config.stateDBURL == "local"));
+                    }
                 }
-#ifdef LOG_TIME
                 poseidonTime += TimeDiff(t);
                 poseidonTimes++;
-#endif
 
 #ifdef LOG_HASH
                 cout << "Hash calculate hashPLen 2: addr:" << addr << " hash:" << ctx.hashP[addr].digest.get_str(16) << " size:" << ctx.hashP[addr].data.size() << " data:";
@@ -2878,6 +2898,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         // If arith, increment pols.cntArith
         if (rom.line[zkPC].arith) {
             pols.cntArith[nexti] = fr.add(pols.cntArith[i], fr.one());
+            bIncCounters = true;
         } else {
             pols.cntArith[nexti] = pols.cntArith[i];
         }
@@ -2885,6 +2906,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         // If bin, increment pols.cntBinary
         if (rom.line[zkPC].bin) {
             pols.cntBinary[nexti] = fr.add(pols.cntBinary[i], fr.one());
+            bIncCounters = true;
         } else {
             pols.cntBinary[nexti] = pols.cntBinary[i];
         }
@@ -2892,6 +2914,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         // If memAlign, increment pols.cntMemAlign
         if (rom.line[zkPC].memAlign) {
             pols.cntMemAlign[nexti] = fr.add(pols.cntMemAlign[i], fr.one());
+            bIncCounters = true;
         } else {
             pols.cntMemAlign[nexti] = pols.cntMemAlign[i];
         }
@@ -3033,6 +3056,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         if (rom.line[zkPC].hashKDigest)
         {
             pols.cntKeccakF[nexti] = fr.add(pols.cntKeccakF[i], fr.fromU64(incCounter));
+            bIncCounters = true;
         }
         else
         {
@@ -3042,6 +3066,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         if (rom.line[zkPC].hashPDigest)
         {
             pols.cntPaddingPG[nexti] = fr.add(pols.cntPaddingPG[i], fr.fromU64(incCounter));
+            bIncCounters = true;
         }
         else
         {
@@ -3051,12 +3076,36 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         if (rom.line[zkPC].sRD || rom.line[zkPC].sWR || rom.line[zkPC].hashPDigest)
         {
             pols.cntPoseidonG[nexti] = fr.add(pols.cntPoseidonG[i], fr.fromU64(incCounter));
+            bIncCounters = true;
         }
         else
         {
             pols.cntPoseidonG[nexti] = pols.cntPoseidonG[i];
         }
 
+        // If any counter exceeds the capacity of its state machine, abort the execution now, instead
+        // of failing later when executing the secondary state machines, so that the batch can be resized
+        if (bIncCounters)
+        {
+            copyCounters(proverRequest, pols, nexti, step);
+            string counterName;
+            if (proverRequest.counters.exceeds(countersLimits, counterName))
+            {
+                cout << "MainExecutor::execute() out of counters: " << counterName << " step=" << step << " zkPC=" << zkPC << " arith=" << proverRequest.counters.arith << " binary=" << proverRequest.counters.binary << " memAlign=" << proverRequest.counters.memAlign << " keccakF=" << proverRequest.counters.keccakF << " poseidonG=" << proverRequest.counters.poseidonG << " paddingPG=" << proverRequest.counters.paddingPG << endl;
+                proverRequest.result = ZKR_SM_MAIN_OUT_OF_COUNTERS;
+                return;
+            }
+        }
+
+        // Abort the execution if the full tracer listener does not need it any more, e.g. because the
+        // stream client is gone; it is checked periodically, since it can require a lock
+        if (((step & 0x3FF) == 0) && (proverRequest.fullTracer.pListener != NULL) && proverRequest.fullTracer.pListener->isCancelled())
+        {
+            cout << "MainExecutor::execute() cancelled by the full tracer listener at step=" << step << endl;
+            proverRequest.result = ZKR_SM_MAIN_CANCELLED;
+            return;
+        }
+
         // Evaluate the list cmdAfter commands, and any children command, recursively
         for (uint64_t j=0; j<rom.line[zkPC].cmdAfter.size(); j++)
         {
@@ -3077,14 +3126,17 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
 
     } // End of main executor loop, for all evaluations
 
+    // If the program did not reach its last step, it does not fit in the main state machine
+    if (ctx.lastStep == 0)
+    {
+        copyCounters(proverRequest, pols, 0, N);
+        cout << "MainExecutor::execute() out of counters: steps=" << N << endl;
+        proverRequest.result = ZKR_SM_MAIN_OUT_OF_COUNTERS;
+        return;
+    }
+
     // Copy the counters
-    proverRequest.counters.arith = fr.toU64(pols.cntArith[0]);
-    proverRequest.counters.binary = fr.toU64(pols.cntBinary[0]);
-    proverRequest.counters.keccakF = fr.toU64(pols.cntKeccakF[0]);
-    proverRequest.counters.memAlign = fr.toU64(pols.cntMemAlign[0]);
-    proverRequest.counters.paddingPG = fr.toU64(pols.cntPaddingPG[0]);
-    proverRequest.counters.poseidonG = fr.toU64(pols.cntPoseidonG[0]);
-    proverRequest.counters.steps = ctx.lastStep;
+    copyCounters(proverRequest, pols, 0, ctx.lastStep);
 
     TimerStopAndLog(EXECUTE_LOOP);
     
@@ -3160,6 +3212,28 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
 
     TimerStopAndLog(EXECUTE_CLEANUP);
 
+    // When the SMT runs here against a StateDB node store, send the buffered nodes, so that the new
+    // state root can be read by other clients of the StateDB server; if they cannot be stored, the
+    // new state root must not be returned
+    if (proverRequest.bUpdateMerkleTree && (config.databaseURL.substr(0, 10) == "statedb://"))
+    {
+        zkresult zkResult = pStateDB->flush();
+        if (zkResult != ZKR_SUCCESS)
+        {
+            cerr << "Error: MainExecutor::execute() failed calling pStateDB->flush() result=" << zkresult2string(zkResult) << endl;
+            proverRequest.result = zkResult;
+            return;
+        }
+    }
+
+    // Accumulate the hash and SMT statistics of this execution
+    metrics.counterAdd("MAIN_EXECUTOR_POSEIDON_US", poseidonTime);
+    metrics.counterAdd("MAIN_EXECUTOR_POSEIDON_CALLS", poseidonTimes);
+    metrics.counterAdd("MAIN_EXECUTOR_SMT_US", smtTime);
+    metrics.counterAdd("MAIN_EXECUTOR_SMT_CALLS", smtTimes);
+    metrics.counterAdd("MAIN_EXECUTOR_KECCAK_US", keccakTime);
+    metrics.counterAdd("MAIN_EXECUTOR_KECCAK_CALLS", keccakTimes);
+
 #ifdef LOG_TIME
     cout << "TIMER STATISTICS: Poseidon time: " << double(poseidonTime)/1000 << " ms, called " << poseidonTimes << " times, so " << poseidonTime/zkmax(poseidonTimes,(uint64_t)1) << " us/time" << endl;
     cout << "TIMER STATISTICS: SMT time: " << double(smtTime)/1000 << " ms, called " << smtTimes << " times, so " << smtTime/zkmax(smtTimes,(uint64_t)1) << " us/time" << endl;
@@ -3233,3 +3307,14 @@ void MainExecutor::checkFinalState(Context &ctx)
         exitProcess();
     }
 }
+
+void MainExecutor::copyCounters (ProverRequest &proverRequest, MainCommitPols &pols, uint64_t i, uint64_t steps)
+{
+    proverRequest.counters.arith = fr.toU64(pols.cntArith[i]);
+    proverRequest.counters.binary = fr.toU64(pols.cntBinary[i]);
+    proverRequest.counters.keccakF = fr.toU64(pols.cntKeccakF[i]);
+    proverRequest.counters.memAlign = fr.toU64(pols.cntMemAlign[i]);
+    proverRequest.counters.paddingPG = fr.toU64(pols.cntPaddingPG[i]);
+    proverRequest.counters.poseidonG = fr.toU64(pols.cntPoseidonG[i]);
+    proverRequest.counters.steps = steps;
+}
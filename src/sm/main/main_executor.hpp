@@ -15,6 +15,7 @@
 #include "sm/pols_generated/commit_pols.hpp"
 #include "main_exec_required.hpp"
 #include "prover_request.hpp"
+#include "program_cache.hpp"
 
 using namespace std;
 using json = nlohmann::json;
@@ -43,9 +44,15 @@ public:
     // StateDB interface
     StateDBInterface *pStateDB;
 
+    // Process-wide contract bytecode digests cache, or NULL if disabled
+    ProgramCache *pProgramCache;
+
     // Database server configuration, if any
     const Config &config;
 
+    // Maximum values of the counters, checked at every step to abort as soon as any of them is exceeded
+    Counters countersLimits;
+
     // Constructor
     MainExecutor(Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config);
     
@@ -56,8 +63,14 @@ public:
 
 private:
 
+    // Executor specialized at compile time for fast mode, in which only the registers of the current
+    // evaluation are kept and no required data is generated, or for full mode, which fills all pols
+    template <bool bFastMode>
+    void execute (ProverRequest &proverRequest, MainCommitPols &cmPols, MainExecRequired &required);
+
     void initState(Context &ctx);
     void checkFinalState(Context &ctx);
+    void copyCounters(ProverRequest &proverRequest, MainCommitPols &pols, uint64_t i, uint64_t steps);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include <string_view>
+#include "program_cache.hpp"
+#include "utils.hpp"
+
+ProgramCache * ProgramCache::getInstance (const Config &config)
+{
+    if (config.programCacheSize == 0)
+    {
+        return NULL;
+    }
+
+    // Every main executor calls this from its constructor, possibly from different threads;
+    // the initialization of a function-local static is thread-safe, so only one is created
+    static ProgramCache programCache(config.programCacheSize*1024*1024);
+    return &programCache;
+}
+
+ProgramCache::ProgramCache (uint64_t maxSize) : maxSize(maxSize), size(0)
+{
+    pthread_mutex_init(&mutex, NULL);
+}
+
+ProgramCache::~ProgramCache ()
+{
+    pthread_mutex_destroy(&mutex);
+}
+
+uint64_t ProgramCache::preHash (const vector<uint8_t> &data)
+{
+    return hash<string_view>()(string_view((const char *)data.data(), data.size()));
+}
+
+list<ProgramCacheEntry>::iterator ProgramCache::find (const vector<uint8_t> &data, uint64_t hash)
+{
+    // Different bytecodes can share the same pre-hash, so compare the whole bytecode
+    auto range = index.equal_range(hash);
+    for (auto it = range.first; it != range.second; it++)
+    {
+        if (it->second->data == data) return it->second;
+    }
+    return entries.end();
+}
+
+bool ProgramCache::get (const vector<uint8_t> &data, Goldilocks::Element (&digest)[4], bool &bStored)
+{
+    uint64_t hash = preHash(data);
+
+    pthread_mutex_lock(&mutex);
+
+    list<ProgramCacheEntry>::iterator it = find(data, hash);
+    if (it == entries.end())
+    {
+        pthread_mutex_unlock(&mutex);
+        return false;
+    }
+
+    // Move it to the front of the list, as the most recently used entry
+    entries.splice(entries.begin(), entries, it);
+
+    for (uint64_t i=0; i<4; i++) digest[i] = it->digest[i];
+    bStored = it->bStored;
+
+    pthread_mutex_unlock(&mutex);
+    return true;
+}
+
+void ProgramCache::set (const vector<uint8_t> &data, const Goldilocks::Element (&digest)[4], bool bStored)
+{
+    // Programs bigger than the whole cache are not cached
+    if (data.size() > maxSize) return;
+
+    uint64_t hash = preHash(data);
+
+    pthread_mutex_lock(&mutex);
+
+    list<ProgramCacheEntry>::iterator it = find(data, hash);
+    if (it == entries.end())
+    {
+        // Evict the least recently used entries until the new one fits
+        while ((size + data.size() > maxSize) && (entries.size() > 0))
+        {
+            list<ProgramCacheEntry>::iterator last = prev(entries.end());
+            auto range = index.equal_range(preHash(last->data));
+            for (auto indexIt = range.first; indexIt != range.second; indexIt++)
+            {
+                if (indexIt->second == last)
+                {
+                    index.erase(indexIt);
+                    break;
+                }
+            }
+            size -= last->data.size();
+            entries.erase(last);
+        }
+
+        ProgramCacheEntry entry;
+        entry.data = data;
+        for (uint64_t i=0; i<4; i++) entry.digest[i] = digest[i];
+        entry.bStored = false;
+        entries.push_front(entry);
+        it = entries.begin();
+        index.insert(make_pair(hash, it));
+        size += data.size();
+    }
+
+    if (bStored) it->bStored = true;
+
+    pthread_mutex_unlock(&mutex);
+}
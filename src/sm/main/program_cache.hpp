@@ -0,0 +1,59 @@
+#ifndef PROGRAM_CACHE_HPP
+#define PROGRAM_CACHE_HPP
+
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <pthread.h>
+#include "goldilocks_base_field.hpp"
+#include "config.hpp"
+
+using namespace std;
+
+/*
+    Process-wide cache of contract bytecode Poseidon digests, shared by all the main executors
+    Popular contracts (bridges, tokens, etc.) are hashed in almost every batch; with this cache
+    their linear hash is calculated only once, and their bytecode is sent to the StateDB only
+    once when it is stored persistently by the local StateDB, which then keeps it forever; a
+    remote StateDB can be restarted or replaced by another server, and non-persistent programs
+    are lost when the process restarts, so in those cases setProgram() is always called
+    Entries are found by a fast pre-hash of the bytecode, verified against the whole bytecode,
+    and the least recently used ones are evicted when the total bytecode size exceeds the limit
+*/
+
+class ProgramCacheEntry
+{
+public:
+    vector<uint8_t> data;
+    Goldilocks::Element digest[4];
+    bool bStored; // setProgram() has succeeded with persistent=true on the local StateDB, so it is in the database
+};
+
+class ProgramCache
+{
+private:
+    pthread_mutex_t mutex;
+    uint64_t maxSize; // Maximum total bytecode size, in bytes
+    uint64_t size; // Current total bytecode size, in bytes
+    list<ProgramCacheEntry> entries; // Most recently used first
+    unordered_multimap<uint64_t, list<ProgramCacheEntry>::iterator> index; // Pre-hash to entry
+
+    static uint64_t preHash (const vector<uint8_t> &data);
+    list<ProgramCacheEntry>::iterator find (const vector<uint8_t> &data, uint64_t hash);
+
+public:
+    ProgramCache(uint64_t maxSize);
+    ~ProgramCache();
+
+    // Returns true if the bytecode digest is cached, and in bStored if setProgram() can be skipped
+    bool get (const vector<uint8_t> &data, Goldilocks::Element (&digest)[4], bool &bStored);
+
+    // Stores a bytecode digest, after setProgram() succeeded; bStored must be true only if it was
+    // stored persistently by the local StateDB
+    void set (const vector<uint8_t> &data, const Goldilocks::Element (&digest)[4], bool bStored);
+
+    // Returns the process-wide instance, or NULL if disabled by config.programCacheSize
+    static ProgramCache * getInstance (const Config &config);
+};
+
+#endif
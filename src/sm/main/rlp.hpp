@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 inline int codingUInt64(std::string &data, uint64_t value, uint8_t codingBase = 0)
 {
@@ -101,5 +102,44 @@ inline int getHexValueLen(const std::string &hex)
     return (len >> 1);
 }
 
+// Splits the batch L2 data, as raw bytes, into its transactions, every one of them an RLP list
+// followed by the r (32 bytes), s (32 bytes) and v (1 byte) signature fields, and returns the offset
+// where every transaction ends; returns false if the data is not a sequence of such transactions
+inline bool getBatchTxsEnds(const std::string &batchL2Data, std::vector<uint64_t> &ends)
+{
+    const uint8_t *pdata = (const uint8_t *)batchL2Data.data();
+    uint64_t size = batchL2Data.size();
+    uint64_t p = 0;
+    while (p < size)
+    {
+        uint8_t prefix = pdata[p];
+        uint64_t listLen;
+        if (prefix < 0xc0) {
+            return false;
+        }
+        if (prefix <= 0xf7) {
+            listLen = prefix - 0xc0;
+            p += 1;
+        } else {
+            uint64_t lenLen = prefix - 0xf7;
+            if (lenLen > 8 || p + 1 + lenLen > size) {
+                return false;
+            }
+            listLen = 0;
+            for (uint64_t i = 0; i < lenLen; ++i) {
+                listLen = (listLen << 8) | pdata[p + 1 + i];
+            }
+            p += 1 + lenLen;
+        }
+        // Compared without adding to listLen, which can be up to 2^64-1 and would wrap around
+        if (listLen > size - p || size - p - listLen < 65) {
+            return false;
+        }
+        p += listLen + 65;
+        ends.push_back(p);
+    }
+    return true;
+}
+
 
 #endif
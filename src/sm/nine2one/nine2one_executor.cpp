@@ -2,14 +2,18 @@
 #include "nine2one_executor.hpp"
 #include "zkassert.hpp"
 
-void Nine2OneExecutor::execute (vector<Nine2OneExecutorInput> &input, Nine2OneCommitPols &pols, vector<vector<Goldilocks::Element>> &required)
+void Nine2OneExecutor::execute (vector<Nine2OneExecutorInput> &input, Nine2OneCommitPols &pols, vector<Goldilocks::Element> &required)
 {
     uint64_t p = 1;
     Goldilocks::Element accField9 = fr.zero();
 
+    // Every slot provides 1600 fe to the Keccak-f SM; write them directly into the contiguous buffer
+    uint64_t requiredOffset = required.size();
+    required.resize(requiredOffset + nSlots9*1600);
+
     for (uint64_t i=0; i<nSlots9; i++)
     {
-        vector<Goldilocks::Element> keccakFSlot;
+        Goldilocks::Element * keccakFSlot = &required[requiredOffset + i*1600];
 
         for (uint64_t j=0; j<1600; j++)
         {
@@ -27,7 +31,7 @@ void Nine2OneExecutor::execute (vector<Nine2OneExecutorInput> &input, Nine2OneCo
                 }
                 p++;
             }
-            keccakFSlot.push_back(accField9);
+            keccakFSlot[j] = accField9;
         }
 
         for (uint64_t j=0; j<1600; j++)
@@ -48,8 +52,6 @@ void Nine2OneExecutor::execute (vector<Nine2OneExecutorInput> &input, Nine2OneCo
             }
         }
 
-        required.push_back(keccakFSlot);
-
         //pols.bit[p] = fr.zero();
         pols.field9[p] = accField9;
         accField9 = fr.zero();
@@ -26,7 +26,7 @@ public:
         slotSize(158418),
         N(Nine2OneCommitPols::pilDegree()),
         nSlots9((N-1)/slotSize) {};
-    void execute (vector<Nine2OneExecutorInput> &input, Nine2OneCommitPols &pols, vector<vector<Goldilocks::Element>> &required);
+    void execute (vector<Nine2OneExecutorInput> &input, Nine2OneCommitPols &pols, vector<Goldilocks::Element> &required);
 private:
     Goldilocks::Element bitFromState (uint64_t (&st)[5][5][2], uint64_t i);
     Goldilocks::Element getBit (vector<Nine2OneExecutorInput> &input, uint64_t block, bool isOut, uint64_t pos);
@@ -1,5 +1,5 @@
 #include "padding_kkbit_executor.hpp"
-#include "sm/keccak_f/keccak.hpp"
+#include "XKCP/Keccak-more-compact.hpp"
 
 
 uint64_t bitFromState (const uint64_t (&st)[5][5][2], uint64_t i)
@@ -13,111 +13,119 @@ uint64_t bitFromState (const uint64_t (&st)[5][5][2], uint64_t i)
     return (st[x][y][z1] >> z2) & 1;
 }
 
-void setStateBit (uint64_t (&st)[5][5][2], uint64_t i, uint64_t b)
+// Converts the state from the [x][y][z1] 32-bit halves layout into the Keccak-f byte layout, i.e.
+// 25 lanes of 64 bits stored in little endian, lane (x,y) starting at byte 8*(x+5*y)
+void state2bytes (const uint64_t (&st)[5][5][2], uint8_t (&bytes)[200])
 {
-    uint64_t y = i/320;
-    uint64_t x = (i%320)/64;
-    uint64_t z = i%64;
-    uint64_t z1 = z/32;
-    uint64_t z2 = z%32;
-
-    st[x][y][z1] ^=  (b << z2);
-}
-
-void callKeccakF (const uint64_t (&input)[5][5][2], uint64_t (&output)[5][5][2])
-{
-    // Copy input into state S
-    KeccakState S;
-    for (uint64_t i=0; i<1600; i++)
+    for (uint64_t y=0; y<5; y++)
     {
-        uint8_t bit = bitFromState(input, i);
-        S.gate[SinRef0 + i*9].pin[pin_a].bit = bit;
+        for (uint64_t x=0; x<5; x++)
+        {
+            uint64_t lane = (st[x][y][0] & 0xFFFFFFFF) | (st[x][y][1] << 32);
+            for (uint64_t k=0; k<8; k++)
+            {
+                bytes[8*(x+5*y) + k] = uint8_t(lane >> (8*k));
+            }
+        }
     }
+}
 
-    // Call Keccak-f
-    KeccakF(S);
-    S.copySoutToSinAndResetRefs();
-    
-    // Reset output
-    memset(output, 0, sizeof(output));
-
-    // Add the corresponding bits
-    for (uint64_t i=0; i<1600; i++)
+void bytes2state (const uint8_t (&bytes)[200], uint64_t (&st)[5][5][2])
+{
+    for (uint64_t y=0; y<5; y++)
     {
-        uint8_t bit = (S.gate[SinRef0 + i*9].pin[pin_a].bit & 1);
-        if (bit == 1) setStateBit(output, i, bit);
+        for (uint64_t x=0; x<5; x++)
+        {
+            uint64_t lane = 0;
+            for (uint64_t k=0; k<8; k++)
+            {
+                lane |= uint64_t(bytes[8*(x+5*y) + k]) << (8*k);
+            }
+            st[x][y][0] = lane & 0xFFFFFFFF;
+            st[x][y][1] = lane >> 32;
+        }
     }
 }
 
 void PaddingKKBitExecutor::execute (vector<PaddingKKBitExecutorInput> &input, PaddingKKBitCommitPols &pols, vector<Nine2OneExecutorInput> &required)
 {
-    uint64_t curInput = 0;
-    uint64_t p = 0;
-    //uint64_t v = 0;
-
     // Convert pols.sOutX to and array, for programming convenience
     CommitPol sOut[8] = { pols.sOut0, pols.sOut1, pols.sOut2, pols.sOut3, pols.sOut4, pols.sOut5, pols.sOut6, pols.sOut7 };
 
-    uint64_t curState[5][5][2];
-    bool bCurStateWritten = false;
+    // Evaluations used by every slot: 136 bytes of r (8 bits + 1 byte row each), 512 capacity bits, 256 output bits and 1 final row
+    const uint64_t slotEvaluations = 136*9 + 512 + 256 + 1;
 
+    // Compute the Keccak-f permutations of all slots, directly over the 64-bit lanes.
+    // This must be done sequentially, since a connected slot absorbs into the previous slot output,
+    // and it stores both the input (stateWithR) and the output (curState) of every slot in required
+    uint64_t requiredOffset = required.size();
+    required.resize(requiredOffset + nSlots);
+    vector<bool> connected(nSlots);
+    uint8_t state[200];
     for (uint64_t i=0; i<nSlots; i++)
     {
-        bool connected = true;
-
-        uint64_t stateWithR[5][5][2];
-        if ((curInput>=input.size()) || (input[curInput].connected == false))
+        connected[i] = (i<input.size()) && input[i].connected;
+        if (!connected[i])
         {
-            connected = false;
-            memset(stateWithR, 0, sizeof(stateWithR));
+            memset(state, 0, sizeof(state));
         }
-        else
+        if (i < input.size())
         {
-            // Copy: stateWithR = curState;
-            memcpy(&stateWithR, &curState, sizeof(stateWithR));
+            for (uint64_t j=0; j<136; j++)
+            {
+                state[j] ^= input[i].r[j];
+            }
         }
 
+        // Copy: required.st[0] = stateWithR
+        bytes2state(state, required[requiredOffset + i].st[0]);
+
+        KeccakF1600(state);
+
+        // Copy: required.st[1] = curState
+        bytes2state(state, required[requiredOffset + i].st[1]);
+    }
+
+    // Fill the polynomials of every slot; slots use disjoint evaluations, so they can be filled in parallel
+#pragma omp parallel for
+    for (uint64_t i=0; i<nSlots; i++)
+    {
+        uint64_t p = i*slotEvaluations;
+        uint64_t (&curState)[5][5][2] = required[requiredOffset + i].st[1];
+
+        // The output of the previous slot, if any
+        bool bPrevStateWritten = (i > 0);
+        uint64_t (&prevState)[5][5][2] = required[requiredOffset + (i > 0 ? i-1 : 0)].st[1];
+
         for (uint64_t j=0; j<136; j++)
         {
-            uint8_t byte = (curInput < input.size()) ? input[curInput].r[j] : 0;
+            uint8_t byte = (i < input.size()) ? input[i].r[j] : 0;
             pols.r8[p] = fr.zero();
             for (uint64_t k=0; k<8; k++)
             {
                 uint64_t bit = (byte >> k) & 1;
-                setStateBit(stateWithR, j*8+k, bit);
                 pols.rBit[p] = fr.fromU64(bit);
                 pols.r8[p+1] = fr.fromU64( fr.toU64(pols.r8[p]) | ((uint64_t(bit) << k)) );
-                if (bCurStateWritten) pols.sOutBit[p] = fr.fromU64( bitFromState(curState, j*8 + k) );
-                if (connected) pols.connected[p] = fr.one();
+                if (bPrevStateWritten) pols.sOutBit[p] = fr.fromU64( bitFromState(prevState, j*8 + k) );
+                if (connected[i]) pols.connected[p] = fr.one();
                 p++;
             }
 
-            if (connected) pols.connected[p] = fr.one();
+            if (connected[i]) pols.connected[p] = fr.one();
             p++;
         }
         
         for (uint64_t j=0; j<512; j++)
         {
-            if (bCurStateWritten) pols.sOutBit[p] = fr.fromU64( bitFromState(curState, 136*8 + j) );
-            if (connected) pols.connected[p] = fr.one();
+            if (bPrevStateWritten) pols.sOutBit[p] = fr.fromU64( bitFromState(prevState, 136*8 + j) );
+            if (connected[i]) pols.connected[p] = fr.one();
             p++;
         }
 
-        callKeccakF(stateWithR, curState);
-        bCurStateWritten = true;
-
-        Nine2OneExecutorInput nine2OneExecutorInput;
-        // Copy: nine2OneExecutorInput.st[0] = stateWithR
-        memcpy(&nine2OneExecutorInput.st[0], stateWithR, sizeof(nine2OneExecutorInput.st[0]));
-        // Copy: nine2OneExecutorInput.st[1] = curState
-        memcpy(&nine2OneExecutorInput.st[1], curState, sizeof(nine2OneExecutorInput.st[1]));
-
-        required.push_back(nine2OneExecutorInput);
-
         for (uint64_t j=0; j<256; j++)
         {
             pols.sOutBit[p] = fr.fromU64( bitFromState(curState, j) );
-            if (connected) pols.connected[p] = fr.one();
+            if (connected[i]) pols.connected[p] = fr.one();
 
             uint64_t bit = j%8;
             uint64_t byte = j/8;
@@ -135,10 +143,16 @@ void PaddingKKBitExecutor::execute (vector<PaddingKKBitExecutorInput> &input, Pa
             p += 1;
         }
 
-        if (connected) pols.connected[p] = fr.one();
+        if (connected[i]) pols.connected[p] = fr.one();
         p++;
+    }
 
-        curInput++;
+    // The output of the last slot
+    uint64_t curState[5][5][2];
+    memset(curState, 0, sizeof(curState));
+    if (nSlots > 0)
+    {
+        memcpy(curState, required[requiredOffset + nSlots - 1].st[1], sizeof(curState));
     }
 
     // Connect the last state with the first
@@ -13,6 +13,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
     uint64_t l=0; // rom line number, so current line is rom.line[l]
     uint64_t a=0; // action number, so current action is action[a]
     bool actionListEmpty = (action.size()==0); // becomes true when we run out of actions
+    uint64_t reusedHashes = 0; // number of hashes taken from the SMT results instead of calculated
 
     // Init the context if the list is not empty
     SmtActionContext ctx;
@@ -663,9 +664,27 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 req[j] = fea[j];
             }
 
-            // Call poseidon
+            // Call poseidon, unless the SMT already calculated this hash for the current action
             Goldilocks::Element feaHash[4];
-            poseidon.hash(feaHash, fea);
+            if (!actionListEmpty && getSmtHash(action[a], fea, feaHash))
+            {
+                // Verify a sample of the reused hashes
+                reusedHashes++;
+                if ( (config.storageHashCheckPeriod > 0) && ((reusedHashes % config.storageHashCheckPeriod) == 0) )
+                {
+                    Goldilocks::Element checkHash[4];
+                    poseidon.hash(checkHash, fea);
+                    if ( !fr.equal(checkHash[0], feaHash[0]) || !fr.equal(checkHash[1], feaHash[1]) || !fr.equal(checkHash[2], feaHash[2]) || !fr.equal(checkHash[3], feaHash[3]) )
+                    {
+                        cerr << "Error: StorageExecutor::execute() found SMT hash=" << fea2string(fr, feaHash) << " different from calculated hash=" << fea2string(fr, checkHash) << endl;
+                        exitProcess();
+                    }
+                }
+            }
+            else
+            {
+                poseidon.hash(feaHash, fea);
+            }
 
             // Get the calculated hash from the first 4 elements
             pols.free0[i] = feaHash[0];
@@ -1207,7 +1226,24 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
 #endif
     }
 
-    cout << "StorageExecutor successfully processed " << action.size() << " SMT actions" << endl;
+    cout << "StorageExecutor successfully processed " << action.size() << " SMT actions, reusing " << reusedHashes << " SMT hashes" << endl;
+}
+
+// Gets the hash of fea from the nodes saved by the SMT for this action, if present; only hashes that
+// the SMT calculated are recorded, never the ones of nodes read from the database, which are not trusted
+bool StorageExecutor::getSmtHash (const SmtAction &action, const Goldilocks::Element (&fea)[12], Goldilocks::Element (&hash)[4])
+{
+    if (!action.bIsSet) return false;
+    const vector< array<Goldilocks::Element, 16> > &hashes = action.setResult.hashes;
+    for (uint64_t i=0; i<hashes.size(); i++)
+    {
+        uint64_t j=0;
+        while ( (j<12) && fr.equal(hashes[i][j], fea[j]) ) j++;
+        if (j<12) continue;
+        for (uint64_t k=0; k<4; k++) hash[k] = hashes[i][12+k];
+        return true;
+    }
+    return false;
 }
 
 // To be used only for testing, since it allocates a lot of memory
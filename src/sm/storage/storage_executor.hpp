@@ -18,6 +18,8 @@ class StorageExecutor
     StorageRom rom;
     json pilJson;
 
+    bool getSmtHash (const SmtAction &action, const Goldilocks::Element (&fea)[12], Goldilocks::Element (&hash)[4]);
+
 public:
     StorageExecutor (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config) :
         fr(fr),
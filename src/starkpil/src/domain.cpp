@@ -0,0 +1,153 @@
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include "domain.hpp"
+#include "utils.hpp"
+
+#define DOMAIN_CACHE_MAGIC 0x4E49414D4F44584E // "NXDOMAIN"
+#define DOMAIN_CACHE_HEADER_SIZE 4 // magic, nBits, nBitsExt, reserved
+#define DOMAIN_CHUNK_SIZE (1 << 16)
+
+Goldilocks::Element domainPow (const Goldilocks::Element &base, uint64_t exponent)
+{
+    Goldilocks::Element result = Goldilocks::one();
+    Goldilocks::Element power = base;
+    while (exponent != 0)
+    {
+        if (exponent & 1) Goldilocks::mul(result, result, power);
+        Goldilocks::square(power, power);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+void domainPowers (Goldilocks::Element *pDst, uint64_t n, const Goldilocks::Element &first, const Goldilocks::Element &w)
+{
+    uint64_t nChunks = (n + DOMAIN_CHUNK_SIZE - 1) / DOMAIN_CHUNK_SIZE;
+#pragma omp parallel for
+    for (uint64_t c = 0; c < nChunks; c++)
+    {
+        uint64_t start = c * DOMAIN_CHUNK_SIZE;
+        uint64_t end = zkmin(start + DOMAIN_CHUNK_SIZE, n);
+        Goldilocks::Element xx;
+        Goldilocks::mul(xx, first, domainPow(w, start));
+        for (uint64_t i = start; i < end; i++)
+        {
+            pDst[i] = xx;
+            Goldilocks::mul(xx, xx, w);
+        }
+    }
+}
+
+string domainCacheFileName (const string &cachePath, uint64_t nBits, uint64_t nBitsExt)
+{
+    return cachePath + "/domain_" + to_string(nBits) + "_" + to_string(nBitsExt) + ".bin";
+}
+
+bool loadDomainCache (const string &fileName, uint64_t nBits, uint64_t nBitsExt, Goldilocks::Element *x_n, Goldilocks::Element *x_2ns)
+{
+    uint64_t N = 1ULL << nBits;
+    uint64_t NExtended = 1ULL << nBitsExt;
+    uint64_t size = (DOMAIN_CACHE_HEADER_SIZE + N + NExtended) * sizeof(uint64_t);
+
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat sb;
+    if ((fstat(fd, &sb) != 0) || ((uint64_t)sb.st_size != size))
+    {
+        cerr << "Error: loadDomainCache() found file " << fileName << " with an invalid size; ignoring it" << endl;
+        close(fd);
+        return false;
+    }
+
+    uint64_t * pAddress = (uint64_t *)mmap(NULL, size, PROT_READ, MAP_PRIVATE|MAP_POPULATE, fd, 0);
+    close(fd);
+    if (pAddress == MAP_FAILED)
+    {
+        cerr << "Error: loadDomainCache() failed calling mmap() of file: " << fileName << endl;
+        return false;
+    }
+
+    if ((pAddress[0] != DOMAIN_CACHE_MAGIC) || (pAddress[1] != nBits) || (pAddress[2] != nBitsExt))
+    {
+        cerr << "Error: loadDomainCache() found file " << fileName << " with an invalid header; ignoring it" << endl;
+        munmap(pAddress, size);
+        return false;
+    }
+
+    Goldilocks::Element * pData = (Goldilocks::Element *)(pAddress + DOMAIN_CACHE_HEADER_SIZE);
+#pragma omp parallel for
+    for (uint64_t i = 0; i < N; i++)
+    {
+        x_n[i] = pData[i];
+    }
+#pragma omp parallel for
+    for (uint64_t i = 0; i < NExtended; i++)
+    {
+        x_2ns[i] = pData[N + i];
+    }
+
+    munmap(pAddress, size);
+    return true;
+}
+
+// Writes the whole buffer, retrying partial writes; returns false on any error
+bool domainWriteAll (int fd, const void *pData, uint64_t size)
+{
+    const uint8_t *p = (const uint8_t *)pData;
+    while (size > 0)
+    {
+        ssize_t n = write(fd, p, size);
+        if (n < 0)
+        {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        p += n;
+        size -= n;
+    }
+    return true;
+}
+
+void saveDomainCache (const string &fileName, uint64_t nBits, uint64_t nBitsExt, Goldilocks::Element *x_n, Goldilocks::Element *x_2ns)
+{
+    uint64_t N = 1ULL << nBits;
+    uint64_t NExtended = 1ULL << nBitsExt;
+
+    // Write into a temporary file, flush it and rename it, so that readers never see a partial
+    // file; the cache is optional, so any failure is only reported and the prover goes on
+    string tmpFileName = fileName + "." + getUUID() + ".tmp";
+    int fd = open(tmpFileName.c_str(), O_CREAT|O_EXCL|O_WRONLY, 0644);
+    if (fd < 0)
+    {
+        cout << "saveDomainCache() failed creating " << tmpFileName << " errno=" << errno << "; domain cache not saved" << endl;
+        return;
+    }
+
+    uint64_t header[DOMAIN_CACHE_HEADER_SIZE] = { DOMAIN_CACHE_MAGIC, nBits, nBitsExt, 0 };
+    bool bOk = domainWriteAll(fd, header, sizeof(header)) &&
+               domainWriteAll(fd, x_n, N * sizeof(Goldilocks::Element)) &&
+               domainWriteAll(fd, x_2ns, NExtended * sizeof(Goldilocks::Element)) &&
+               (fsync(fd) == 0);
+    int writeErrno = errno;
+    if ((close(fd) != 0) && bOk)
+    {
+        bOk = false;
+        writeErrno = errno;
+    }
+    if (!bOk)
+    {
+        cout << "saveDomainCache() failed writing " << tmpFileName << " errno=" << writeErrno << "; domain cache not saved" << endl;
+        unlink(tmpFileName.c_str());
+        return;
+    }
+
+    if (rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+    {
+        cout << "saveDomainCache() failed renaming " << tmpFileName << " to " << fileName << " errno=" << errno << "; domain cache not saved" << endl;
+        unlink(tmpFileName.c_str());
+    }
+}
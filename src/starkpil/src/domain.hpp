@@ -0,0 +1,25 @@
+#ifndef DOMAIN_HPP
+#define DOMAIN_HPP
+
+#include <string>
+#include "goldilocks_base_field.hpp"
+
+using namespace std;
+
+// Returns base^exponent
+Goldilocks::Element domainPow (const Goldilocks::Element &base, uint64_t exponent);
+
+// Fills pDst[i] = first * w^i for i in [0, n), splitting the range in chunks that start their own power ladder
+void domainPowers (Goldilocks::Element *pDst, uint64_t n, const Goldilocks::Element &first, const Goldilocks::Element &w);
+
+// Returns the cache file name of the x_n and x_2ns tables of the given domain, inside cachePath
+string domainCacheFileName (const string &cachePath, uint64_t nBits, uint64_t nBitsExt);
+
+// Loads the x_n (2^nBits elements) and x_2ns (2^nBitsExt elements) tables from a cache file;
+// returns false if the file does not exist or does not belong to this domain
+bool loadDomainCache (const string &fileName, uint64_t nBits, uint64_t nBitsExt, Goldilocks::Element *x_n, Goldilocks::Element *x_2ns);
+
+// Saves the x_n and x_2ns tables into a cache file, atomically replacing any previous one
+void saveDomainCache (const string &fileName, uint64_t nBits, uint64_t nBitsExt, Goldilocks::Element *x_n, Goldilocks::Element *x_2ns);
+
+#endif
@@ -0,0 +1,134 @@
+#include <atomic>
+#include <vector>
+#include "plookup.hpp"
+#include "goldilocks_cubic_extension.hpp"
+
+using namespace std;
+
+#define H1H2_EMPTY_SLOT 0xFFFFFFFFFFFFFFFF
+
+// Flat open-addressing table mapping the second component of a tPol entry to its first index
+class H1H2Table
+{
+    vector<uint64_t> keys;
+    vector<uint64_t> indexes;
+    uint64_t mask;
+    uint64_t shift;
+
+    inline uint64_t slot (uint64_t key) const { return (key * 0x9E3779B97F4A7C15ULL) >> shift; }
+
+public:
+    H1H2Table (uint64_t nEntries)
+    {
+        uint64_t nBits = 1;
+        while ((1ULL << nBits) < 2 * nEntries) nBits++;
+        keys.resize(1ULL << nBits);
+        indexes.resize(1ULL << nBits, H1H2_EMPTY_SLOT);
+        mask = (1ULL << nBits) - 1;
+        shift = 64 - nBits;
+    }
+
+    // Keeps the first index inserted for every key
+    void insert (uint64_t key, uint64_t index)
+    {
+        for (uint64_t s = slot(key); ; s = (s + 1) & mask)
+        {
+            if (indexes[s] == H1H2_EMPTY_SLOT)
+            {
+                keys[s] = key;
+                indexes[s] = index;
+                return;
+            }
+            if (keys[s] == key) return;
+        }
+    }
+
+    uint64_t find (uint64_t key) const
+    {
+        for (uint64_t s = slot(key); ; s = (s + 1) & mask)
+        {
+            if (indexes[s] == H1H2_EMPTY_SLOT) return H1H2_EMPTY_SLOT;
+            if (keys[s] == key) return indexes[s];
+        }
+    }
+};
+
+void calculateH1H2(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol)
+{
+    uint64_t nt = tPol.degree();
+    uint64_t nf = fPol.degree();
+
+    H1H2Table idx_t(nt);
+    for (uint64_t i = 0; i < nt; i++)
+    {
+        idx_t.insert(Goldilocks::toU64(tPol[i][1]), i);
+    }
+
+    // Find the tPol entry of every fPol entry and count how many land on each tPol entry
+    vector<uint64_t> idx_f(nf);
+    vector<atomic<uint64_t>> counters(nt + 1);
+    bool bMissing = false;
+#pragma omp parallel for
+    for (uint64_t i = 0; i < nt + 1; i++)
+    {
+        counters[i].store(i < nt ? 1 : 0, memory_order_relaxed);
+    }
+#pragma omp parallel for reduction(||:bMissing)
+    for (uint64_t i = 0; i < nf; i++)
+    {
+        idx_f[i] = idx_t.find(Goldilocks::toU64(fPol[i][1]));
+        if (idx_f[i] == H1H2_EMPTY_SLOT)
+        {
+            bMissing = true;
+            continue;
+        }
+        counters[idx_f[i]].fetch_add(1, memory_order_relaxed);
+    }
+    if (bMissing)
+    {
+        for (uint64_t i = 0; i < nf; i++)
+        {
+            if (idx_f[i] == H1H2_EMPTY_SLOT)
+            {
+                cerr << "Error: calculateH1H2() Number not included: " << Goldilocks::toString(fPol[i], 16) << endl;
+                exit(-1);
+            }
+        }
+    }
+
+    // Exclusive prefix sum: position of every tPol entry in the sorted list
+    vector<uint64_t> position(nt);
+    uint64_t acc = 0;
+    for (uint64_t i = 0; i < nt; i++)
+    {
+        position[i] = acc;
+        acc += counters[i].load(memory_order_relaxed);
+    }
+
+    // Source of every position in the sorted list: i < nt for tPol[i], nt + i for fPol[i]
+    vector<uint64_t> source(nt + nf);
+#pragma omp parallel for
+    for (uint64_t i = 0; i < nt; i++)
+    {
+        source[position[i]] = i;
+        position[i]++;
+    }
+    for (uint64_t i = 0; i < nf; i++)
+    {
+        source[position[idx_f[i]]++] = nt + i;
+    }
+
+#pragma omp parallel for
+    for (uint64_t i = 0; i < nt + nf; i++)
+    {
+        Goldilocks::Element *h = (source[i] < nt) ? tPol[source[i]] : fPol[source[i] - nt];
+        if ((i & 1) == 0)
+        {
+            Goldilocks3::copy((Goldilocks3::Element *)h1[i / 2], (Goldilocks3::Element *)h);
+        }
+        else
+        {
+            Goldilocks3::copy((Goldilocks3::Element *)h2[i / 2], (Goldilocks3::Element *)h);
+        }
+    }
+}
@@ -0,0 +1,15 @@
+#ifndef PLOOKUP_HPP
+#define PLOOKUP_HPP
+
+#include "goldilocks_base_field.hpp"
+#include "polinomial.hpp"
+
+/*
+    Computes the plookup h1 and h2 polynomials of fPol over the table tPol, both of dimension 3.
+    Every element is identified by its second component; the sorted list contains every tPol entry
+    followed by the fPol entries that match it (first tPol entry with the same value), in order,
+    and is split alternately between h1 and h2.
+*/
+void calculateH1H2(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol);
+
+#endif
@@ -1,6 +1,8 @@
 #include "stark.hpp"
 #include "timer.hpp"
 #include "utils.hpp"
+#include "domain.hpp"
+#include "plookup.hpp"
 
 //#include "starkPols.hpp"
 //#include "starkPols2ns.hpp"
@@ -34,7 +36,12 @@ Stark::Stark(const Config &config) : config(config),
         cerr << "Error: Stark::Stark() received an empty config.constPolsFile" << endl;
         exit(-1);
     }
-    if (config.mapConstPolsFile)
+    if (config.constPolsSharedMemory.size() > 0)
+    {
+        pConstPolsAddress = mapSharedFile(config.constPolsFile, ConstantPols::pilSize(), config.constPolsSharedMemory, config.hugePagesPath);
+        cout << "Stark::Stark() successfully mapped " << ConstantPols::pilSize() << " bytes from constant file " << config.constPolsFile << " into shared memory " << config.constPolsSharedMemory << endl;
+    }
+    else if (config.mapConstPolsFile)
     {
         pConstPolsAddress = mapFile(config.constPolsFile, ConstantPols::pilSize(), false);
         cout << "Stark::Stark() successfully mapped " << ConstantPols::pilSize() << " bytes from constant file " << config.constPolsFile << endl;
@@ -82,19 +89,27 @@ Stark::Stark(const Config &config) : config(config),
         }
     }*/
 
-    // TODO x_n and x_2ns could be precomputed
-    Goldilocks::Element xx = Goldilocks::one();
-    for (uint i = 0; i < N; i++)
+    // Compute x_n and x_2ns, or load them from the domain cache, if configured
+    TimerStart(COMPUTE_X_N_AND_X_2_NS);
+    string domainCacheFile;
+    if (config.domainCachePath.size() > 0)
     {
-        *x_n[i] = xx;
-        Goldilocks::mul(xx, xx, Goldilocks::w(starkInfo.starkStruct.nBits));
+        domainCacheFile = domainCacheFileName(config.domainCachePath, starkInfo.starkStruct.nBits, starkInfo.starkStruct.nBitsExt);
     }
-    xx = Goldilocks::shift();
-    for (uint i = 0; i < NExtended; i++)
+    if ((domainCacheFile.size() > 0) && loadDomainCache(domainCacheFile, starkInfo.starkStruct.nBits, starkInfo.starkStruct.nBitsExt, x_n.address(), x_2ns.address()))
     {
-        *x_2ns[i] = xx;
-        Goldilocks::mul(xx, xx, Goldilocks::w(starkInfo.starkStruct.nBitsExt));
+        cout << "Stark::Stark() successfully loaded x_n and x_2ns from domain cache file " << domainCacheFile << endl;
     }
+    else
+    {
+        domainPowers(x_n.address(), N, Goldilocks::one(), Goldilocks::w(starkInfo.starkStruct.nBits));
+        domainPowers(x_2ns.address(), NExtended, Goldilocks::shift(), Goldilocks::w(starkInfo.starkStruct.nBitsExt));
+        if (domainCacheFile.size() > 0)
+        {
+            saveDomainCache(domainCacheFile, starkInfo.starkStruct.nBits, starkInfo.starkStruct.nBitsExt, x_n.address(), x_2ns.address());
+        }
+    }
+    TimerStopAndLog(COMPUTE_X_N_AND_X_2_NS);
 }
 
 Stark::~Stark()
@@ -102,7 +117,11 @@ Stark::~Stark()
     if (!config.generateProof()) return;
     
     delete pConstPols;
-    if (config.mapConstPolsFile)
+    if (config.constPolsSharedMemory.size() > 0)
+    {
+        unmapSharedFile(pConstPolsAddress, ConstantPols::pilSize(), config.hugePagesPath);
+    }
+    else if (config.mapConstPolsFile)
     {
         unmapFile(pConstPolsAddress, ConstantPols::pilSize());
     }
@@ -225,61 +244,7 @@ void Stark::genProof(void *pAddress, CommitPols &cmPols, const PublicInputs &pub
     proof.publicInputsExtended.publicInputs.batchNum = 1;
 }
 
-class CompareGL3
-{
-public:
-    bool operator()(const vector<Goldilocks::Element> &a, const vector<Goldilocks::Element> &b) const
-    {
-        return Goldilocks::toU64(a[1]) < Goldilocks::toU64(b[1]);
-    }
-};
-
 void Stark::calculateH1H2(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol)
 {
-    map<std::vector<Goldilocks::Element>, uint64_t, CompareGL3> idx_t;
-    multimap<std::vector<Goldilocks::Element>, uint64_t, CompareGL3> s;
-    multimap<std::vector<Goldilocks::Element>, uint64_t>::iterator it;
-    uint64_t i = 0;
-
-    for (uint64_t i = 0; i < tPol.degree(); i++)
-    {
-        vector<Goldilocks::Element> key = Goldilocks3::toVector((Goldilocks3::Element *)tPol[i]);
-        std::pair<vector<Goldilocks::Element>, uint64_t> pr(key, i);
-        idx_t.insert(pr);
-        s.insert(pr);
-    }
-
-    for (uint64_t i = 0; i < fPol.degree(); i++)
-    {
-        vector<Goldilocks::Element> key = Goldilocks3::toVector((Goldilocks3::Element *)fPol[i]);
-
-        if (idx_t.find(key) == idx_t.end())
-        {
-            cerr << "Error: calculateH1H2() Number not included: " << Goldilocks::toString(fPol[i], 16) << endl;
-            exit(-1);
-        }
-        uint64_t idx = idx_t[key];
-        s.insert(pair<vector<Goldilocks::Element>, uint64_t>(key, idx));
-    }
-
-    multimap<uint64_t, vector<Goldilocks::Element>> s_sorted;
-    multimap<uint64_t, vector<Goldilocks::Element>>::iterator it_sorted;
-
-    for (it = s.begin(); it != s.end(); it++)
-    {
-        s_sorted.insert(make_pair(it->second, it->first));
-    }
-    for (it_sorted = s_sorted.begin(); it_sorted != s_sorted.end(); it_sorted++, i++)
-    {
-        Goldilocks::Element *h = it_sorted->second.data();
-
-        if ((i & 1) == 0)
-        {
-            Goldilocks3::copy((Goldilocks3::Element *)h1[i / 2], (Goldilocks3::Element *)h);
-        }
-        else
-        {
-            Goldilocks3::copy((Goldilocks3::Element *)h2[i / 2], (Goldilocks3::Element *)h);
-        }
-    }
-};
\ No newline at end of file
+    ::calculateH1H2(h1, h2, fPol, tPol);
+}
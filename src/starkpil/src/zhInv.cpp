@@ -1,4 +1,5 @@
 #include "zhInv.hpp"
+#include "domain.hpp"
 
 
 // TODO: Pending to review and re-factor
@@ -12,7 +13,6 @@ ZhInv::ZhInv(uint64_t nBits, uint64_t nBitsExt)
 
     zkassert(nBits < nBitsExt);
 
-    Goldilocks::Element w = Goldilocks::one();
     Goldilocks::Element sn = Goldilocks::shift();
     uint64_t extendBits = nBitsExt - nBits;
     uint64_t zhinvSize = (1 << extendBits);
@@ -21,12 +21,15 @@ ZhInv::ZhInv(uint64_t nBits, uint64_t nBitsExt)
     {
         Goldilocks::square(sn, sn);
     }
+
+    // ZHInv[i] = 1/(sn*w^i - 1)
+    ZHInv.resize(zhinvSize);
+    domainPowers(ZHInv.data(), zhinvSize, sn, Goldilocks::w(extendBits));
+#pragma omp parallel for
     for (uint64_t i = 0; i < zhinvSize; i++)
     {
-        Goldilocks::Element inv;
-        Goldilocks::inv(inv, (sn * w) - Goldilocks::one());
-        ZHInv.push_back(inv);
-        Goldilocks::mul(w, w, Goldilocks::w(extendBits));
+        Goldilocks::Element zh = ZHInv[i] - Goldilocks::one();
+        Goldilocks::inv(ZHInv[i], zh);
     }
 };
 
@@ -1,6 +1,7 @@
 #include "stark_test.hpp"
 #include "timer.hpp"
 #include "utils.hpp"
+#include "plookup.hpp"
 
 #include "ntt_goldilocks.hpp"
 
@@ -45,6 +46,32 @@ void StarkTest(void)
 }
 
 void StarkTestMock::calculateH1H2(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol)
+{
+    TimerStart(STARK_TEST_CALCULATE_H1H2);
+    ::calculateH1H2(h1, h2, fPol, tPol);
+    TimerStopAndLog(STARK_TEST_CALCULATE_H1H2);
+
+    // Check the result against the reference implementation
+    TimerStart(STARK_TEST_CALCULATE_H1H2_REFERENCE);
+    Polinomial h1Ref(h1.degree(), FIELD_EXTENSION);
+    Polinomial h2Ref(h2.degree(), FIELD_EXTENSION);
+    calculateH1H2Reference(h1Ref, h2Ref, fPol, tPol);
+    TimerStopAndLog(STARK_TEST_CALCULATE_H1H2_REFERENCE);
+    for (uint64_t i = 0; i < h1.degree(); i++)
+    {
+        for (uint64_t j = 0; j < FIELD_EXTENSION; j++)
+        {
+            if ((Goldilocks::toU64(h1[i][j]) != Goldilocks::toU64(h1Ref[i][j])) || (Goldilocks::toU64(h2[i][j]) != Goldilocks::toU64(h2Ref[i][j])))
+            {
+                cerr << "Error: StarkTestMock::calculateH1H2() found a mismatch with the reference implementation at i=" << i << endl;
+                exit(-1);
+            }
+        }
+    }
+    cout << "StarkTestMock::calculateH1H2() matches the reference implementation" << endl;
+}
+
+void StarkTestMock::calculateH1H2Reference(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol)
 {
     map<std::vector<Goldilocks::Element>, uint64_t, CompareGL3> idx_t;
     multimap<std::vector<Goldilocks::Element>, uint64_t, CompareGL3> s;
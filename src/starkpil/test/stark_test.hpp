@@ -65,6 +65,7 @@ class StarkTestMock
 
 private:
     void calculateH1H2(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol);
+    void calculateH1H2Reference(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol);
 
 public:
     Polinomial x_n;
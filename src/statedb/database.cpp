@@ -1,4 +1,12 @@
 #include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
 #include "config.hpp"
 #include "database.hpp"
 #include "scalar.hpp"
@@ -6,6 +14,7 @@
 #include "definitions.hpp"
 #include "zkresult.hpp"
 #include "utils.hpp"
+#include "timer.hpp"
 
 void Database::init(const Config &_config)
 {
@@ -17,12 +26,38 @@ void Database::init(const Config &_config)
     }
 
     config = _config;
+    pthread_mutex_init(&cacheMutex, NULL);
 
     // Configure the server, if configuration is provided
-    if (config.databaseURL!="local")
+    if (config.databaseURL.substr(0, 7) == "file://")
+    {
+        pNodeStore = NodeStore::getInstance(fr, config.databaseURL.substr(7), config.dbNodeStoreCommitPeriod);
+        useNodeStore = true;
+        useRemoteDB = false;
+    }
+    else if (config.databaseURL.substr(0, 10) == "statedb://")
+    {
+        nodeClient.open(config.databaseURL.substr(10), config.dbNodeClientBatchSize);
+        useNodeClient = true;
+        useRemoteDB = false;
+    }
+    else if (config.databaseURL!="local")
     {
         initRemote();
         useRemoteDB = true;
+
+        // Warm up the cache with the last snapshot, and start the thread that periodically saves it
+        if (config.dbCacheSnapshotFile != "")
+        {
+            useCacheSnapshot = true;
+            loadCacheSnapshot();
+            if (config.dbCacheSnapshotPeriod > 0)
+            {
+                pthread_mutex_init(&snapshotMutex, NULL);
+                pthread_cond_init(&snapshotStopCond, NULL);
+                pthread_create(&snapshotThread, NULL, databaseSnapshotThread, this);
+            }
+        }
     } else useRemoteDB = false;
 
     // Mark the database as initialized
@@ -45,9 +80,14 @@ zkresult Database::read (const string &_key, vector<Goldilocks::Element> &value)
     key = stringToLower(key);
 
     // If the value is found in local database (cached) simply return it
-    if (db.find(key) != db.end())
+    pthread_mutex_lock(&cacheMutex);
+    map<string, vector<Goldilocks::Element>>::iterator it = db.find(key);
+    bool bCached = (it != db.end());
+    if (bCached) value = it->second;
+    pthread_mutex_unlock(&cacheMutex);
+
+    if (bCached)
     {
-        value = db[key];
         r = ZKR_SUCCESS;
     } 
     else if (useRemoteDB)
@@ -56,7 +96,24 @@ zkresult Database::read (const string &_key, vector<Goldilocks::Element> &value)
         r = readRemote(key, value);
         if (r == ZKR_SUCCESS) {
             // Store it locally to avoid any future remote access for this key
+            pthread_mutex_lock(&cacheMutex);
+            db[key] = value;
+            pthread_mutex_unlock(&cacheMutex);
+        }
+    }
+    else if (useNodeStore)
+    {
+        // Read it from the memory-mapped store, which acts as its own cache
+        r = pNodeStore->read(key, value);
+    }
+    else if (useNodeClient)
+    {
+        // Fetch it from the StateDB server, and cache it; nodes never change, so it stays valid
+        r = nodeClient.read(key, value);
+        if (r == ZKR_SUCCESS) {
+            pthread_mutex_lock(&cacheMutex);
             db[key] = value;
+            pthread_mutex_unlock(&cacheMutex);
         }
     }
     else
@@ -96,11 +153,29 @@ zkresult Database::write (const string &_key, const vector<Goldilocks::Element>
     if (useRemoteDB && persistent)
     {
         r = writeRemote(key, value);
+    }
+    else if (useNodeStore && persistent)
+    {
+        r = pNodeStore->write(key, value);
+    }
+    else if (useNodeClient && persistent)
+    {
+        // If sending the batch failed, the node is still in it, to be sent again by the next write or
+        // flush, so it is cached anyway, but the error is returned
+        r = nodeClient.write(key, value);
     } else r = ZKR_SUCCESS;
 
-    if (r == ZKR_SUCCESS) {
+    if (((r == ZKR_SUCCESS) || (useNodeClient && persistent)) && !(useNodeStore && persistent)) {
         // Create in memory cache
+        pthread_mutex_lock(&cacheMutex);
+        if (useCacheSnapshot)
+        {
+            // A node already in the cache was either stored or read from the remote database
+            if (persistent) dbNotPersisted.erase(key);
+            else if (db.find(key) == db.end()) dbNotPersisted.insert(key);
+        }
         db[key] = value;
+        pthread_mutex_unlock(&cacheMutex);
     }
 
 #ifdef LOG_DB_WRITE
@@ -113,7 +188,7 @@ zkresult Database::write (const string &_key, const vector<Goldilocks::Element>
     cout << " persistent=" << persistent << endl;    
 #endif      
 
-    return ZKR_SUCCESS;
+    return r;
 }
 
 void Database::initRemote (void)
@@ -128,6 +203,14 @@ void Database::initRemote (void)
         pConnectionWrite = new pqxx::connection{uri};
         pConnectionRead = new pqxx::connection{uri};
 
+        // Create the program table if the database predates it; tools/statedb/create_db.sh
+        // creates it, together with the merkletree table, in new databases
+        {
+            pqxx::work w(*pConnectionWrite);
+            w.exec("CREATE TABLE IF NOT EXISTS " + config.dbProgramTableName + " ( hash BYTEA PRIMARY KEY, data BYTEA NOT NULL );");
+            w.commit();
+        }
+
         //Create the thread to process asynchronous writes to de DB
         if (config.dbAsyncWrite)
         {
@@ -243,6 +326,7 @@ zkresult Database::writeRemote (const string &key, const vector<Goldilocks::Elem
 
 void Database::print(void)
 {
+    pthread_mutex_lock(&cacheMutex);
     cout << "Database of " << db.size() << " elements:" << endl;
     for (map<string, vector<Goldilocks::Element>>::iterator it = db.begin(); it != db.end(); it++)
     {
@@ -252,6 +336,7 @@ void Database::print(void)
             cout << fr.toString(vect[i], 16) << ":";
         cout << endl;
     }
+    pthread_mutex_unlock(&cacheMutex);
 }
 void Database::printTree (const string &root, string prefix)
 {
@@ -340,7 +425,7 @@ void Database::printTree (const string &root, string prefix)
     if (prefix=="") cout << endl;
 }
 
-zkresult Database::setProgram (const string &key, const vector<uint8_t> &data, const bool persistent)
+zkresult Database::setProgram (const string &_key, const vector<uint8_t> &data, const bool persistent)
 {
     // Check that it has been initialized before
     if (!bInitialized)
@@ -353,18 +438,34 @@ zkresult Database::setProgram (const string &key, const vector<uint8_t> &data, c
     cout << "Database::setProgram()" << endl;
 #endif  
 
-    vector<Goldilocks::Element> feValue;
-    Goldilocks::Element fe;
-    for (uint64_t i=0; i<data.size(); i++)
+    zkresult r;
+
+    // Normalize key format
+    string key = NormalizeToNFormat(_key, 64);
+    key = stringToLower(key);
+
+    if (useRemoteDB && persistent)
     {
-        fe = fr.fromU64(data[i]);
-        feValue.push_back(fe);
+        r = writeProgramRemote(key, data);
+    }
+    else if (useNodeStore && persistent)
+    {
+        r = pNodeStore->writeProgram(key, data);
+    }
+    else if (useNodeClient && persistent)
+    {
+        r = nodeClient.writeProgram(key, data);
+    } else r = ZKR_SUCCESS;
+
+    if ((r == ZKR_SUCCESS) && !(useNodeStore && persistent)) {
+        // Create in memory cache
+        dbProgram[key] = data;
     }
 
-    return write(key, feValue, persistent);
+    return r;
 }
 
-zkresult Database::getProgram (const string &key, vector<uint8_t> &data)
+zkresult Database::getProgram (const string &_key, vector<uint8_t> &data)
 {
     // Check that it has been initialized before
     if (!bInitialized)
@@ -379,24 +480,163 @@ zkresult Database::getProgram (const string &key, vector<uint8_t> &data)
 
     zkresult r;
 
-    vector<Goldilocks::Element> feValue;
+    // Normalize key format
+    string key = NormalizeToNFormat(_key, 64);
+    key = stringToLower(key);
+
+    // If the program is found in local database (cached) simply return it
+    map<string, vector<uint8_t>>::iterator it = dbProgram.find(key);
+    if (it != dbProgram.end())
+    {
+        data = it->second;
+        return ZKR_SUCCESS;
+    }
+
+    if (useNodeStore)
+    {
+        return pNodeStore->readProgram(key, data);
+    }
+
+    if (useNodeClient)
+    {
+        r = nodeClient.readProgram(key, data);
+        if (r == ZKR_SUCCESS) dbProgram[key] = data;
+        return r;
+    }
 
-    r = read(key, feValue);
+    if (!useRemoteDB)
+    {
+        cerr << "Error: Database::getProgram() requested a key that does not exist: " << key << endl;
+        return ZKR_DB_KEY_NOT_FOUND;
+    }
 
-    if (r == ZKR_SUCCESS) 
+    r = readProgramRemote(key, data);
+    if (r == ZKR_DB_KEY_NOT_FOUND)
     {
-        for (uint64_t i=0; i<feValue.size(); i++)
+        // Compatibility with programs stored by previous versions in the nodes table, one field element
+        // per byte; migrate them to the programs table so that the next read finds them there
+        vector<Goldilocks::Element> feValue;
+        r = readRemote(key, feValue);
+        if (r == ZKR_SUCCESS)
         {
-            uint64_t uValue;
-            uValue = fr.toU64(feValue[i]);
-            zkassert(uValue < (1<<8));
-            data.push_back((uint8_t)uValue);
+            data.clear();
+            data.reserve(feValue.size());
+            for (uint64_t i=0; i<feValue.size(); i++)
+            {
+                uint64_t uValue;
+                uValue = fr.toU64(feValue[i]);
+                zkassert(uValue < (1<<8));
+                data.push_back((uint8_t)uValue);
+            }
+            writeProgramRemote(key, data);
         }
     }
 
+    if (r == ZKR_SUCCESS)
+    {
+        // Store it locally to avoid any future remote access for this key
+        dbProgram[key] = data;
+    }
+
     return r;
 }
 
+zkresult Database::readProgramRemote (const string &key, vector<uint8_t> &data)
+{
+    data.clear();
+    try
+    {
+        // Start a transaction.
+        pqxx::nontransaction n(*pConnectionRead);
+
+        // Prepare the query
+        string query = "SELECT * FROM " + config.dbProgramTableName + " WHERE hash = E\'\\\\x" + key + "\';";
+
+        // Execute the query
+        pqxx::result rows = n.exec(query);
+
+        // Process the result
+        if (rows.size() == 0)
+        {
+            return ZKR_DB_KEY_NOT_FOUND;
+        } 
+        else if (rows.size() > 1)
+        {
+            cerr << "Error: Database::readProgramRemote() got more than one row for the same key: " << rows.size() << endl;
+            exitProcess();
+        }
+        
+        pqxx::row const row = rows[0];
+        if (row.size() != 2)
+        {
+            cerr << "Error: Database::readProgramRemote() got an invalid number of colums for the row: " << row.size() << endl;
+            exitProcess();
+        }
+        pqxx::field const fieldData = row[1];
+        string sData = fieldData.c_str();
+        if ((sData.size() < 2) || (sData.size() % 2 != 0))
+        {
+            cerr << "Error: Database::readProgramRemote() found incorrect DATA column size: " << sData.size() << endl;
+            exitProcess();
+        }
+
+        // Skip the "\\x" prefix of the bytea hex output
+        data.reserve((sData.size() - 2) / 2);
+        for (uint64_t i=2; i<sData.size(); i+=2)
+        {
+            data.push_back((char2byte(sData[i]) << 4) | char2byte(sData[i+1]));
+        }
+
+        // Commit your transaction
+        n.commit();
+    }
+    catch (const std::exception &e)
+    {
+        cerr << "Error: Database::readProgramRemote() exception: " << e.what() << endl;
+        exitProcess();
+    }
+
+    return ZKR_SUCCESS;
+}
+
+zkresult Database::writeProgramRemote (const string &key, const vector<uint8_t> &data)
+{
+    try
+    {
+        // Prepare the query, encoding the program as a 2-characters-per-byte bytea literal
+        static const char hexDigits[] = "0123456789abcdef";
+        string dataString;
+        dataString.reserve(data.size()*2);
+        for (uint64_t i = 0; i < data.size(); i++)
+        {
+            dataString.push_back(hexDigits[data[i] >> 4]);
+            dataString.push_back(hexDigits[data[i] & 0x0F]);
+        }
+        string query = "INSERT INTO " + config.dbProgramTableName + " ( hash, data ) VALUES ( E\'\\\\x" + key + "\', E\'\\\\x" + dataString + "\' ) "+
+                       "ON CONFLICT (hash) DO NOTHING;";
+
+        if (config.dbAsyncWrite) {
+            addWriteQueue(query);
+        } else {
+            if (autoCommit) {
+                pqxx::work w(*pConnectionWrite);
+                pqxx::result res = w.exec(query);
+                w.commit();
+            } else {
+                if (transaction==NULL) transaction = new pqxx::work{*pConnectionWrite};
+                pqxx::result res = transaction->exec(query);
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        cerr << "Error: Database::writeProgramRemote() exception: " << e.what() << endl;
+        exitProcess();
+    }
+
+    return ZKR_SUCCESS;
+}
+
 void Database::addWriteQueue (const string sqlWrite)
 {
     pthread_mutex_lock(&writeQueueMutex);
@@ -405,13 +645,21 @@ void Database::addWriteQueue (const string sqlWrite)
     pthread_mutex_unlock(&writeQueueMutex);
 }
 
-void Database::flush ()
+zkresult Database::flush ()
 {
+    zkresult r = ZKR_SUCCESS;
+    if (useNodeStore) {
+        pNodeStore->commit();
+    }
+    if (useNodeClient) {
+        r = nodeClient.flush();
+    }
     if (config.dbAsyncWrite) {
         pthread_mutex_lock(&writeQueueMutex);
         while (writeQueue.size()>0) pthread_cond_wait(&emptyWriteQueueCond, &writeQueueMutex);
         pthread_mutex_unlock(&writeQueueMutex);
     }
+    return r;
 }
 
 void Database::setAutoCommit (const bool ac)
@@ -422,6 +670,9 @@ void Database::setAutoCommit (const bool ac)
 
 void Database::commit ()
 {
+    if (useNodeStore) {
+        pNodeStore->commit();
+    }
     if ((!autoCommit)&&(transaction!=NULL)) {      
         transaction->commit();
         delete transaction;
@@ -496,6 +747,25 @@ void Database::processWriteQueue ()
 
 Database::~Database()
 {
+    // Stop the snapshot thread, and save a last snapshot
+    if (useCacheSnapshot)
+    {
+        if (config.dbCacheSnapshotPeriod > 0)
+        {
+            pthread_mutex_lock(&snapshotMutex);
+            bSnapshotStop = true;
+            pthread_cond_signal(&snapshotStopCond);
+            pthread_mutex_unlock(&snapshotMutex);
+            pthread_join(snapshotThread, NULL);
+            pthread_cond_destroy(&snapshotStopCond);
+            pthread_mutex_destroy(&snapshotMutex);
+        }
+        saveCacheSnapshot();
+    }
+    if (bInitialized) pthread_mutex_destroy(&cacheMutex);
+
+    if (pNodeStore != NULL) NodeStore::releaseInstance(pNodeStore);
+
     if (pConnectionWrite != NULL) delete pConnectionWrite;
     if (pConnectionRead != NULL) delete pConnectionRead;
     
@@ -511,4 +781,221 @@ void* asyncDatabaseWriteThread (void* arg) {
     Database* db = (Database*)arg;   
     db->processWriteQueue();
     return NULL;
-}
\ No newline at end of file
+}
+
+// FNV-1a 64 bits of a snapshot record; records are hashed independently so that they can be checked in parallel
+static inline uint64_t snapshotRecordChecksum (const DatabaseSnapshotRecord &record)
+{
+    const uint8_t * pData = (const uint8_t *)&record;
+    uint64_t checksum = 0xcbf29ce484222325ULL;
+    for (uint64_t i=0; i<sizeof(DatabaseSnapshotRecord); i++)
+    {
+        checksum ^= pData[i];
+        checksum *= 0x100000001b3ULL;
+    }
+    return checksum;
+}
+
+void Database::saveCacheSnapshot (void)
+{
+    TimerStart(DATABASE_SAVE_CACHE_SNAPSHOT);
+
+    // Copy the cache into records, in key order; keys are normalized to 64 hexa characters
+    // The cache is copied in chunks, releasing the lock between them, so that reads and writes are
+    // not stalled by the copy of a big cache; cached nodes never change, and the nodes added behind
+    // the copy position will be saved in the next snapshot
+    vector<DatabaseSnapshotRecord> records;
+    string lastKey;
+    bool bDone = false;
+    while (!bDone)
+    {
+        pthread_mutex_lock(&cacheMutex);
+        if (records.size() == 0) records.reserve(db.size());
+        map<string, vector<Goldilocks::Element>>::const_iterator it = (lastKey == "") ? db.begin() : db.upper_bound(lastKey);
+        for (uint64_t copied=0; (it != db.end()) && (copied < DATABASE_SNAPSHOT_CHUNK_SIZE); it++, copied++)
+        {
+            lastKey = it->first;
+            if ((it->first.size() != 64) || (it->second.size() > 12)) continue;
+            if (dbNotPersisted.find(it->first) != dbNotPersisted.end()) continue;
+            DatabaseSnapshotRecord record;
+            memset(&record, 0, sizeof(record));
+            for (uint64_t i=0; i<32; i++) record.key[i] = (char2byte(it->first[2*i]) << 4) | char2byte(it->first[2*i + 1]);
+            record.size = it->second.size();
+            for (uint64_t i=0; i<record.size; i++) record.value[i] = fr.toU64(it->second[i]);
+            records.push_back(record);
+        }
+        bDone = (it == db.end());
+        pthread_mutex_unlock(&cacheMutex);
+    }
+
+    // Do not replace the last snapshot with an empty one, e.g. if the process stops just after starting
+    if (records.size() == 0)
+    {
+        TimerStopAndLog(DATABASE_SAVE_CACHE_SNAPSHOT);
+        return;
+    }
+
+    DatabaseSnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, DATABASE_SNAPSHOT_MAGIC, 8);
+    header.count = records.size();
+    uint64_t checksum = 0;
+#pragma omp parallel for reduction(+:checksum)
+    for (uint64_t i=0; i<records.size(); i++)
+    {
+        checksum += snapshotRecordChecksum(records[i]);
+    }
+    header.checksum = checksum;
+
+    // Write it to a temporary file and rename it, so that a crash never leaves a partial snapshot; the
+    // temporary file name is unique, since several databases of this or other processes can share the
+    // snapshot file, and every one of them replaces it with a complete snapshot of its own
+    string tmpFileName = config.dbCacheSnapshotFile + ".XXXXXX";
+    int fd = mkstemp(&tmpFileName[0]);
+    if (fd < 0)
+    {
+        cerr << "Error: Database::saveCacheSnapshot() failed creating file " << tmpFileName << " errno=" << errno << "=" << strerror(errno) << endl;
+        TimerStopAndLog(DATABASE_SAVE_CACHE_SNAPSHOT);
+        return;
+    }
+    fchmod(fd, 0644);
+    const uint8_t * pData[2] = { (const uint8_t *)&header, (const uint8_t *)records.data() };
+    uint64_t size[2] = { sizeof(header), records.size()*sizeof(DatabaseSnapshotRecord) };
+    for (uint64_t i=0; i<2; i++)
+    {
+        uint64_t written = 0;
+        while (written < size[i])
+        {
+            ssize_t result = ::write(fd, pData[i] + written, size[i] - written);
+            if (result < 0)
+            {
+                if (errno == EINTR) continue;
+                cerr << "Error: Database::saveCacheSnapshot() failed writing file " << tmpFileName << " errno=" << errno << "=" << strerror(errno) << endl;
+                ::close(fd);
+                unlink(tmpFileName.c_str());
+                TimerStopAndLog(DATABASE_SAVE_CACHE_SNAPSHOT);
+                return;
+            }
+            written += result;
+        }
+    }
+    if ((fsync(fd) != 0) || (::close(fd) != 0) || (rename(tmpFileName.c_str(), config.dbCacheSnapshotFile.c_str()) != 0))
+    {
+        cerr << "Error: Database::saveCacheSnapshot() failed saving file " << config.dbCacheSnapshotFile << " errno=" << errno << "=" << strerror(errno) << endl;
+        unlink(tmpFileName.c_str());
+        TimerStopAndLog(DATABASE_SAVE_CACHE_SNAPSHOT);
+        return;
+    }
+
+    cout << "Database::saveCacheSnapshot() saved " << records.size() << " nodes to " << config.dbCacheSnapshotFile << endl;
+    TimerStopAndLog(DATABASE_SAVE_CACHE_SNAPSHOT);
+}
+
+void Database::loadCacheSnapshot (void)
+{
+    TimerStart(DATABASE_LOAD_CACHE_SNAPSHOT);
+
+    int fd = ::open(config.dbCacheSnapshotFile.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        cout << "Database::loadCacheSnapshot() found no snapshot file " << config.dbCacheSnapshotFile << endl;
+        TimerStopAndLog(DATABASE_LOAD_CACHE_SNAPSHOT);
+        return;
+    }
+    struct stat sb;
+    if ((fstat(fd, &sb) != 0) || ((uint64_t)sb.st_size < sizeof(DatabaseSnapshotHeader)))
+    {
+        cout << "Database::loadCacheSnapshot() warning: ignoring invalid snapshot file " << config.dbCacheSnapshotFile << endl;
+        ::close(fd);
+        TimerStopAndLog(DATABASE_LOAD_CACHE_SNAPSHOT);
+        return;
+    }
+    uint64_t fileSize = sb.st_size;
+    uint8_t * pFile = (uint8_t *)mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (pFile == MAP_FAILED)
+    {
+        cerr << "Error: Database::loadCacheSnapshot() failed calling mmap() of file " << config.dbCacheSnapshotFile << " errno=" << errno << "=" << strerror(errno) << endl;
+        TimerStopAndLog(DATABASE_LOAD_CACHE_SNAPSHOT);
+        return;
+    }
+
+    // Check the header and the checksum of the records
+    const DatabaseSnapshotHeader * pHeader = (const DatabaseSnapshotHeader *)pFile;
+    const DatabaseSnapshotRecord * pRecords = (const DatabaseSnapshotRecord *)(pFile + sizeof(DatabaseSnapshotHeader));
+    uint64_t count = pHeader->count;
+    uint64_t checksum = 0;
+    bool bValid = (memcmp(pHeader->magic, DATABASE_SNAPSHOT_MAGIC, 8) == 0) && (fileSize == sizeof(DatabaseSnapshotHeader) + count*sizeof(DatabaseSnapshotRecord));
+    if (bValid)
+    {
+#pragma omp parallel for reduction(+:checksum)
+        for (uint64_t i=0; i<count; i++)
+        {
+            checksum += snapshotRecordChecksum(pRecords[i]);
+        }
+        bValid = (checksum == pHeader->checksum);
+    }
+    if (!bValid)
+    {
+        cout << "Database::loadCacheSnapshot() warning: ignoring snapshot file " << config.dbCacheSnapshotFile << " with invalid header or checksum" << endl;
+        munmap(pFile, fileSize);
+        TimerStopAndLog(DATABASE_LOAD_CACHE_SNAPSHOT);
+        return;
+    }
+
+    // Convert the records in parallel, and insert them in key order, which is the map order
+    static const char hexDigits[] = "0123456789abcdef";
+    vector< pair< string, vector<Goldilocks::Element> > > entries(count);
+#pragma omp parallel for
+    for (uint64_t i=0; i<count; i++)
+    {
+        const DatabaseSnapshotRecord &record = pRecords[i];
+        string &key = entries[i].first;
+        key.resize(64);
+        for (uint64_t j=0; j<32; j++)
+        {
+            key[2*j] = hexDigits[record.key[j] >> 4];
+            key[2*j + 1] = hexDigits[record.key[j] & 0x0F];
+        }
+        uint64_t size = zkmin(record.size, uint64_t(12));
+        entries[i].second.resize(size);
+        for (uint64_t j=0; j<size; j++) entries[i].second[j] = fr.fromU64(record.value[j]);
+    }
+    munmap(pFile, fileSize);
+
+    pthread_mutex_lock(&cacheMutex);
+    for (uint64_t i=0; i<count; i++)
+    {
+        db.emplace_hint(db.end(), move(entries[i].first), move(entries[i].second));
+    }
+    pthread_mutex_unlock(&cacheMutex);
+
+    cout << "Database::loadCacheSnapshot() loaded " << count << " nodes from " << config.dbCacheSnapshotFile << endl;
+    TimerStopAndLog(DATABASE_LOAD_CACHE_SNAPSHOT);
+}
+
+void Database::snapshotThreadLoop (void)
+{
+    pthread_mutex_lock(&snapshotMutex);
+    while (!bSnapshotStop)
+    {
+        struct timeval now;
+        gettimeofday(&now, NULL);
+        struct timespec deadline;
+        deadline.tv_sec = now.tv_sec + config.dbCacheSnapshotPeriod;
+        deadline.tv_nsec = now.tv_usec*1000;
+        pthread_cond_timedwait(&snapshotStopCond, &snapshotMutex, &deadline);
+        if (bSnapshotStop) break;
+        pthread_mutex_unlock(&snapshotMutex);
+        saveCacheSnapshot();
+        pthread_mutex_lock(&snapshotMutex);
+    }
+    pthread_mutex_unlock(&snapshotMutex);
+}
+
+void* databaseSnapshotThread (void* arg)
+{
+    Database* db = (Database*)arg;
+    db->snapshotThreadLoop();
+    return NULL;
+}
@@ -3,15 +3,47 @@
 
 #include <vector>
 #include <map>
+#include <set>
 #include <pqxx/pqxx>
 #include "goldilocks_base_field.hpp"
 #include "compare_fe.hpp"
 #include "config.hpp"
 #include <semaphore.h>
 #include "zkresult.hpp"
+#include "node_store.hpp"
+#include "node_client.hpp"
 
 using namespace std;
 
+/*
+    Snapshot of the cache of a remote database, to warm it up when the process starts, instead of
+    reading the working set from the remote database node by node
+    - It is saved every dbCacheSnapshotPeriod seconds, and when the database is destroyed, to
+      dbCacheSnapshotFile, and loaded by init(), before any request is served
+    - Records have a fixed size and are sorted by key, so the file can be mapped and split among threads
+    - The header contains the checksum of the records; a snapshot with an invalid checksum is ignored
+    - Only nodes that are stored in the remote database are saved; nodes written with persistent=false
+      only live in the cache, and must not come back after a restart as if they had been stored
+*/
+
+#define DATABASE_SNAPSHOT_MAGIC "ZKDBSN01"
+#define DATABASE_SNAPSHOT_CHUNK_SIZE 65536 // Cache entries copied per cacheMutex lock
+
+struct DatabaseSnapshotHeader
+{
+    char magic[8];
+    uint64_t count; // Number of records
+    uint64_t checksum; // Sum of the FNV-1a hashes of the records
+    uint64_t reserved;
+};
+
+struct DatabaseSnapshotRecord
+{
+    uint8_t key[32];
+    uint64_t size; // Number of used value elements
+    uint64_t value[12];
+};
+
 class Database
 {
 private:
@@ -20,6 +52,8 @@ private:
     bool asyncWrite = false;
     bool bInitialized = false;
     bool useRemoteDB = false;
+    bool useNodeStore = false;
+    bool useNodeClient = false;
     Config config;
     pthread_t writeThread;
     vector<string> writeQueue;
@@ -33,17 +67,37 @@ private:
 
     // Local database based on a map attribute
     map<string, vector<Goldilocks::Element>> db; // This is in fact a map<fe,fe[16]>
+    map<string, vector<uint8_t>> dbProgram; // Program bytecode, one byte per byte
+
+    // Embedded persistent database, based on a memory-mapped file; persistent data is not cached in db
+    // The store is shared by all the databases of this process that use the same directory
+    NodeStore * pNodeStore = NULL;
+
+    // Remote StateDB server used as a node store; nodes are cached in db
+    NodeClient nodeClient;
+
+    // Cache snapshot
+    bool useCacheSnapshot = false;
+    pthread_mutex_t cacheMutex; // Mutex to protect db and dbNotPersisted, which the snapshot thread reads
+    set<string> dbNotPersisted; // Keys of db written with persistent=false, not to be saved in the snapshot
+    pthread_mutex_t snapshotMutex; // Mutex to protect bSnapshotStop
+    pthread_cond_t snapshotStopCond;
+    pthread_t snapshotThread;
+    bool bSnapshotStop = false;
 
 private:
     // Remote database based on Postgres (PostgreSQL)
     void initRemote (void);
     zkresult readRemote (const string &key, vector<Goldilocks::Element> &value);
     zkresult writeRemote (const string &key, const vector<Goldilocks::Element> &value);
+    zkresult readProgramRemote (const string &key, vector<uint8_t> &data);
+    zkresult writeProgramRemote (const string &key, const vector<uint8_t> &data);
     void addWriteQueue (const string sqlWrite);
     void signalEmptyWriteQueue () {  };
+    void loadCacheSnapshot (void);
 
 public:
-    Database(Goldilocks &fr) : fr(fr) {};
+    Database(Goldilocks &fr) : fr(fr), nodeClient(fr) {};
     ~Database();
     void init (const Config &config);
     zkresult read (const string &key, vector<Goldilocks::Element> &value);
@@ -51,13 +105,16 @@ public:
     zkresult setProgram (const string &key, const vector<uint8_t> &value, const bool persistent);
     zkresult getProgram (const string &key, vector<uint8_t> &value);
     void processWriteQueue ();
+    void saveCacheSnapshot (void);
+    void snapshotThreadLoop (void);
     void setAutoCommit (const bool autoCommit);
     void commit();
-    void flush ();    
+    zkresult flush ();    
     void print (void);
     void printTree (const string &root, string prefix = "");
 };
 
 void* asyncDatabaseWriteThread (void* arg);
+void* databaseSnapshotThread (void* arg);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include <iostream>
+#include <grpcpp/grpcpp.h>
+#include "node_client.hpp"
+#include "statedb_utils.hpp"
+#include "scalar.hpp"
+#include "utils.hpp"
+
+//#define LOG_NODE_CLIENT
+
+NodeClient::~NodeClient()
+{
+    if (bOpen)
+    {
+        flush();
+        pthread_mutex_destroy(&mutex);
+        delete stub;
+    }
+}
+
+void NodeClient::open (const string &url, uint64_t _batchSize)
+{
+    if (bOpen)
+    {
+        cerr << "Error: NodeClient::open() called when already open" << endl;
+        exitProcess();
+    }
+
+    batchSize = _batchSize;
+    pthread_mutex_init(&mutex, NULL);
+
+    // Create channel and stub; the connection itself is established by the first call
+    std::shared_ptr<grpc_impl::Channel> channel = ::grpc::CreateChannel(url, grpc::InsecureChannelCredentials());
+    stub = new statedb::v1::StateDBService::Stub(channel);
+    if (stub == NULL)
+    {
+        cerr << "Error: NodeClient::open() failed creating the stub for url=" << url << endl;
+        exitProcess();
+    }
+
+    bOpen = true;
+}
+
+void NodeClient::key2fea (const string &key, Goldilocks::Element (&fea)[4])
+{
+    string hexKey = NormalizeToNFormat(key, 64);
+    for (uint64_t i=0; i<4; i++)
+    {
+        fea[i] = fr.fromU64(strtoull(hexKey.substr(48 - 16*i, 16).c_str(), NULL, 16));
+    }
+}
+
+zkresult NodeClient::read (const string &key, vector<Goldilocks::Element> &value)
+{
+    ::grpc::ClientContext context;
+    ::statedb::v1::GetNodesRequest request;
+    ::statedb::v1::GetNodesResponse response;
+
+    string sKeys;
+    key2grpc(key, sKeys);
+    request.set_keys(sKeys);
+
+    ::grpc::Status s = stub->GetNodes(&context, request, &response);
+    if (!s.ok())
+    {
+        cerr << "Error: NodeClient::read() failed calling GetNodes() error=" << s.error_message() << endl;
+        return ZKR_DB_ERROR;
+    }
+
+    zkresult r = static_cast<zkresult>(response.result().code());
+    if (r != ZKR_SUCCESS) return r;
+
+    string nodeKey;
+    uint64_t offset = 0;
+    if (!grpc2node(fr, response.nodes(), offset, nodeKey, value))
+    {
+        cerr << "Error: NodeClient::read() got invalid nodes of size=" << response.nodes().size() << endl;
+        return ZKR_DB_ERROR;
+    }
+
+#ifdef LOG_NODE_CLIENT
+    cout << "NodeClient::read() key=" << key << " size=" << value.size() << endl;
+#endif
+
+    // Nodes not found are returned with no value
+    return (value.size() == 0) ? ZKR_DB_KEY_NOT_FOUND : ZKR_SUCCESS;
+}
+
+zkresult NodeClient::write (const string &key, const vector<Goldilocks::Element> &value)
+{
+    zkresult r = ZKR_SUCCESS;
+
+    pthread_mutex_lock(&mutex);
+    node2grpc(fr, key, value, writeBatch);
+    writeBatchSize++;
+    if (writeBatchSize >= batchSize) r = sendWriteBatch();
+    pthread_mutex_unlock(&mutex);
+
+    return r;
+}
+
+zkresult NodeClient::sendWriteBatch (void)
+{
+    if (writeBatchSize == 0) return ZKR_SUCCESS;
+
+    ::grpc::ClientContext context;
+    ::statedb::v1::PutNodesRequest request;
+    ::statedb::v1::PutNodesResponse response;
+
+    request.set_nodes(writeBatch);
+    request.set_persistent(true);
+
+#ifdef LOG_NODE_CLIENT
+    cout << "NodeClient::sendWriteBatch() nodes=" << writeBatchSize << " bytes=" << writeBatch.size() << endl;
+#endif
+
+    // The batch is kept until the server has stored it, so that a failed call is retried by the next
+    // write or flush instead of losing its nodes
+    ::grpc::Status s = stub->PutNodes(&context, request, &response);
+    if (!s.ok())
+    {
+        cerr << "Error: NodeClient::sendWriteBatch() failed calling PutNodes() with " << writeBatchSize << " nodes error=" << s.error_message() << endl;
+        return ZKR_DB_ERROR;
+    }
+    zkresult r = static_cast<zkresult>(response.result().code());
+    if (r != ZKR_SUCCESS)
+    {
+        cerr << "Error: NodeClient::sendWriteBatch() got PutNodes() result=" << zkresult2string(r) << " with " << writeBatchSize << " nodes" << endl;
+        return r;
+    }
+
+    writeBatch.clear();
+    writeBatchSize = 0;
+
+    return ZKR_SUCCESS;
+}
+
+zkresult NodeClient::readProgram (const string &key, vector<uint8_t> &data)
+{
+    ::grpc::ClientContext context;
+    ::statedb::v1::GetProgramRequest request;
+    ::statedb::v1::GetProgramResponse response;
+
+    Goldilocks::Element fea[4];
+    key2fea(key, fea);
+    ::statedb::v1::Fea* reqKey = new ::statedb::v1::Fea();
+    fea2grpc(fr, fea, reqKey);
+    request.set_allocated_key(reqKey);
+
+    ::grpc::Status s = stub->GetProgram(&context, request, &response);
+    if (!s.ok())
+    {
+        cerr << "Error: NodeClient::readProgram() failed calling GetProgram() error=" << s.error_message() << endl;
+        return ZKR_DB_ERROR;
+    }
+
+    const string &sData = response.data();
+    data.assign(sData.begin(), sData.end());
+
+    return static_cast<zkresult>(response.result().code());
+}
+
+zkresult NodeClient::writeProgram (const string &key, const vector<uint8_t> &data)
+{
+    ::grpc::ClientContext context;
+    ::statedb::v1::SetProgramRequest request;
+    ::statedb::v1::SetProgramResponse response;
+
+    Goldilocks::Element fea[4];
+    key2fea(key, fea);
+    ::statedb::v1::Fea* reqKey = new ::statedb::v1::Fea();
+    fea2grpc(fr, fea, reqKey);
+    request.set_allocated_key(reqKey);
+
+    string sData(data.begin(), data.end());
+    request.set_data(sData);
+    request.set_persistent(true);
+
+    ::grpc::Status s = stub->SetProgram(&context, request, &response);
+    if (!s.ok())
+    {
+        cerr << "Error: NodeClient::writeProgram() failed calling SetProgram() error=" << s.error_message() << endl;
+        return ZKR_DB_ERROR;
+    }
+
+    return static_cast<zkresult>(response.result().code());
+}
+
+zkresult NodeClient::flush (void)
+{
+    // Send the pending nodes, and ask the server to flush its own database
+    pthread_mutex_lock(&mutex);
+    zkresult r = sendWriteBatch();
+    pthread_mutex_unlock(&mutex);
+    if (r != ZKR_SUCCESS) return r;
+
+    ::grpc::ClientContext context;
+    ::google::protobuf::Empty request;
+    ::google::protobuf::Empty response;
+    ::grpc::Status s = stub->Flush(&context, request, &response);
+    if (!s.ok())
+    {
+        cerr << "Error: NodeClient::flush() failed calling Flush() error=" << s.error_message() << endl;
+        return ZKR_DB_ERROR;
+    }
+
+    return ZKR_SUCCESS;
+}
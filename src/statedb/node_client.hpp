@@ -0,0 +1,55 @@
+#ifndef NODE_CLIENT_HPP
+#define NODE_CLIENT_HPP
+
+#include <string>
+#include <vector>
+#include <pthread.h>
+#include "statedb.grpc.pb.h"
+#include "goldilocks_base_field.hpp"
+#include "zkresult.hpp"
+
+using namespace std;
+
+/*
+    Client of the node level interface of a remote StateDB server (GetNodes and PutNodes), selected
+    with databaseURL=statedb://<host>:<port>, so that the SMT runs in this process and the server is
+    just a content-addressed node store
+
+    - Nodes are immutable, so the database keeps every node it reads or writes in its cache, and hot
+      upper tree nodes are fetched once per process instead of once per access
+    - Persistent writes are buffered and sent in PutNodes batches of batchSize nodes, and when
+      flushed; until then they are only visible to this process; a batch is kept until the server
+      stores it, and a failed send is reported by the write or flush that triggered it
+    - Programs use the GetProgram and SetProgram calls
+
+    Reads are not batched: the SMT only knows the hash of a child once its parent has been read, so
+    a cold lookup costs one GetNodes round trip per tree level, each with a single key; since cached
+    nodes are never evicted, every node is fetched at most once per process
+*/
+
+class NodeClient
+{
+private:
+    Goldilocks &fr;
+    bool bOpen;
+    uint64_t batchSize;
+    statedb::v1::StateDBService::Stub * stub;
+    pthread_mutex_t mutex; // Mutex to protect the write batch
+    string writeBatch; // Packed nodes pending to be sent
+    uint64_t writeBatchSize; // Number of nodes in writeBatch
+
+    void key2fea (const string &key, Goldilocks::Element (&fea)[4]);
+    zkresult sendWriteBatch (void);
+
+public:
+    NodeClient(Goldilocks &fr) : fr(fr), bOpen(false), batchSize(0), stub(NULL), writeBatchSize(0) {};
+    ~NodeClient();
+    void open (const string &url, uint64_t batchSize);
+    zkresult read (const string &key, vector<Goldilocks::Element> &value);
+    zkresult write (const string &key, const vector<Goldilocks::Element> &value);
+    zkresult readProgram (const string &key, vector<uint8_t> &data);
+    zkresult writeProgram (const string &key, const vector<uint8_t> &data);
+    zkresult flush (void);
+};
+
+#endif
@@ -0,0 +1,616 @@
+#include <iostream>
+#include <map>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <sys/time.h>
+#include "node_store.hpp"
+#include "zkassert.hpp"
+#include "scalar.hpp"
+#include "utils.hpp"
+#include "timer.hpp"
+
+#define NODE_STORE_LOG_MAGIC "ZKNLOG01"
+#define NODE_STORE_INDEX_MAGIC "ZKNIDX01"
+#define NODE_STORE_LOG_INITIAL_SIZE (64*1024*1024)
+#define NODE_STORE_INDEX_INITIAL_CAPACITY (1<<16)
+#define NODE_STORE_PAGE_SIZE 4096
+
+// FNV-1a 64 bits, used as the checksum of the log bytes between commit records
+#define NODE_STORE_CHECKSUM_BASIS 0xcbf29ce484222325ULL
+static inline uint64_t checksumUpdate (uint64_t checksum, const uint8_t * pData, uint64_t size)
+{
+    for (uint64_t i=0; i<size; i++)
+    {
+        checksum ^= pData[i];
+        checksum *= 0x100000001b3ULL;
+    }
+    return checksum;
+}
+
+// Record size, including header and padding to 8 bytes
+static inline uint64_t recordSize (uint64_t payloadSize)
+{
+    return sizeof(NodeStoreRecordHeader) + ((payloadSize + 7) & ~uint64_t(7));
+}
+
+NodeStore::~NodeStore()
+{
+    if (bOpen) close();
+}
+
+// Stores in use by this process, by real directory path; never destroyed, since databases can be
+// released during the static destruction
+static map<string, NodeStore *> * pNodeStores = NULL;
+static pthread_mutex_t nodeStoresMutex = PTHREAD_MUTEX_INITIALIZER;
+
+NodeStore * NodeStore::getInstance (Goldilocks &fr, const string &_directory, uint64_t commitPeriod)
+{
+    // Create the directory, so that its real path can be used as the key, whatever path was configured
+    if ((mkdir(_directory.c_str(), 0755) != 0) && (errno != EEXIST))
+    {
+        cerr << "Error: NodeStore::getInstance() failed creating directory " << _directory << " errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+    char realDirectory[PATH_MAX];
+    if (realpath(_directory.c_str(), realDirectory) == NULL)
+    {
+        cerr << "Error: NodeStore::getInstance() failed calling realpath(" << _directory << ") errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+    string directory = realDirectory;
+
+    pthread_mutex_lock(&nodeStoresMutex);
+
+    if (pNodeStores == NULL)
+    {
+        pNodeStores = new map<string, NodeStore *>;
+    }
+
+    NodeStore * pNodeStore;
+    map<string, NodeStore *>::iterator it = pNodeStores->find(directory);
+    if (it == pNodeStores->end())
+    {
+        pNodeStore = new NodeStore(fr);
+        pNodeStore->open(directory, commitPeriod);
+        (*pNodeStores)[directory] = pNodeStore;
+    }
+    else
+    {
+        pNodeStore = it->second;
+    }
+    pNodeStore->references++;
+
+    pthread_mutex_unlock(&nodeStoresMutex);
+
+    return pNodeStore;
+}
+
+void NodeStore::releaseInstance (NodeStore * pNodeStore)
+{
+    pthread_mutex_lock(&nodeStoresMutex);
+
+    zkassert(pNodeStore->references > 0);
+    pNodeStore->references--;
+    if (pNodeStore->references == 0)
+    {
+        pNodeStores->erase(pNodeStore->directory);
+        delete pNodeStore;
+    }
+
+    pthread_mutex_unlock(&nodeStoresMutex);
+}
+
+void NodeStore::open (const string &_directory, uint64_t _commitPeriod)
+{
+    if (bOpen)
+    {
+        cerr << "Error: NodeStore::open() called when already open" << endl;
+        exitProcess();
+    }
+    directory = _directory;
+    commitPeriod = _commitPeriod;
+    pthread_mutex_init(&mutex, NULL);
+
+    if ((mkdir(directory.c_str(), 0755) != 0) && (errno != EEXIST))
+    {
+        cerr << "Error: NodeStore::open() failed creating directory " << directory << " errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+
+    TimerStart(NODE_STORE_OPEN);
+
+    openLog();
+    uint64_t scanStart;
+    openIndex(scanStart);
+    scanLog(scanStart);
+
+    cout << "NodeStore::open() opened " << directory << " with logSize=" << logSize << " records=" << indexHeader()->count << " indexCapacity=" << indexHeader()->capacity << endl;
+    TimerStopAndLog(NODE_STORE_OPEN);
+
+    bOpen = true;
+
+    // Start the thread that periodically commits the writes
+    if (commitPeriod > 0)
+    {
+        bStop = false;
+        pthread_cond_init(&stopCond, NULL);
+        pthread_create(&commitThread, NULL, nodeStoreCommitThread, this);
+    }
+}
+
+void NodeStore::close (void)
+{
+    if (!bOpen) return;
+
+    // Stop the commit thread
+    if (commitPeriod > 0)
+    {
+        pthread_mutex_lock(&mutex);
+        bStop = true;
+        pthread_cond_signal(&stopCond);
+        pthread_mutex_unlock(&mutex);
+        pthread_join(commitThread, NULL);
+        pthread_cond_destroy(&stopCond);
+    }
+
+    pthread_mutex_lock(&mutex);
+    commitLocked();
+    munmap(pLog, logCapacity);
+    munmap(pIndex, sizeof(NodeStoreIndexHeader) + indexHeader()->capacity*sizeof(NodeStoreSlot));
+    ::close(logFd);
+    ::close(indexFd);
+    pLog = NULL;
+    pIndex = NULL;
+    bOpen = false;
+    pthread_mutex_unlock(&mutex);
+    pthread_mutex_destroy(&mutex);
+}
+
+void NodeStore::openLog (void)
+{
+    string fileName = directory + "/nodes.log";
+    logFd = ::open(fileName.c_str(), O_RDWR | O_CREAT, 0644);
+    if (logFd < 0)
+    {
+        cerr << "Error: NodeStore::openLog() failed opening " << fileName << " errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+
+    // Only one process can use the store at a time
+    if (flock(logFd, LOCK_EX | LOCK_NB) != 0)
+    {
+        cerr << "Error: NodeStore::openLog() found " << fileName << " locked by another instance" << endl;
+        exitProcess();
+    }
+
+    struct stat st;
+    fstat(logFd, &st);
+    bool bNew = (st.st_size == 0);
+    logCapacity = bNew ? NODE_STORE_LOG_INITIAL_SIZE : st.st_size;
+    if (bNew && (ftruncate(logFd, logCapacity) != 0))
+    {
+        cerr << "Error: NodeStore::openLog() failed calling ftruncate(" << logCapacity << ") errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+
+    pLog = (uint8_t *)mmap(NULL, logCapacity, PROT_READ | PROT_WRITE, MAP_SHARED, logFd, 0);
+    if (pLog == MAP_FAILED)
+    {
+        cerr << "Error: NodeStore::openLog() failed calling mmap(" << logCapacity << ") errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+
+    NodeStoreLogHeader * pHeader = (NodeStoreLogHeader *)pLog;
+    if (bNew)
+    {
+        memcpy(pHeader->magic, NODE_STORE_LOG_MAGIC, 8);
+        msync(pLog, NODE_STORE_PAGE_SIZE, MS_SYNC);
+    }
+    else if (memcmp(pHeader->magic, NODE_STORE_LOG_MAGIC, 8) != 0)
+    {
+        cerr << "Error: NodeStore::openLog() found invalid magic in " << fileName << endl;
+        exitProcess();
+    }
+}
+
+void NodeStore::openIndex (uint64_t &scanStart)
+{
+    string fileName = directory + "/nodes.idx";
+    indexFd = ::open(fileName.c_str(), O_RDWR | O_CREAT, 0644);
+    if (indexFd < 0)
+    {
+        cerr << "Error: NodeStore::openIndex() failed opening " << fileName << " errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+
+    // Trust the index only if it was synced after a commit that is still in the log
+    struct stat st;
+    fstat(indexFd, &st);
+    if ((uint64_t)st.st_size >= sizeof(NodeStoreIndexHeader))
+    {
+        NodeStoreIndexHeader header;
+        if (pread(indexFd, &header, sizeof(header), 0) == sizeof(header) &&
+            (memcmp(header.magic, NODE_STORE_INDEX_MAGIC, 8) == 0) &&
+            (header.clean == 1) &&
+            (header.logSize >= sizeof(NodeStoreLogHeader)) &&
+            (header.logSize <= logCapacity) &&
+            (header.capacity > 0) && ((header.capacity & (header.capacity - 1)) == 0) &&
+            ((uint64_t)st.st_size == sizeof(NodeStoreIndexHeader) + header.capacity*sizeof(NodeStoreSlot)))
+        {
+            pIndex = (uint8_t *)mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, indexFd, 0);
+            if (pIndex == MAP_FAILED)
+            {
+                cerr << "Error: NodeStore::openIndex() failed calling mmap(" << st.st_size << ") errno=" << errno << "=" << strerror(errno) << endl;
+                exitProcess();
+            }
+            scanStart = header.logSize;
+            return;
+        }
+    }
+
+    // Otherwise, rebuild it from the beginning of the log
+    cout << "NodeStore::openIndex() rebuilding the index from the log" << endl;
+    createIndex(NODE_STORE_INDEX_INITIAL_CAPACITY);
+    scanStart = sizeof(NodeStoreLogHeader);
+}
+
+void NodeStore::createIndex (uint64_t capacity)
+{
+    uint64_t size = sizeof(NodeStoreIndexHeader) + capacity*sizeof(NodeStoreSlot);
+    if ((ftruncate(indexFd, 0) != 0) || (ftruncate(indexFd, size) != 0))
+    {
+        cerr << "Error: NodeStore::createIndex() failed calling ftruncate(" << size << ") errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+    pIndex = (uint8_t *)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, indexFd, 0);
+    if (pIndex == MAP_FAILED)
+    {
+        cerr << "Error: NodeStore::createIndex() failed calling mmap(" << size << ") errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+    NodeStoreIndexHeader * pHeader = indexHeader();
+    memcpy(pHeader->magic, NODE_STORE_INDEX_MAGIC, 8);
+    pHeader->capacity = capacity;
+    pHeader->count = 0;
+    pHeader->logSize = sizeof(NodeStoreLogHeader);
+    pHeader->clean = 1;
+    bIndexDirty = false;
+    markIndexDirty();
+}
+
+void NodeStore::growIndex (void)
+{
+    // Keep the used slots, and insert them again into an index of double capacity
+    NodeStoreIndexHeader * pHeader = indexHeader();
+    uint64_t capacity = pHeader->capacity;
+    uint64_t logSizeBackup = pHeader->logSize;
+    vector<NodeStoreSlot> slots;
+    slots.reserve(pHeader->count);
+    for (uint64_t i=0; i<capacity; i++)
+    {
+        if (indexSlots()[i].offset != 0) slots.push_back(indexSlots()[i]);
+    }
+    munmap(pIndex, sizeof(NodeStoreIndexHeader) + capacity*sizeof(NodeStoreSlot));
+
+    createIndex(capacity*2);
+    indexHeader()->logSize = logSizeBackup;
+    for (uint64_t i=0; i<slots.size(); i++)
+    {
+        insert(slots[i].key, slots[i].offset);
+    }
+}
+
+void NodeStore::markIndexDirty (void)
+{
+    // Persist the dirty mark before modifying the index, so that an index with changes that
+    // were not committed to the log is never trusted
+    if (bIndexDirty) return;
+    indexHeader()->clean = 0;
+    msync(pIndex, NODE_STORE_PAGE_SIZE, MS_SYNC);
+    bIndexDirty = true;
+}
+
+void NodeStore::growLog (uint64_t size)
+{
+    uint64_t newCapacity = logCapacity;
+    while (newCapacity < size) newCapacity *= 2;
+    if (ftruncate(logFd, newCapacity) != 0)
+    {
+        cerr << "Error: NodeStore::growLog() failed calling ftruncate(" << newCapacity << ") errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+    void * pNew = mremap(pLog, logCapacity, newCapacity, MREMAP_MAYMOVE);
+    if (pNew == MAP_FAILED)
+    {
+        cerr << "Error: NodeStore::growLog() failed calling mremap(" << newCapacity << ") errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+    pLog = (uint8_t *)pNew;
+    logCapacity = newCapacity;
+}
+
+void NodeStore::scanLog (uint64_t start)
+{
+    // Walk the records after start, indexing them only once their commit record is found valid
+    vector<uint64_t> pending;
+    uint64_t offset = start;
+    uint64_t lastCommit = start;
+    uint64_t scanChecksum = NODE_STORE_CHECKSUM_BASIS;
+    while (offset + sizeof(NodeStoreRecordHeader) <= logCapacity)
+    {
+        NodeStoreRecordHeader * pRecord = (NodeStoreRecordHeader *)(pLog + offset);
+        uint64_t size = recordSize(pRecord->size);
+        if (offset + size > logCapacity) break;
+        if (pRecord->type == NODE_STORE_RECORD_COMMIT)
+        {
+            uint64_t recordChecksum;
+            memcpy(&recordChecksum, pLog + offset + sizeof(NodeStoreRecordHeader), 8);
+            if ((pRecord->size != 8) || (recordChecksum != scanChecksum)) break;
+            for (uint64_t i=0; i<pending.size(); i++)
+            {
+                NodeStoreRecordHeader * pPending = (NodeStoreRecordHeader *)(pLog + pending[i]);
+                if (find(pPending->key, pPending->type) == 0) insert(pPending->key, pending[i]);
+            }
+            pending.clear();
+            offset += size;
+            lastCommit = offset;
+            scanChecksum = NODE_STORE_CHECKSUM_BASIS;
+        }
+        else if ((pRecord->type == NODE_STORE_RECORD_NODE) || (pRecord->type == NODE_STORE_RECORD_PROGRAM))
+        {
+            pending.push_back(offset);
+            scanChecksum = checksumUpdate(scanChecksum, pLog + offset, size);
+            offset += size;
+        }
+        else break;
+    }
+
+    // Discard the records after the last valid commit, zeroing them up to the first empty page
+    if (offset > lastCommit)
+    {
+        cout << "NodeStore::scanLog() discarding " << offset - lastCommit << " uncommitted bytes" << endl;
+    }
+    uint64_t zeroEnd = (offset + NODE_STORE_PAGE_SIZE - 1) & ~uint64_t(NODE_STORE_PAGE_SIZE - 1);
+    if (zeroEnd > logCapacity) zeroEnd = logCapacity;
+    while (zeroEnd < logCapacity)
+    {
+        bool bEmpty = true;
+        for (uint64_t i=0; i<NODE_STORE_PAGE_SIZE; i++)
+        {
+            if (pLog[zeroEnd + i] != 0) { bEmpty = false; break; }
+        }
+        if (bEmpty) break;
+        zeroEnd += NODE_STORE_PAGE_SIZE;
+    }
+    if (zeroEnd > lastCommit)
+    {
+        memset(pLog + lastCommit, 0, zeroEnd - lastCommit);
+        uint64_t syncStart = lastCommit & ~uint64_t(NODE_STORE_PAGE_SIZE - 1);
+        msync(pLog + syncStart, zeroEnd - syncStart, MS_SYNC);
+    }
+
+    logSize = lastCommit;
+    committedSize = lastCommit;
+    checksum = NODE_STORE_CHECKSUM_BASIS;
+
+    // Sync the index, if modified
+    if (bIndexDirty)
+    {
+        indexHeader()->logSize = committedSize;
+        msync(pIndex, sizeof(NodeStoreIndexHeader) + indexHeader()->capacity*sizeof(NodeStoreSlot), MS_SYNC);
+        indexHeader()->clean = 1;
+        msync(pIndex, NODE_STORE_PAGE_SIZE, MS_SYNC);
+        bIndexDirty = false;
+    }
+}
+
+void NodeStore::key2bytes (const string &key, uint8_t (&bytes)[32])
+{
+    // Keys are normalized by the database to 64 hexa characters
+    if (key.size() != 64)
+    {
+        cerr << "Error: NodeStore::key2bytes() got invalid key size=" << key.size() << endl;
+        exitProcess();
+    }
+    for (uint64_t i=0; i<32; i++)
+    {
+        bytes[i] = (char2byte(key[2*i]) << 4) | char2byte(key[2*i + 1]);
+    }
+}
+
+uint64_t NodeStore::find (const uint8_t (&key)[32], uint32_t type)
+{
+    // Keys are hashes, so any 8 bytes of them are uniformly distributed
+    uint64_t mask = indexHeader()->capacity - 1;
+    uint64_t h;
+    memcpy(&h, key + 24, 8);
+    NodeStoreSlot * pSlots = indexSlots();
+    for (uint64_t i = h & mask; ; i = (i + 1) & mask)
+    {
+        if (pSlots[i].offset == 0) return 0;
+        if ((memcmp(pSlots[i].key, key, 32) == 0) && (((NodeStoreRecordHeader *)(pLog + pSlots[i].offset))->type == type))
+        {
+            return pSlots[i].offset;
+        }
+    }
+}
+
+void NodeStore::insert (const uint8_t (&key)[32], uint64_t offset)
+{
+    markIndexDirty();
+    if ((indexHeader()->count + 1)*10 > indexHeader()->capacity*7) growIndex();
+
+    uint64_t mask = indexHeader()->capacity - 1;
+    uint64_t h;
+    memcpy(&h, key + 24, 8);
+    NodeStoreSlot * pSlots = indexSlots();
+    uint64_t i = h & mask;
+    while (pSlots[i].offset != 0) i = (i + 1) & mask;
+    memcpy(pSlots[i].key, key, 32);
+    pSlots[i].offset = offset;
+    indexHeader()->count++;
+}
+
+uint64_t NodeStore::append (uint32_t type, const uint8_t (&key)[32], const uint8_t * pPayload, uint64_t size)
+{
+    uint64_t totalSize = recordSize(size);
+    if (logSize + totalSize > logCapacity) growLog(logSize + totalSize);
+
+    uint64_t offset = logSize;
+    NodeStoreRecordHeader * pRecord = (NodeStoreRecordHeader *)(pLog + offset);
+    pRecord->type = type;
+    pRecord->size = size;
+    memcpy(pRecord->key, key, 32);
+    memcpy(pLog + offset + sizeof(NodeStoreRecordHeader), pPayload, size);
+    memset(pLog + offset + sizeof(NodeStoreRecordHeader) + size, 0, totalSize - sizeof(NodeStoreRecordHeader) - size);
+    logSize += totalSize;
+
+    if (type != NODE_STORE_RECORD_COMMIT) checksum = checksumUpdate(checksum, pLog + offset, totalSize);
+    return offset;
+}
+
+zkresult NodeStore::read (const string &key, vector<Goldilocks::Element> &value)
+{
+    uint8_t keyBytes[32];
+    key2bytes(key, keyBytes);
+
+    pthread_mutex_lock(&mutex);
+    uint64_t offset = find(keyBytes, NODE_STORE_RECORD_NODE);
+    if (offset == 0)
+    {
+        pthread_mutex_unlock(&mutex);
+        return ZKR_DB_KEY_NOT_FOUND;
+    }
+    NodeStoreRecordHeader * pRecord = (NodeStoreRecordHeader *)(pLog + offset);
+    uint64_t size = pRecord->size / 8;
+    const uint8_t * pPayload = pLog + offset + sizeof(NodeStoreRecordHeader);
+    value.resize(size);
+    for (uint64_t i=0; i<size; i++)
+    {
+        uint64_t u;
+        memcpy(&u, pPayload + i*8, 8);
+        value[i] = fr.fromU64(u);
+    }
+    pthread_mutex_unlock(&mutex);
+
+    return ZKR_SUCCESS;
+}
+
+zkresult NodeStore::write (const string &key, const vector<Goldilocks::Element> &value)
+{
+    uint8_t keyBytes[32];
+    key2bytes(key, keyBytes);
+
+    vector<uint64_t> payload(value.size());
+    for (uint64_t i=0; i<value.size(); i++) payload[i] = fr.toU64(value[i]);
+
+    pthread_mutex_lock(&mutex);
+    // Nodes are content-addressed, so an existing key already has this value
+    if (find(keyBytes, NODE_STORE_RECORD_NODE) == 0)
+    {
+        uint64_t offset = append(NODE_STORE_RECORD_NODE, keyBytes, (const uint8_t *)payload.data(), payload.size()*8);
+        insert(keyBytes, offset);
+    }
+    pthread_mutex_unlock(&mutex);
+
+    return ZKR_SUCCESS;
+}
+
+zkresult NodeStore::readProgram (const string &key, vector<uint8_t> &data)
+{
+    uint8_t keyBytes[32];
+    key2bytes(key, keyBytes);
+
+    pthread_mutex_lock(&mutex);
+    uint64_t offset = find(keyBytes, NODE_STORE_RECORD_PROGRAM);
+    if (offset == 0)
+    {
+        pthread_mutex_unlock(&mutex);
+        return ZKR_DB_KEY_NOT_FOUND;
+    }
+    NodeStoreRecordHeader * pRecord = (NodeStoreRecordHeader *)(pLog + offset);
+    const uint8_t * pPayload = pLog + offset + sizeof(NodeStoreRecordHeader);
+    data.assign(pPayload, pPayload + pRecord->size);
+    pthread_mutex_unlock(&mutex);
+
+    return ZKR_SUCCESS;
+}
+
+zkresult NodeStore::writeProgram (const string &key, const vector<uint8_t> &data)
+{
+    uint8_t keyBytes[32];
+    key2bytes(key, keyBytes);
+
+    pthread_mutex_lock(&mutex);
+    if (find(keyBytes, NODE_STORE_RECORD_PROGRAM) == 0)
+    {
+        uint64_t offset = append(NODE_STORE_RECORD_PROGRAM, keyBytes, data.data(), data.size());
+        insert(keyBytes, offset);
+    }
+    pthread_mutex_unlock(&mutex);
+
+    return ZKR_SUCCESS;
+}
+
+void NodeStore::commit (void)
+{
+    pthread_mutex_lock(&mutex);
+    commitLocked();
+    pthread_mutex_unlock(&mutex);
+}
+
+void NodeStore::commitLocked (void)
+{
+    if (logSize == committedSize) return;
+
+    // Append the commit record, and sync the log from the previous commit
+    uint8_t zeroKey[32] = {0};
+    append(NODE_STORE_RECORD_COMMIT, zeroKey, (const uint8_t *)&checksum, 8);
+    uint64_t syncStart = committedSize & ~uint64_t(NODE_STORE_PAGE_SIZE - 1);
+    if (msync(pLog + syncStart, logSize - syncStart, MS_SYNC) != 0)
+    {
+        cerr << "Error: NodeStore::commitLocked() failed calling msync() errno=" << errno << "=" << strerror(errno) << endl;
+        exitProcess();
+    }
+    committedSize = logSize;
+    checksum = NODE_STORE_CHECKSUM_BASIS;
+
+    // Sync the index slots, and then mark it as clean, for the committed log size
+    indexHeader()->logSize = committedSize;
+    msync(pIndex, sizeof(NodeStoreIndexHeader) + indexHeader()->capacity*sizeof(NodeStoreSlot), MS_SYNC);
+    indexHeader()->clean = 1;
+    msync(pIndex, NODE_STORE_PAGE_SIZE, MS_SYNC);
+    bIndexDirty = false;
+}
+
+void NodeStore::commitThreadLoop (void)
+{
+    pthread_mutex_lock(&mutex);
+    while (!bStop)
+    {
+        struct timeval now;
+        gettimeofday(&now, NULL);
+        uint64_t usec = now.tv_usec + (commitPeriod%1000)*1000;
+        struct timespec deadline;
+        deadline.tv_sec = now.tv_sec + commitPeriod/1000 + usec/1000000;
+        deadline.tv_nsec = (usec%1000000)*1000;
+        pthread_cond_timedwait(&stopCond, &mutex, &deadline);
+        if (bStop) break;
+        commitLocked();
+    }
+    pthread_mutex_unlock(&mutex);
+}
+
+void* nodeStoreCommitThread (void* arg)
+{
+    NodeStore * pNodeStore = (NodeStore *)arg;
+    pNodeStore->commitThreadLoop();
+    return NULL;
+}
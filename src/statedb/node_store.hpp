@@ -0,0 +1,132 @@
+#ifndef NODE_STORE_HPP
+#define NODE_STORE_HPP
+
+#include <string>
+#include <vector>
+#include <pthread.h>
+#include "goldilocks_base_field.hpp"
+#include "zkresult.hpp"
+
+using namespace std;
+
+/*
+    Embedded persistent store of the database nodes and programs, selected with databaseURL=file://<directory>
+
+    - nodes.log: append-only log of records, memory mapped; every record has a header with its type,
+      payload size and 32-byte key (the node hash), followed by the payload: 8 bytes per field element
+      for nodes, raw bytes for programs
+    - nodes.idx: memory-mapped open-addressing hash table, keyed by the 32-byte hash, with the log offset
+      of every record, so that a read is a couple of page accesses instead of a SQL round trip
+    - Writes become durable when a commit record is appended, with the checksum of the log bytes written
+      since the previous commit, and the log is synced; commits are done every commitPeriod ms by a
+      background thread, and when flushed, so a crash can only lose the writes of the last period
+    - When opened, the log is truncated after its last valid commit record; the index is only trusted
+      if it was synced after a commit, otherwise it is rebuilt from the log
+
+    Nodes are content-addressed and never modified or deleted, so the log contains no dead records and
+    needs no compaction; only the index is resized, when its load factor gets too high
+
+    The log is locked, so only one process can open a directory; within a process, all the databases
+    configured with the same directory share one store, obtained with getInstance()
+*/
+
+#define NODE_STORE_RECORD_NODE 1
+#define NODE_STORE_RECORD_PROGRAM 2
+#define NODE_STORE_RECORD_COMMIT 3
+
+// On-disk layouts; all the records and payloads are 8-byte aligned
+struct NodeStoreLogHeader
+{
+    char magic[8];
+    uint8_t reserved[56];
+};
+
+struct NodeStoreRecordHeader
+{
+    uint32_t type;
+    uint32_t size; // Payload size, in bytes, without padding
+    uint8_t key[32];
+};
+
+struct NodeStoreIndexHeader
+{
+    char magic[8];
+    uint64_t capacity; // Number of slots, a power of 2
+    uint64_t count; // Number of used slots
+    uint64_t logSize; // Committed log size this index corresponds to
+    uint64_t clean; // 1 if the index was synced after the last commit
+    uint8_t reserved[24];
+};
+
+struct NodeStoreSlot
+{
+    uint8_t key[32];
+    uint64_t offset; // Log offset of the record, or 0 if the slot is free
+};
+
+class NodeStore
+{
+private:
+    Goldilocks &fr;
+    bool bOpen;
+    string directory;
+    uint64_t commitPeriod; // In ms; 0 means only commit when flushed
+    pthread_mutex_t mutex; // Mutex to protect the log and the index
+
+    // Log
+    int logFd;
+    uint8_t * pLog;
+    uint64_t logCapacity; // Mapped size
+    uint64_t logSize; // Used size
+    uint64_t committedSize; // Size up to the last commit record
+    uint64_t checksum; // Checksum of the bytes written since the last commit
+
+    // Index
+    int indexFd;
+    uint8_t * pIndex;
+    bool bIndexDirty; // Index modified since last synced
+
+    // Commit thread
+    pthread_t commitThread;
+    pthread_cond_t stopCond;
+    bool bStop;
+
+    uint64_t references; // Number of getInstance() calls not yet released
+
+    NodeStoreIndexHeader * indexHeader (void) { return (NodeStoreIndexHeader *)pIndex; };
+    NodeStoreSlot * indexSlots (void) { return (NodeStoreSlot *)(pIndex + sizeof(NodeStoreIndexHeader)); };
+    void key2bytes (const string &key, uint8_t (&bytes)[32]);
+    uint64_t find (const uint8_t (&key)[32], uint32_t type);
+    void insert (const uint8_t (&key)[32], uint64_t offset);
+    void markIndexDirty (void);
+    void openLog (void);
+    void openIndex (uint64_t &scanStart);
+    void createIndex (uint64_t capacity);
+    void growIndex (void);
+    void growLog (uint64_t size);
+    void scanLog (uint64_t start);
+    uint64_t append (uint32_t type, const uint8_t (&key)[32], const uint8_t * pPayload, uint64_t size);
+    void commitLocked (void);
+
+public:
+    NodeStore(Goldilocks &fr) : fr(fr), bOpen(false), commitPeriod(0), logFd(-1), pLog(NULL), logCapacity(0), logSize(0), committedSize(0), checksum(0), indexFd(-1), pIndex(NULL), bIndexDirty(false), bStop(false), references(0) {};
+    ~NodeStore();
+    void open (const string &directory, uint64_t commitPeriod);
+    void close (void);
+    zkresult read (const string &key, vector<Goldilocks::Element> &value);
+    zkresult write (const string &key, const vector<Goldilocks::Element> &value);
+    zkresult readProgram (const string &key, vector<uint8_t> &data);
+    zkresult writeProgram (const string &key, const vector<uint8_t> &data);
+    void commit (void);
+    void commitThreadLoop (void);
+
+    // Returns the store of a directory, opening it if this process is not using it yet
+    static NodeStore * getInstance (Goldilocks &fr, const string &directory, uint64_t commitPeriod);
+
+    // Releases a store returned by getInstance(), closing it when no database of this process uses it
+    static void releaseInstance (NodeStore * pNodeStore);
+};
+
+void* nodeStoreCommitThread (void* arg);
+
+#endif
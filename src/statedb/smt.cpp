@@ -1,4 +1,6 @@
 #include "smt.hpp"
+#include <algorithm>
+#include <array>
 #include "scalar.hpp"
 #include "utils.hpp"
 #include "zkresult.hpp"
@@ -29,6 +31,10 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
     
     map< uint64_t, vector<Goldilocks::Element> > siblings;
 
+    // Hashes calculated by hashSave, only recorded if the caller needs them to build the Storage SM
+    vector< array<Goldilocks::Element, 16> > hashes;
+    vector< array<Goldilocks::Element, 16> > *pHashes = result.bHashes ? &hashes : NULL;
+
     mpz_class insValue = 0;
     mpz_class oldValue = 0;
     mpz_class foundVal = 0;
@@ -150,7 +156,7 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
 
                 // Save and get the new value hash
                 Goldilocks::Element newValH[4];
-                hashSave(db, v, c, persistent, newValH);
+                hashSave(db, v, c, persistent, newValH, pHashes);
                 
                 // Second, we create the db entry for the new leaf node = RKEY + HASH, and store the calculated hash in newLeafHash
                 for (uint64_t i=0; i<4; i++) v[i] = foundRKey[i];
@@ -161,7 +167,7 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
 
                 // Save and get the hash
                 Goldilocks::Element newLeafHash[4];
-                hashSave(db, v, c, persistent, newLeafHash);
+                hashSave(db, v, c, persistent, newLeafHash, pHashes);
 
                 // Increment the counter
                 proofHashCounter += 2;
@@ -219,7 +225,7 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
 
                 // Save and get the hash
                 Goldilocks::Element oldLeafHash[4];
-                hashSave(db, v, c, persistent, oldLeafHash);
+                hashSave(db, v, c, persistent, oldLeafHash, pHashes);
 
                 // Record the inserted key for the reallocated old value
                 insKey[0] = foundKey[0];
@@ -248,7 +254,7 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
 
                 // Create the intermediate node
                 Goldilocks::Element newValH[4];
-                hashSave(db, valueFea, c, persistent, newValH);
+                hashSave(db, valueFea, c, persistent, newValH, pHashes);
                 
                 // Insert a new leaf node for the new key-value hash pair
 
@@ -261,7 +267,7 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
                 
                 // Create the node and store the hash in newLeafHash
                 Goldilocks::Element newLeafHash[4];
-                hashSave(db, v, c, persistent, newLeafHash);
+                hashSave(db, v, c, persistent, newLeafHash, pHashes);
 
                 // Insert a new bifurcation intermediate node with both hashes (old and new) in the right position based on the bit
 
@@ -278,7 +284,7 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
 
                 // Create the node and store the calculated hash in r2
                 Goldilocks::Element r2[4];
-                hashSave(db, node, c, persistent, r2);
+                hashSave(db, node, c, persistent, r2, pHashes);
                 proofHashCounter += 4;
                 level2--;
 #ifdef LOG_SMT
@@ -301,7 +307,7 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
                     c[0] = fr.zero();
 
                     // Create the intermediate node and store the calculated hash in r2
-                    hashSave(db, node, c, persistent, r2);
+                    hashSave(db, node, c, persistent, r2, pHashes);
 
                     proofHashCounter += 1;
 
@@ -354,7 +360,7 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
 
             // Create the node and store the calculated hash in newValH
             Goldilocks::Element newValH[4];
-            hashSave(db, valueFea, c, persistent, newValH);
+            hashSave(db, valueFea, c, persistent, newValH, pHashes);
 
             // Insert the new key-value hash leaf node
 
@@ -368,7 +374,7 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
 
             // Create the new leaf node and store the calculated hash in newLeafHash
             Goldilocks::Element newLeafHash[4];
-            hashSave(db, keyvalVector, c, persistent, newLeafHash);
+            hashSave(db, keyvalVector, c, persistent, newLeafHash, pHashes);
 
             proofHashCounter += 2;
 
@@ -504,7 +510,7 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
 
                         // Create node and store computed hash in oldLeafHash
                         Goldilocks::Element oldLeafHash[4];
-                        hashSave(db, a, c, persistent, oldLeafHash);
+                        hashSave(db, a, c, persistent, oldLeafHash, pHashes);
 
                         // Increment the counter
                         proofHashCounter += 1;
@@ -585,7 +591,7 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
         Goldilocks::Element a[8], c[4];
         for (uint64_t i=0; i<8; i++) a[i] = siblings[level][i];
         for (uint64_t i=0; i<4; i++) c[i] = siblings[level][8+i];
-        hashSave(db, a, c, persistent, newRoot);
+        hashSave(db, a, c, persistent, newRoot, pHashes);
 
         // Increment the counter
         proofHashCounter += 1;
@@ -625,6 +631,7 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
     result.newValue   = value;
     result.mode       = mode;
     result.proofHashCounter = proofHashCounter;
+    result.hashes     = hashes;
 
 #ifdef LOG_SMT
     cout << "Smt::set() returns isOld0=" << result.isOld0 << " insKey=" << fea2string(fr,result.insKey) << " oldValue=" << result.oldValue.get_str(16) << " newRoot=" << fea2string(fr,result.newRoot) << " mode=" << result.mode << endl << endl;
@@ -636,6 +643,159 @@ zkresult Smt::set (Database &db, const Goldilocks::Element (&oldRoot)[4], const
     return ZKR_SUCCESS;
 }
 
+/*
+    Sets a batch of keys in a single tree walk:
+    - The entries are sorted by key path, so that the keys of every subtree are contiguous
+    - The tree is descended once, reading only the nodes on the paths of the keys, and the new tree
+      is planned: every modified subtree is rebuilt from the final set of its leaves, and a leaf left
+      alone by deletions is moved up, as set does, so the new root is the same that setting the keys
+      one by one would get
+    - Every new node is hashed exactly once, level by level from the bottom, in parallel, and saved
+    If a key appears more than once, its last value is set.
+    If results is provided, the keys are set one by one instead, in the order of the entries, to
+    get the per-key results required by the Storage SM.
+*/
+zkresult Smt::setBatch ( Database &db, const Goldilocks::Element (&oldRoot)[4], const vector<SmtBatchEntry> &entries, const bool persistent, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> *results )
+{
+#ifdef LOG_SMT
+    cout << "Smt::setBatch() called with oldRoot=" << fea2string(fr,oldRoot) << " entries=" << entries.size() << " persistent=" << persistent << endl;
+#endif
+    zkresult zkr;
+
+    for (uint64_t i=0; i<4; i++) newRoot[i] = oldRoot[i];
+
+    // Set the keys one by one, if the per-key results are required
+    if (results != NULL)
+    {
+        results->clear();
+        results->resize(entries.size());
+        for (uint64_t i=0; i<entries.size(); i++)
+        {
+            (*results)[i].bHashes = true;
+            zkr = set(db, newRoot, entries[i].key, entries[i].value, persistent, (*results)[i]);
+            if (zkr != ZKR_SUCCESS)
+            {
+                return zkr;
+            }
+            for (uint64_t j=0; j<4; j++) newRoot[j] = (*results)[i].newRoot[j];
+        }
+        return ZKR_SUCCESS;
+    }
+
+    if (entries.size() == 0)
+    {
+        return ZKR_SUCCESS;
+    }
+
+    // Sort the entries by key path, keeping the order of the repeated keys, and keep only their last value
+    vector<uint64_t> order(entries.size());
+    for (uint64_t i=0; i<entries.size(); i++) order[i] = i;
+    stable_sort(order.begin(), order.end(), [&](uint64_t a, uint64_t b) { return keyPathLess(entries[a].key, entries[b].key, 0); });
+    vector<uint64_t> sorted;
+    for (uint64_t i=0; i<order.size(); i++)
+    {
+        if ( (i+1 < order.size()) && !keyPathLess(entries[order[i]].key, entries[order[i+1]].key, 0) )
+        {
+            continue;
+        }
+        sorted.push_back(order[i]);
+    }
+
+    // Node 0 is the empty node, and nodes 1 to sorted.size() are the leaves of the entries, in path order;
+    // their value hashes are independent, so they are calculated in parallel
+    vector<SmtBatchNode> nodes(1 + sorted.size());
+    vector< array<Goldilocks::Element, 8> > values(sorted.size());
+#pragma omp parallel for
+    for (uint64_t i=0; i<sorted.size(); i++)
+    {
+        const SmtBatchEntry &entry = entries[sorted[i]];
+        SmtBatchNode &node = nodes[1 + i];
+        for (uint64_t j=0; j<4; j++) node.key[j] = entry.key[j];
+
+        // Deleted keys keep the empty type; they are only used to find their path
+        if (entry.value == 0) continue;
+
+        Goldilocks::Element v[8];
+        scalar2fea(fr, entry.value, v);
+        Goldilocks::Element a[12];
+        for (uint64_t j=0; j<8; j++) a[j] = v[j];
+        for (uint64_t j=8; j<12; j++) a[j] = fr.zero();
+        poseidon.hash(node.valueHash, a);
+        for (uint64_t j=0; j<8; j++) values[i][j] = v[j];
+        node.type = SMT_BATCH_NODE_LEAF;
+    }
+
+    // Walk down the tree and plan the new one
+    uint64_t root;
+    zkr = planBatch(db, oldRoot, 0, 0, sorted.size(), nodes, root);
+    if (zkr != ZKR_SUCCESS)
+    {
+        return zkr;
+    }
+
+    // Group the new nodes by level
+    vector< vector<uint64_t> > levels;
+    collectBatch(nodes, root, 0, levels);
+
+    // Hash the new nodes from the bottom level up; the nodes of a level only depend on the lower ones
+    for (int64_t level=levels.size()-1; level>=0; level--)
+    {
+        vector<uint64_t> &levelNodes = levels[level];
+#pragma omp parallel for
+        for (uint64_t i=0; i<levelNodes.size(); i++)
+        {
+            SmtBatchNode &node = nodes[levelNodes[i]];
+            if (node.type == SMT_BATCH_NODE_LEAF)
+            {
+                // Leaf node = remaining key + value hash, with capacity 1, 0, 0, 0
+                Goldilocks::Element rKey[4];
+                removeKeyBits(node.key, level, rKey);
+                for (uint64_t j=0; j<4; j++) node.data[j] = rKey[j];
+                for (uint64_t j=0; j<4; j++) node.data[4+j] = node.valueHash[j];
+                node.data[8] = fr.one();
+            }
+            else
+            {
+                // Intermediate node = left child hash + right child hash, with capacity 0, 0, 0, 0
+                for (uint64_t j=0; j<4; j++) node.data[j] = nodes[node.child[0]].hash[j];
+                for (uint64_t j=0; j<4; j++) node.data[4+j] = nodes[node.child[1]].hash[j];
+                node.data[8] = fr.zero();
+            }
+            for (uint64_t j=9; j<12; j++) node.data[j] = fr.zero();
+            poseidon.hash(node.hash, node.data);
+        }
+    }
+
+    // Save the new values and nodes
+    for (uint64_t i=0; i<sorted.size(); i++)
+    {
+        if (nodes[1 + i].type != SMT_BATCH_NODE_LEAF) continue;
+        vector<Goldilocks::Element> dbValue(values[i].begin(), values[i].end());
+        for (uint64_t j=0; j<4; j++) dbValue.push_back(fr.zero());
+        db.write(fea2string(fr, nodes[1 + i].valueHash), dbValue, persistent);
+    }
+    for (uint64_t level=0; level<levels.size(); level++)
+    {
+        for (uint64_t i=0; i<levels[level].size(); i++)
+        {
+            SmtBatchNode &node = nodes[levels[level][i]];
+            vector<Goldilocks::Element> dbValue(node.data, node.data + 12);
+            db.write(fea2string(fr, node.hash), dbValue, persistent);
+        }
+    }
+
+    for (uint64_t i=0; i<4; i++) newRoot[i] = nodes[root].hash[i];
+
+#ifdef LOG_SMT
+    cout << "Smt::setBatch() returns newRoot=" << fea2string(fr,newRoot) << " nodes=" << nodes.size() << " levels=" << levels.size() << endl;
+#endif
+#ifdef LOG_SMT_SET_PRINT_TREE
+    db.printTree(fea2string(fr,newRoot));
+#endif
+
+    return ZKR_SUCCESS;
+}
+
 zkresult Smt::get ( Database &db, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], SmtGetResult &result )
 {
 #ifdef LOG_SMT
@@ -894,7 +1054,7 @@ void Smt::removeKeyBits ( const Goldilocks::Element (&key)[4], uint64_t nBits, G
     }
 }
 
-void Smt::hashSave ( Database &db, const Goldilocks::Element (&a)[8], const Goldilocks::Element (&c)[4], const bool persistent, Goldilocks::Element (&hash)[4])
+void Smt::hashSave ( Database &db, const Goldilocks::Element (&a)[8], const Goldilocks::Element (&c)[4], const bool persistent, Goldilocks::Element (&hash)[4], vector< array<Goldilocks::Element, 16> > *hashes )
 {
     // Calculate the poseidon hash of the vector of field elements: v = a | c
     Goldilocks::Element v[12];
@@ -911,6 +1071,9 @@ void Smt::hashSave ( Database &db, const Goldilocks::Element (&a)[8], const Gold
     for (uint64_t i=0; i<4; i++) dbValue.push_back(c[i]);
     db.write(hashString, dbValue, persistent);
 
+    // Record the hash, so that the Storage SM does not need to calculate it again
+    if (hashes != NULL) addHash(*hashes, dbValue, hash);
+
 #ifdef LOG_SMT
     cout << "Smt::hashSave() key=" << hashString << " value=";
     for (uint64_t i=0; i<12; i++) cout << fr.toString(dbValue[i],16) << ":";
@@ -918,6 +1081,16 @@ void Smt::hashSave ( Database &db, const Goldilocks::Element (&a)[8], const Gold
 #endif
 }
 
+// Records a node written to the database, i.e. a poseidon hash input and the output calculated for it
+void Smt::addHash ( vector< array<Goldilocks::Element, 16> > &hashes, const vector<Goldilocks::Element> &dbValue, const Goldilocks::Element (&hash)[4] )
+{
+    if (dbValue.size() < 12) return;
+    array<Goldilocks::Element, 16> entry;
+    for (uint64_t i=0; i<12; i++) entry[i] = dbValue[i];
+    for (uint64_t i=0; i<4; i++) entry[12+i] = hash[i];
+    hashes.push_back(entry);
+}
+
 int64_t Smt::getUniqueSibling(vector<Goldilocks::Element> &a)
 {
     // Search for a unique, zero field element in vector a
@@ -936,6 +1109,229 @@ int64_t Smt::getUniqueSibling(vector<Goldilocks::Element> &a)
     return -1;
 }
 
+// Returns the key bit used to navigate the tree at a level, as splitKey does
+uint64_t Smt::getKeyBit ( const Goldilocks::Element (&key)[4], uint64_t level )
+{
+    return (fr.toU64(key[level%4]) >> (level/4)) & 1;
+}
+
+// Compares the paths of 2 keys from a level down, i.e. the order of their leaves in the tree
+bool Smt::keyPathLess ( const Goldilocks::Element (&a)[4], const Goldilocks::Element (&b)[4], uint64_t level )
+{
+    for (uint64_t l=level; l<256; l++)
+    {
+        uint64_t bitA = getKeyBit(a, l);
+        uint64_t bitB = getKeyBit(b, l);
+        if (bitA != bitB) return bitA < bitB;
+    }
+    return false;
+}
+
+/*
+    Plans the new subtree of node hash, at a level, with the entries begin to end (their leaves are
+    nodes[1+begin] to nodes[1+end-1]), and returns the index of its new root node
+    - An empty subtree or a leaf is rebuilt with the set leaves, plus the existing leaf if its key is not set
+    - An intermediate node is descended on the sides with entries; the other side is left unchanged
+*/
+zkresult Smt::planBatch ( Database &db, const Goldilocks::Element (&hash)[4], uint64_t level, uint64_t begin, uint64_t end, vector<SmtBatchNode> &nodes, uint64_t &node )
+{
+    vector<uint64_t> leaves;
+
+    if (fr.isZero(hash[0]) && fr.isZero(hash[1]) && fr.isZero(hash[2]) && fr.isZero(hash[3]))
+    {
+        for (uint64_t i=begin; i<end; i++)
+        {
+            if (nodes[1 + i].type == SMT_BATCH_NODE_LEAF) leaves.push_back(1 + i);
+        }
+        node = planSubtree(leaves, 0, leaves.size(), level, nodes);
+        return ZKR_SUCCESS;
+    }
+
+    string hashString = fea2string(fr, hash);
+    vector<Goldilocks::Element> dbValue;
+    zkresult dbres = db.read(hashString, dbValue);
+    if (dbres != ZKR_SUCCESS)
+    {
+        cerr << "Error: Smt::planBatch() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") root:" << hashString << endl;
+        return dbres;
+    }
+    if (dbValue.size() < 12)
+    {
+        cerr << "Error: Smt::planBatch() dbValue.size()<12 root:" << hashString << endl;
+        return ZKR_SMT_INVALID_DATA_SIZE;
+    }
+
+    // If this is a leaf, rebuild the subtree with its leaf and the set ones
+    if (fr.equal(dbValue[8], fr.one()))
+    {
+        // Join the path to the remaining key to get the complete key of the existing leaf
+        vector<uint64_t> accKey;
+        for (uint64_t l=0; l<level; l++) accKey.push_back(getKeyBit(nodes[1 + begin].key, l));
+        Goldilocks::Element rKey[4] = {dbValue[0], dbValue[1], dbValue[2], dbValue[3]};
+        Goldilocks::Element foundKey[4];
+        joinKey(accKey, rKey, foundKey);
+
+        bool bFoundKey = false;
+        for (uint64_t i=begin; i<end; i++)
+        {
+            if (fr.equal(nodes[1 + i].key[0], foundKey[0]) && fr.equal(nodes[1 + i].key[1], foundKey[1]) && fr.equal(nodes[1 + i].key[2], foundKey[2]) && fr.equal(nodes[1 + i].key[3], foundKey[3]))
+            {
+                bFoundKey = true;
+            }
+            if (nodes[1 + i].type == SMT_BATCH_NODE_LEAF) leaves.push_back(1 + i);
+        }
+
+        // Keep the existing leaf if its key is not set, with its value hash
+        if (!bFoundKey)
+        {
+            SmtBatchNode foundLeaf;
+            foundLeaf.type = SMT_BATCH_NODE_LEAF;
+            for (uint64_t i=0; i<4; i++) foundLeaf.key[i] = foundKey[i];
+            for (uint64_t i=0; i<4; i++) foundLeaf.valueHash[i] = dbValue[4 + i];
+            nodes.push_back(foundLeaf);
+            leaves.push_back(nodes.size() - 1);
+            sort(leaves.begin(), leaves.end(), [&](uint64_t a, uint64_t b) { return keyPathLess(nodes[a].key, nodes[b].key, level); });
+        }
+
+        node = planSubtree(leaves, 0, leaves.size(), level, nodes);
+        return ZKR_SUCCESS;
+    }
+
+    // This is an intermediate node; split the entries by their key bit at this level
+    uint64_t mid = begin;
+    while ( (mid < end) && (getKeyBit(nodes[1 + mid].key, level) == 0) ) mid++;
+
+    uint64_t child[2];
+    for (uint64_t side=0; side<2; side++)
+    {
+        Goldilocks::Element childHash[4] = {dbValue[side*4], dbValue[side*4 + 1], dbValue[side*4 + 2], dbValue[side*4 + 3]};
+        uint64_t childBegin = (side == 0) ? begin : mid;
+        uint64_t childEnd = (side == 0) ? mid : end;
+        if (childBegin < childEnd)
+        {
+            zkresult zkr = planBatch(db, childHash, level + 1, childBegin, childEnd, nodes, child[side]);
+            if (zkr != ZKR_SUCCESS)
+            {
+                return zkr;
+            }
+        }
+        else if (fr.isZero(childHash[0]) && fr.isZero(childHash[1]) && fr.isZero(childHash[2]) && fr.isZero(childHash[3]))
+        {
+            child[side] = 0;
+        }
+        else
+        {
+            SmtBatchNode unchanged;
+            unchanged.type = SMT_BATCH_NODE_UNCHANGED;
+            for (uint64_t i=0; i<4; i++) unchanged.hash[i] = childHash[i];
+            nodes.push_back(unchanged);
+            child[side] = nodes.size() - 1;
+        }
+    }
+
+    return planParent(db, nodes[1 + begin].key, level, child, nodes, node);
+}
+
+// Plans a new subtree with a list of leaves sorted by path, and returns the index of its root node
+uint64_t Smt::planSubtree ( vector<uint64_t> &leaves, uint64_t begin, uint64_t end, uint64_t level, vector<SmtBatchNode> &nodes )
+{
+    if (begin == end) return 0;
+    if (end - begin == 1) return leaves[begin];
+
+    // Split the leaves by their key bit at this level; if they all go to the same side, the other one is empty
+    uint64_t mid = begin;
+    while ( (mid < end) && (getKeyBit(nodes[leaves[mid]].key, level) == 0) ) mid++;
+
+    SmtBatchNode intermediate;
+    intermediate.type = SMT_BATCH_NODE_INTERMEDIATE;
+    intermediate.child[0] = planSubtree(leaves, begin, mid, level + 1, nodes);
+    intermediate.child[1] = planSubtree(leaves, mid, end, level + 1, nodes);
+    nodes.push_back(intermediate);
+    return nodes.size() - 1;
+}
+
+/*
+    Plans the node of a level with its 2 new children, as set does:
+    - If both are empty, the node is empty
+    - If only one is not empty, and it is a leaf, the leaf moves up to this level
+    - Otherwise, it is an intermediate node
+*/
+zkresult Smt::planParent ( Database &db, const Goldilocks::Element (&prefixKey)[4], uint64_t level, uint64_t (&child)[2], vector<SmtBatchNode> &nodes, uint64_t &node )
+{
+    if ( (child[0] == 0) && (child[1] == 0) )
+    {
+        node = 0;
+        return ZKR_SUCCESS;
+    }
+
+    for (uint64_t side=0; side<2; side++)
+    {
+        if ( (child[1 - side] != 0) || (child[side] == 0) ) continue;
+
+        if (nodes[child[side]].type == SMT_BATCH_NODE_LEAF)
+        {
+            node = child[side];
+            return ZKR_SUCCESS;
+        }
+
+        // An unchanged sibling must be read to know if it is a leaf
+        if (nodes[child[side]].type == SMT_BATCH_NODE_UNCHANGED)
+        {
+            string hashString = fea2string(fr, nodes[child[side]].hash);
+            vector<Goldilocks::Element> dbValue;
+            zkresult dbres = db.read(hashString, dbValue);
+            if (dbres != ZKR_SUCCESS)
+            {
+                cerr << "Error: Smt::planParent() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") root:" << hashString << endl;
+                return dbres;
+            }
+            if (dbValue.size() < 12)
+            {
+                cerr << "Error: Smt::planParent() dbValue.size()<12 root:" << hashString << endl;
+                return ZKR_SMT_INVALID_DATA_SIZE;
+            }
+            if (fr.equal(dbValue[8], fr.one()))
+            {
+                // Join the sibling path to its remaining key to get its complete key
+                vector<uint64_t> accKey;
+                for (uint64_t l=0; l<level; l++) accKey.push_back(getKeyBit(prefixKey, l));
+                accKey.push_back(side);
+                Goldilocks::Element rKey[4] = {dbValue[0], dbValue[1], dbValue[2], dbValue[3]};
+
+                SmtBatchNode &leaf = nodes[child[side]];
+                leaf.type = SMT_BATCH_NODE_LEAF;
+                joinKey(accKey, rKey, leaf.key);
+                for (uint64_t i=0; i<4; i++) leaf.valueHash[i] = dbValue[4 + i];
+                node = child[side];
+                return ZKR_SUCCESS;
+            }
+        }
+    }
+
+    SmtBatchNode intermediate;
+    intermediate.type = SMT_BATCH_NODE_INTERMEDIATE;
+    intermediate.child[0] = child[0];
+    intermediate.child[1] = child[1];
+    nodes.push_back(intermediate);
+    node = nodes.size() - 1;
+    return ZKR_SUCCESS;
+}
+
+// Adds the new nodes of a planned subtree to the list of nodes of every level
+void Smt::collectBatch ( vector<SmtBatchNode> &nodes, uint64_t node, uint64_t level, vector< vector<uint64_t> > &levels )
+{
+    if ( (nodes[node].type != SMT_BATCH_NODE_LEAF) && (nodes[node].type != SMT_BATCH_NODE_INTERMEDIATE) ) return;
+
+    if (levels.size() <= level) levels.resize(level + 1);
+    levels[level].push_back(node);
+
+    if (nodes[node].type == SMT_BATCH_NODE_INTERMEDIATE)
+    {
+        collectBatch(nodes, nodes[node].child[0], level + 1, levels);
+        collectBatch(nodes, nodes[node].child[1], level + 1, levels);
+    }
+}
+
 string SmtSetResult::toString (Goldilocks &fr)
 {
     string result;
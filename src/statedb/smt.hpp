@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <map>
+#include <array>
 #include <gmpxx.h>
 
 #include "poseidon_goldilocks.hpp"
@@ -28,6 +29,9 @@ public:
     mpz_class newValue;
     string mode;
     uint64_t proofHashCounter;
+    bool bHashes; // If true, set() records in hashes the nodes it saves; only needed by the Storage SM
+    vector< array<Goldilocks::Element, 16> > hashes; // Nodes saved, in order, as poseidon input (12) + calculated hash (4)
+    SmtSetResult() : bHashes(false) {};
     string toString (Goldilocks &fr);
 };
 
@@ -46,20 +50,56 @@ public:
     string toString (Goldilocks &fr);
 };
 
+// SMT setBatch method entry: a key and its new value; a zero value deletes the key
+class SmtBatchEntry
+{
+public:
+    Goldilocks::Element key[4];
+    mpz_class value;
+};
+
+#define SMT_BATCH_NODE_EMPTY 0
+#define SMT_BATCH_NODE_UNCHANGED 1
+#define SMT_BATCH_NODE_LEAF 2
+#define SMT_BATCH_NODE_INTERMEDIATE 3
+
+// Node of the new tree planned by setBatch, before it is hashed and saved
+class SmtBatchNode
+{
+public:
+    uint64_t type; // SMT_BATCH_NODE_*
+    Goldilocks::Element hash[4]; // Existing hash if unchanged, computed hash if leaf or intermediate
+    Goldilocks::Element key[4]; // Leaf: complete key
+    Goldilocks::Element valueHash[4]; // Leaf: hash of the value node
+    uint64_t child[2]; // Intermediate: indexes of the children nodes
+    Goldilocks::Element data[12]; // Leaf or intermediate: node content, as saved in the database
+    SmtBatchNode() : type(SMT_BATCH_NODE_EMPTY), child{0, 0} { for (uint64_t i=0; i<4; i++) hash[i] = Goldilocks::zero(); };
+};
+
 // SMT class
 class Smt
 {
 private:
     Goldilocks  &fr;
     PoseidonGoldilocks poseidon;
+
+    // setBatch helpers
+    uint64_t getKeyBit ( const Goldilocks::Element (&key)[4], uint64_t level );
+    bool keyPathLess ( const Goldilocks::Element (&a)[4], const Goldilocks::Element (&b)[4], uint64_t level );
+    zkresult planBatch ( Database &db, const Goldilocks::Element (&hash)[4], uint64_t level, uint64_t begin, uint64_t end, vector<SmtBatchNode> &nodes, uint64_t &node );
+    uint64_t planSubtree ( vector<uint64_t> &leaves, uint64_t begin, uint64_t end, uint64_t level, vector<SmtBatchNode> &nodes );
+    zkresult planParent ( Database &db, const Goldilocks::Element (&prefixKey)[4], uint64_t level, uint64_t (&child)[2], vector<SmtBatchNode> &nodes, uint64_t &node );
+    void collectBatch ( vector<SmtBatchNode> &nodes, uint64_t node, uint64_t level, vector< vector<uint64_t> > &levels );
+    void addHash ( vector< array<Goldilocks::Element, 16> > &hashes, const vector<Goldilocks::Element> &dbValue, const Goldilocks::Element (&hash)[4] );
 public:
     Smt(Goldilocks &fr) : fr(fr) {}
     zkresult set ( Database &db, const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const bool persistent, SmtSetResult &result );
+    zkresult setBatch ( Database &db, const Goldilocks::Element (&oldRoot)[4], const vector<SmtBatchEntry> &entries, const bool persistent, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> *results = NULL );
     zkresult get ( Database &db, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], SmtGetResult &result );
     void splitKey ( const Goldilocks::Element (&key)[4], vector<uint64_t> &result);
     void joinKey ( const vector<uint64_t> &bits, const Goldilocks::Element (&rkey)[4], Goldilocks::Element (&key)[4] );
     void removeKeyBits ( const Goldilocks::Element (&key)[4], uint64_t nBits, Goldilocks::Element (&rkey)[4]);
-    void hashSave ( Database &db, const Goldilocks::Element (&a)[8], const Goldilocks::Element (&c)[4], const bool persistent, Goldilocks::Element (&hash)[4]);
+    void hashSave ( Database &db, const Goldilocks::Element (&a)[8], const Goldilocks::Element (&c)[4], const bool persistent, Goldilocks::Element (&hash)[4], vector< array<Goldilocks::Element, 16> > *hashes = NULL );
     int64_t getUniqueSibling(vector<Goldilocks::Element> &a);
 };
 
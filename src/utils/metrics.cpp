@@ -0,0 +1,231 @@
+#include <sstream>
+#include "metrics.hpp"
+#include "timer.hpp"
+
+Metrics metrics;
+
+void MetricsHistogram::add (uint64_t value)
+{
+    count++;
+    sum += value;
+    if (value > max) max = value;
+
+    // Find the first bucket whose upper bound (4^i) is not lower than value
+    uint64_t i = 0;
+    uint64_t bound = 1;
+    while ((i < METRICS_HISTOGRAM_BUCKETS - 1) && (value > bound))
+    {
+        i++;
+        bound <<= 2;
+    }
+    buckets[i]++;
+}
+
+void MetricsHistogram::merge (const MetricsHistogram &other)
+{
+    count += other.count;
+    sum += other.sum;
+    if (other.max > max) max = other.max;
+    for (uint64_t i=0; i<METRICS_HISTOGRAM_BUCKETS; i++) buckets[i] += other.buckets[i];
+}
+
+// Adds the counters, histograms and spans of a thread data into another one
+static void mergeThreadData (MetricsThreadData &to, const MetricsThreadData &from)
+{
+    for (map<string, uint64_t>::const_iterator it=from.counters.begin(); it!=from.counters.end(); it++)
+    {
+        to.counters[it->first] += it->second;
+    }
+    for (map<string, MetricsHistogram>::const_iterator it=from.histograms.begin(); it!=from.histograms.end(); it++)
+    {
+        to.histograms[it->first].merge(it->second);
+    }
+    for (map<string, MetricsHistogram>::const_iterator it=from.spans.begin(); it!=from.spans.end(); it++)
+    {
+        to.spans[it->first].merge(it->second);
+    }
+}
+
+// Registers the data of a thread when created, and retires it when the thread ends
+class MetricsThreadLocal
+{
+public:
+    MetricsThreadData data;
+    MetricsThreadLocal() { metrics.registerThread(&data); };
+    ~MetricsThreadLocal() { metrics.unregisterThread(&data); };
+};
+
+Metrics::Metrics()
+{
+    pthread_mutex_init(&mutex, NULL);
+    gettimeofday(&startTime, NULL);
+}
+
+Metrics::~Metrics()
+{
+    pthread_mutex_destroy(&mutex);
+}
+
+MetricsThreadData & Metrics::threadData (void)
+{
+    static thread_local MetricsThreadLocal local;
+    return local.data;
+}
+
+void Metrics::registerThread (MetricsThreadData * pData)
+{
+    pthread_mutex_lock(&mutex);
+    threads.insert(pData);
+    pthread_mutex_unlock(&mutex);
+}
+
+void Metrics::unregisterThread (MetricsThreadData * pData)
+{
+    pthread_mutex_lock(&mutex);
+    pthread_mutex_lock(&pData->mutex);
+    mergeThreadData(retired, *pData);
+    pthread_mutex_unlock(&pData->mutex);
+    threads.erase(pData);
+    pthread_mutex_unlock(&mutex);
+}
+
+void Metrics::spanStart (const char * name)
+{
+    MetricsThreadData &data = threadData();
+
+    // If this span was started before and never stopped, abandon it
+    for (uint64_t i=0; i<data.openSpans.size(); i++)
+    {
+        if (data.openSpans[i].name == name)
+        {
+            data.openSpans.resize(i);
+            break;
+        }
+    }
+
+    const string &parentPath = (data.openSpans.size() == 0) ? data.basePath : data.openSpans.back().path;
+
+    MetricsSpan span;
+    span.name = name;
+    span.path = (parentPath.size() == 0) ? span.name : parentPath + "/" + span.name;
+    gettimeofday(&span.start, NULL);
+    data.openSpans.push_back(span);
+}
+
+uint64_t Metrics::spanStop (const char * name)
+{
+    MetricsThreadData &data = threadData();
+
+    // Find the span, starting from the innermost one; the spans opened inside it and never stopped are abandoned
+    for (int64_t i=data.openSpans.size()-1; i>=0; i--)
+    {
+        if (data.openSpans[i].name == name)
+        {
+            uint64_t duration = TimeDiff(data.openSpans[i].start);
+            pthread_mutex_lock(&data.mutex);
+            data.spans[data.openSpans[i].path].add(duration);
+            pthread_mutex_unlock(&data.mutex);
+            data.openSpans.resize(i);
+            return duration;
+        }
+    }
+
+    // The span was not started by this thread
+    return 0;
+}
+
+string Metrics::getSpanPath (void)
+{
+    MetricsThreadData &data = threadData();
+    return (data.openSpans.size() == 0) ? data.basePath : data.openSpans.back().path;
+}
+
+void Metrics::setSpanPath (const string &path)
+{
+    MetricsThreadData &data = threadData();
+    data.openSpans.clear();
+    data.basePath = path;
+}
+
+void Metrics::counterAdd (const char * name, uint64_t value)
+{
+    MetricsThreadData &data = threadData();
+    pthread_mutex_lock(&data.mutex);
+    data.counters[name] += value;
+    pthread_mutex_unlock(&data.mutex);
+}
+
+void Metrics::histogramAdd (const char * name, uint64_t value)
+{
+    MetricsThreadData &data = threadData();
+    pthread_mutex_lock(&data.mutex);
+    data.histograms[name].add(value);
+    pthread_mutex_unlock(&data.mutex);
+}
+
+void Metrics::snapshot (MetricsThreadData &result)
+{
+    pthread_mutex_lock(&mutex);
+    mergeThreadData(result, retired);
+    for (set<MetricsThreadData *>::iterator it=threads.begin(); it!=threads.end(); it++)
+    {
+        pthread_mutex_lock(&(*it)->mutex);
+        mergeThreadData(result, **it);
+        pthread_mutex_unlock(&(*it)->mutex);
+    }
+    pthread_mutex_unlock(&mutex);
+}
+
+// Writes a histogram as a Prometheus histogram, plus a gauge with its maximum value
+static void histogramToText (stringstream &ss, const string &family, const string &label, const map<string, MetricsHistogram> &histograms)
+{
+    if (histograms.size() == 0) return;
+
+    ss << "# TYPE " << family << " histogram\n";
+    for (map<string, MetricsHistogram>::const_iterator it=histograms.begin(); it!=histograms.end(); it++)
+    {
+        uint64_t accumulated = 0;
+        uint64_t bound = 1;
+        for (uint64_t i=0; i<METRICS_HISTOGRAM_BUCKETS; i++)
+        {
+            accumulated += it->second.buckets[i];
+            ss << family << "_bucket{" << label << "=\"" << it->first << "\",le=\"";
+            if (i < METRICS_HISTOGRAM_BUCKETS - 1) ss << bound; else ss << "+Inf";
+            ss << "\"} " << accumulated << "\n";
+            bound <<= 2;
+        }
+        ss << family << "_sum{" << label << "=\"" << it->first << "\"} " << it->second.sum << "\n";
+        ss << family << "_count{" << label << "=\"" << it->first << "\"} " << it->second.count << "\n";
+    }
+
+    ss << "# TYPE " << family << "_max gauge\n";
+    for (map<string, MetricsHistogram>::const_iterator it=histograms.begin(); it!=histograms.end(); it++)
+    {
+        ss << family << "_max{" << label << "=\"" << it->first << "\"} " << it->second.max << "\n";
+    }
+}
+
+string Metrics::toText (void)
+{
+    MetricsThreadData data;
+    snapshot(data);
+
+    stringstream ss;
+    ss << "# TYPE zkprover_uptime_seconds gauge\n";
+    ss << "zkprover_uptime_seconds " << TimeDiff(startTime)/1000000 << "\n";
+
+    histogramToText(ss, "zkprover_span_duration_us", "span", data.spans);
+
+    if (data.counters.size() > 0)
+    {
+        ss << "# TYPE zkprover_counter counter\n";
+        for (map<string, uint64_t>::const_iterator it=data.counters.begin(); it!=data.counters.end(); it++)
+        {
+            ss << "zkprover_counter{name=\"" << it->first << "\"} " << it->second << "\n";
+        }
+    }
+
+    histogramToText(ss, "zkprover_histogram", "name", data.histograms);
+
+    return ss.str();
+}
@@ -0,0 +1,98 @@
+#ifndef METRICS_HPP
+#define METRICS_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <pthread.h>
+#include <sys/time.h>
+
+using namespace std;
+
+/*
+    Metrics registry, always enabled, used to measure the prover in production
+
+    - Spans measure the duration of a code section; they are nested per thread, so every span is
+      identified by its path, e.g. PROVER_PROVE/EXECUTOR_EXECUTE/MAIN_EXECUTOR_EXECUTE, and its
+      durations are accumulated in a histogram; TimerStart() and TimerStopAndLog() open and close spans
+    - Counters accumulate values, e.g. the total time spent in Poseidon hashes
+    - Histograms accumulate the distribution of a value, e.g. the duration of every SMT set
+
+    Every thread accumulates its own data, so that recording a value does not contend with other
+    threads; the data of all threads is aggregated only when exported
+*/
+
+// Histogram buckets upper bounds are powers of 4: 1, 4, 16, ... 4^(N-2), plus infinite
+#define METRICS_HISTOGRAM_BUCKETS 17
+
+class MetricsHistogram
+{
+public:
+    uint64_t count;
+    uint64_t sum;
+    uint64_t max;
+    uint64_t buckets[METRICS_HISTOGRAM_BUCKETS];
+
+    MetricsHistogram() : count(0), sum(0), max(0) { for (uint64_t i=0; i<METRICS_HISTOGRAM_BUCKETS; i++) buckets[i] = 0; };
+    void add (uint64_t value);
+    void merge (const MetricsHistogram &other);
+};
+
+class MetricsSpan
+{
+public:
+    string name;
+    string path;
+    struct timeval start;
+};
+
+class MetricsThreadData
+{
+public:
+    pthread_mutex_t mutex; // Only contended when the registry is exported
+    map<string, uint64_t> counters;
+    map<string, MetricsHistogram> histograms;
+    map<string, MetricsHistogram> spans;
+    vector<MetricsSpan> openSpans; // Stack of spans started and not yet stopped by this thread
+    string basePath; // Path of the parent span, if adopted from another thread
+
+    MetricsThreadData() { pthread_mutex_init(&mutex, NULL); };
+    ~MetricsThreadData() { pthread_mutex_destroy(&mutex); };
+};
+
+class Metrics
+{
+private:
+    pthread_mutex_t mutex;
+    set<MetricsThreadData *> threads; // Data of the live threads
+    MetricsThreadData retired; // Accumulated data of the finished threads
+    struct timeval startTime;
+
+    MetricsThreadData & threadData (void);
+
+public:
+    Metrics();
+    ~Metrics();
+
+    // Spans
+    void spanStart (const char * name); // Starting a span that is already open abandons it and its children
+    uint64_t spanStop (const char * name); // Returns the span duration in us
+    string getSpanPath (void); // Path of the current span of the calling thread
+    void setSpanPath (const string &path); // Makes the spans of the calling thread children of path
+
+    // Counters and histograms
+    void counterAdd (const char * name, uint64_t value);
+    void histogramAdd (const char * name, uint64_t value);
+
+    // Export
+    void registerThread (MetricsThreadData * pData);
+    void unregisterThread (MetricsThreadData * pData);
+    void snapshot (MetricsThreadData &result);
+    string toText (void); // Prometheus text exposition format
+};
+
+extern Metrics metrics;
+
+#endif
@@ -172,6 +172,41 @@ void string2fe (Goldilocks &fr, const string &s, Goldilocks::Element &fe)
     fr.fromString(fe, Remove0xIfPresent(s), 16);
 }
 
+void string2fea (Goldilocks &fr, const string &s, vector<Goldilocks::Element> &fea)
+{
+    if (s.size()%16 != 0)
+    {
+        cerr << "Error: string2fea() called with an invalid string size: " << s.size() << endl;
+        exitProcess();
+    }
+    fea.resize(s.size()/16);
+    const char *p = s.c_str();
+    for (uint64_t i=0; i<fea.size(); i++)
+    {
+        uint64_t value = 0;
+        for (uint64_t j=0; j<16; j++)
+        {
+            value = (value << 4) | char2byte(p[16*i + j]);
+        }
+        fea[i] = fr.fromU64(value);
+    }
+}
+
+void string2scalar (const string &s, mpz_class &scalar)
+{
+    uint64_t position = (s.compare(0, 2, "0x") == 0) ? 2 : 0;
+    if (position == s.size())
+    {
+        scalar = 0;
+        return;
+    }
+    if (mpz_set_str(scalar.get_mpz_t(), s.c_str() + position, 16) != 0)
+    {
+        cerr << "Error: string2scalar() called with an invalid hexa string: " << s << endl;
+        exitProcess();
+    }
+}
+
 string fea2string (Goldilocks &fr, const Goldilocks::Element(&fea)[4])
 {
     mpz_class auxScalar;
@@ -363,6 +398,13 @@ void string2ba (const string &textString, string &baString)
     }
 }
 
+void string2ba (const string &textString, vector<uint8_t> &data)
+{
+    uint64_t dataSize = (textString.size() + 1)/2;
+    data.resize(dataSize);
+    data.resize(string2ba(textString, data.data(), dataSize));
+}
+
 string string2ba(const string &textString)
 {
     string result;
@@ -406,12 +448,7 @@ void ba2u16(const uint8_t *pData, uint16_t &n)
 
 void ba2scalar(const uint8_t *pData, uint64_t dataSize, mpz_class &s)
 {
-    s = 0;
-    for (uint64_t i=0; i<dataSize; i++)
-    {
-        s *= 256;
-        s += pData[i];
-    }
+    mpz_import(s.get_mpz_t(), dataSize, 1, 1, 0, 0, pData);
 }
 
 void scalar2ba(uint8_t *pData, uint64_t &dataSize, mpz_class s)
@@ -474,6 +511,19 @@ void scalar2bytes(mpz_class &s, uint8_t (&bytes)[32])
     }
 }
 
+void scalar2bytesBE(const mpz_class &s, uint8_t *pData, uint64_t dataSize)
+{
+    uint64_t size = (mpz_sizeinbase(s.get_mpz_t(), 2) + 7) / 8;
+    if ((s < 0) || (size > dataSize))
+    {
+        cerr << "Error: scalar2bytesBE() run out of buffer of " << dataSize << " bytes" << endl;
+        exitProcess();
+    }
+    memset(pData, 0, dataSize);
+    size_t written = 0;
+    mpz_export(pData + dataSize - size, &written, 1, 1, 0, 0, s.get_mpz_t());
+}
+
 void scalar2bits(mpz_class s, vector<uint8_t> &bits)
 {
     while (s > 0)
@@ -574,12 +624,22 @@ mpz_class TwoTo256("100000000000000000000000000000000000000000000000000000000000
 mpz_class TwoTo255("8000000000000000000000000000000000000000000000000000000000000000", 16);
 mpz_class TwoTo258("40000000000000000000000000000000000000000000000000000000000000000", 16);
 mpz_class One("1", 16);
+mpz_class FecP("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F", 16);
+mpz_class FecHalfP("7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFE17", 16);
 
 void fec2scalar (RawFec &fec, const RawFec::Element &fe, mpz_class &s)
 {
-    s.set_str(fec.toString(fe,16),16);
+    fec.toMpz(s.get_mpz_t(), fe);
 }
 void scalar2fec (RawFec &fec, RawFec::Element &fe, const mpz_class &s)
 {
+    // fromMpz() expects a value in [0, p), so reduce it as fromString() does
+    if ((s < 0) || (s >= FecP))
+    {
+        mpz_class r;
+        mpz_fdiv_r(r.get_mpz_t(), s.get_mpz_t(), FecP.get_mpz_t());
+        fec.fromMpz(fe, r.get_mpz_t());
+        return;
+    }
     fec.fromMpz(fe, s.get_mpz_t());
 }
\ No newline at end of file
@@ -27,6 +27,12 @@ void scalar2key (Goldilocks &fr, mpz_class &s, Goldilocks::Element (&key)[4]);
 
 // Converts an hexa string to a field element
 void string2fe  (Goldilocks &fr, const string &s, Goldilocks::Element &fe);
+
+// Converts an hexa string of concatenated 16-chars field elements to a field element array
+void string2fea (Goldilocks &fr, const string &s, vector<Goldilocks::Element> &fea);
+
+// Converts an hexa string, with or without a leading "0x", to a scalar; an empty string is zero
+void string2scalar (const string &s, mpz_class &scalar);
 string fea2string (Goldilocks &fr, const Goldilocks::Element(&fea)[4]);
 string fea2string (Goldilocks &fr, const Goldilocks::Element &fea0, const Goldilocks::Element &fea1, const Goldilocks::Element &fea2, const Goldilocks::Element &fea3);
 
@@ -50,6 +56,7 @@ string keccak256 (const string &inputString);
    pData buffer must be big enough to store converted data */
 uint64_t string2ba (const string &s, uint8_t *pData, uint64_t &dataSize);
 void string2ba (const string &textString, string &baString);
+void string2ba (const string &textString, vector<uint8_t> &data);
 string string2ba(const string &textString);
 
 void ba2string (string &s, const uint8_t *pData, uint64_t dataSize);
@@ -72,6 +79,9 @@ void scalar2ba(uint8_t *pData, uint64_t &dataSize, mpz_class s);
 void scalar2ba16(uint64_t *pData, uint64_t &dataSize, mpz_class s);
 void scalar2bytes(mpz_class &s, uint8_t (&bytes)[32]);
 
+// Converts a scalar to a big endian byte array of exactly dataSize bytes, left padded with zeros
+void scalar2bytesBE(const mpz_class &s, uint8_t *pData, uint64_t dataSize);
+
 // Converts a scalar to a vector of bits of the scalar, with value 1 or 0; bits[0] is least significant bit
 void scalar2bits(mpz_class s, vector<uint8_t> &bits);
 
@@ -122,6 +132,8 @@ extern mpz_class TwoTo256;
 extern mpz_class TwoTo255;
 extern mpz_class TwoTo258;
 extern mpz_class One;
+extern mpz_class FecP; // Prime of the secp256k1 base field, i.e. of RawFec
+extern mpz_class FecHalfP; // (FecP-1)/2
 
 void fec2scalar(RawFec &fec, const RawFec::Element &fe, mpz_class &s);
 void scalar2fec(RawFec &fec, RawFec::Element &fe, const mpz_class &s);
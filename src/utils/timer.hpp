@@ -4,21 +4,24 @@
 #include <cstdint>
 #include <sys/time.h>
 #include "definitions.hpp"
+#include "metrics.hpp"
 
 // Returns the time difference in us
 uint64_t TimeDiff(const struct timeval &startTime, const struct timeval &endTime);
 uint64_t TimeDiff(const struct timeval &startTime); // End time is now
 
+// Timers are metrics spans, so their durations are always accumulated in the metrics registry,
+// and they are also logged if LOG_TIME is defined
 #ifdef LOG_TIME
-#define TimerStart(name) cout << "--> " + string(#name) + " starting..." << endl; struct timeval name##_start; gettimeofday(&name##_start,NULL)
-#define TimerStop(name) cout << "<-- " + string(#name) + " done" << endl; struct timeval name##_stop; gettimeofday(&name##_stop,NULL)
-#define TimerLog(name) cout << "" + string(#name) + ": " << double(TimeDiff(name##_start,name##_stop))/1000000 << " s" << endl
-#define TimerStopAndLog(name) cout << "<-- " + string(#name) + " done: " << double(TimeDiff(name##_start))/1000000 << " s" << endl
+#define TimerStart(name) cout << "--> " + string(#name) + " starting..." << endl; metrics.spanStart(#name)
+#define TimerStop(name) uint64_t name##_duration = metrics.spanStop(#name); cout << "<-- " + string(#name) + " done" << endl
+#define TimerLog(name) cout << "" + string(#name) + ": " << double(name##_duration)/1000000 << " s" << endl
+#define TimerStopAndLog(name) cout << "<-- " + string(#name) + " done: " << double(metrics.spanStop(#name))/1000000 << " s" << endl
 #else
-#define TimerStart(name)
-#define TimerStop(name)
+#define TimerStart(name) metrics.spanStart(#name)
+#define TimerStop(name) metrics.spanStop(#name)
 #define TimerLog(name)
-#define TimerStopAndLog(name)
+#define TimerStopAndLog(name) metrics.spanStop(#name)
 #endif
 
 #endif
\ No newline at end of file
@@ -7,6 +7,10 @@
 #include <fcntl.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <errno.h>
+#include <sys/file.h>
+#include <sys/vfs.h>
+#include <linux/magic.h>
 #include "utils.hpp"
 #include "scalar.hpp"
 #include <openssl/md5.h>
@@ -284,8 +288,33 @@ void json2file(const json &j, const string &fileName)
     outputStream.close();
 }
 
+void json2cborfile(const json &j, const string &fileName)
+{
+    ofstream outputStream(fileName, ios::binary);
+    if (!outputStream.good())
+    {
+        cerr << "Error: json2cborfile() failed creating output CBOR file " << fileName << endl;
+        exitProcess();
+    }
+    json::to_cbor(j, outputStream);
+    outputStream.close();
+}
+
 void file2json(const string &fileName, json &j)
 {
+    if ((fileName.size() >= 5) && (fileName.substr(fileName.size() - 5) == ".cbor"))
+    {
+        std::ifstream inputStream(fileName, ios::binary);
+        if (!inputStream.good())
+        {
+            cerr << "Error: file2json() failed loading input CBOR file " << fileName << endl;
+            exitProcess();
+        }
+        j = json::from_cbor(inputStream);
+        inputStream.close();
+        return;
+    }
+
     std::ifstream inputStream(fileName);
     if (!inputStream.good())
     {
@@ -367,8 +396,15 @@ void * mapFileInternal (const string &fileName, uint64_t size, bool bOutput, boo
         exitProcess();
     }
 
-    // Copy file contents into memory
-    memcpy(pMemAddress, pAddress, size);
+    // Copy file contents into memory, in parallel
+    uint64_t chunkSize = 64*1024*1024;
+    uint64_t nChunks = (size + chunkSize - 1) / chunkSize;
+#pragma omp parallel for
+    for (uint64_t i=0; i<nChunks; i++)
+    {
+        uint64_t offset = i*chunkSize;
+        memcpy((uint8_t *)pMemAddress + offset, (uint8_t *)pAddress + offset, zkmin(chunkSize, size - offset));
+    }
 
     // Unmap file content from memory
     unmapFile(pAddress, size);
@@ -394,4 +430,172 @@ void unmapFile (void * pAddress, uint64_t size)
         cerr << "Error: unmapFile() failed calling munmap() of address=" << pAddress << " size=" << size << endl;
         exitProcess();
     }
-}
\ No newline at end of file
+}
+#define SHARED_FILE_MAGIC 0x4D454853564F525A // "ZROVSHEM"
+#define HUGE_PAGE_SIZE (2*1024*1024)
+
+// Written after the content once it is fully loaded; identifies the source file, so that a segment
+// loaded from a previous version of the file is detected and replaced instead of reused
+struct SharedFileTrailer
+{
+    uint64_t magic;
+    uint64_t fileSize;
+    int64_t fileMtimeSec;
+    int64_t fileMtimeNsec;
+};
+
+// Size of the mapped segment: content plus trailer, rounded to the (huge) page size
+uint64_t sharedFileMappedSize (uint64_t size, bool bHugePages)
+{
+    uint64_t pageSize = bHugePages ? HUGE_PAGE_SIZE : sysconf(_SC_PAGESIZE);
+    return ((size + sizeof(SharedFileTrailer) + pageSize - 1) / pageSize) * pageSize;
+}
+
+void checkSharedFileHugePages (int fd, const string &hugePagesPath)
+{
+    struct statfs sfs;
+    if ((fstatfs(fd, &sfs) != 0) || (sfs.f_type != HUGETLBFS_MAGIC))
+    {
+        cerr << "Error: mapSharedFile() found hugePagesPath=" << hugePagesPath << " is not a hugetlbfs mount point" << endl;
+        exitProcess();
+    }
+}
+
+void * mapSharedFile (const string &fileName, uint64_t size, const string &segmentName, const string &hugePagesPath)
+{
+    bool bHugePages = (hugePagesPath.size() > 0);
+    string segmentFileName = (bHugePages ? hugePagesPath : string("/dev/shm")) + "/" + segmentName;
+    uint64_t mappedSize = sharedFileMappedSize(size, bHugePages);
+
+    struct stat fileStat;
+    if ((stat(fileName.c_str(), &fileStat) != 0) || ((uint64_t)fileStat.st_size != size))
+    {
+        cerr << "Error: mapSharedFile() found size of file " << fileName << " to be " << fileStat.st_size << " B instead of " << size << " B" << endl;
+        exitProcess();
+    }
+    SharedFileTrailer trailer;
+    memset(&trailer, 0, sizeof(trailer));
+    trailer.magic = SHARED_FILE_MAGIC;
+    trailer.fileSize = size;
+    trailer.fileMtimeSec = fileStat.st_mtim.tv_sec;
+    trailer.fileMtimeNsec = fileStat.st_mtim.tv_nsec;
+
+    // Segments only get their final name once fully loaded, so an existing one can be attached to
+    // right away, provided that it was loaded from the current version of the file
+    void * pAddress;
+    int fd = open(segmentFileName.c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+        if (bHugePages) checkSharedFileHugePages(fd, hugePagesPath);
+        struct stat sb;
+        if ((fstat(fd, &sb) == 0) && ((uint64_t)sb.st_size == mappedSize))
+        {
+            pAddress = mmap(NULL, mappedSize, PROT_READ, MAP_SHARED|MAP_POPULATE, fd, 0);
+            if (pAddress == MAP_FAILED)
+            {
+                cerr << "Error: mapSharedFile() failed calling mmap() of segment: " << segmentFileName << endl;
+                exitProcess();
+            }
+            if (memcmp((uint8_t *)pAddress + size, &trailer, sizeof(trailer)) == 0)
+            {
+                madvise(pAddress, mappedSize, MADV_WILLNEED);
+                close(fd);
+                return pAddress;
+            }
+            munmap(pAddress, mappedSize);
+        }
+        close(fd);
+
+        // Never unlink it by name, since another process may have just published a valid segment
+        // under it; the fresh copy loaded below atomically replaces whatever is there instead
+        cout << "mapSharedFile() found segment " << segmentFileName << " does not match file " << fileName << "; replacing it" << endl;
+    }
+    else if (errno != ENOENT)
+    {
+        cerr << "Error: mapSharedFile() failed opening segment: " << segmentFileName << " errno=" << errno << endl;
+        exitProcess();
+    }
+
+    // Create and load the segment under a name private to this process
+    string tmpFileName = segmentFileName + "." + to_string(getpid()) + ".tmp";
+    unlink(tmpFileName.c_str());
+    fd = open(tmpFileName.c_str(), O_CREAT|O_EXCL|O_RDWR, 0644);
+    if (fd < 0)
+    {
+        cerr << "Error: mapSharedFile() failed creating segment: " << tmpFileName << " errno=" << errno << endl;
+        exitProcess();
+    }
+    if (bHugePages) checkSharedFileHugePages(fd, hugePagesPath);
+    if (ftruncate(fd, mappedSize) != 0)
+    {
+        cerr << "Error: mapSharedFile() failed calling ftruncate() of segment: " << tmpFileName << " size=" << mappedSize << endl;
+        unlink(tmpFileName.c_str());
+        exitProcess();
+    }
+    pAddress = mmap(NULL, mappedSize, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE, fd, 0);
+    if (pAddress == MAP_FAILED)
+    {
+        cerr << "Error: mapSharedFile() failed calling mmap() of segment: " << tmpFileName << endl;
+        unlink(tmpFileName.c_str());
+        exitProcess();
+    }
+    if (!bHugePages) madvise(pAddress, mappedSize, MADV_HUGEPAGE);
+
+    // Load the file content in parallel
+    int fileFd = open(fileName.c_str(), O_RDONLY);
+    if (fileFd < 0)
+    {
+        cerr << "Error: mapSharedFile() failed opening file: " << fileName << endl;
+        unlink(tmpFileName.c_str());
+        exitProcess();
+    }
+    uint64_t chunkSize = 64*1024*1024;
+    uint64_t nChunks = (size + chunkSize - 1) / chunkSize;
+    bool bFailed = false;
+#pragma omp parallel for reduction(||:bFailed)
+    for (uint64_t i=0; i<nChunks; i++)
+    {
+        uint64_t offset = i*chunkSize;
+        uint64_t pending = zkmin(chunkSize, size - offset);
+        while (pending > 0)
+        {
+            ssize_t n = pread(fileFd, (uint8_t *)pAddress + offset, pending, offset);
+            if (n <= 0)
+            {
+                bFailed = true;
+                break;
+            }
+            offset += n;
+            pending -= n;
+        }
+    }
+    close(fileFd);
+    if (bFailed)
+    {
+        cerr << "Error: mapSharedFile() failed reading file: " << fileName << endl;
+        unlink(tmpFileName.c_str());
+        exitProcess();
+    }
+    memcpy((uint8_t *)pAddress + size, &trailer, sizeof(trailer));
+
+    // Publish the complete segment; rename() atomically replaces a stale segment, or a valid copy
+    // that another process published meanwhile, so the name always refers to a complete segment.
+    // Processes still using the replaced segment keep their mapping until they unmap it
+    if (rename(tmpFileName.c_str(), segmentFileName.c_str()) != 0)
+    {
+        cerr << "Error: mapSharedFile() failed calling rename() of segment: " << tmpFileName << " to " << segmentFileName << " errno=" << errno << endl;
+        unlink(tmpFileName.c_str());
+        exitProcess();
+    }
+    close(fd);
+
+    // Make it read-only for this process too
+    mprotect(pAddress, mappedSize, PROT_READ);
+
+    return pAddress;
+}
+
+void unmapSharedFile (void * pAddress, uint64_t size, const string &hugePagesPath)
+{
+    unmapFile(pAddress, sharedFileMappedSize(size, hugePagesPath.size() > 0));
+}
@@ -50,7 +50,8 @@ string getUUID (void);
 
 // Converts a json into/from a file
 void json2file(const json &j, const string &fileName);
-void file2json(const string &fileName, json &j);
+void json2cborfile(const json &j, const string &fileName);
+void file2json(const string &fileName, json &j); // Files ending in .cbor are parsed as CBOR
 
 // Maps memory into a file
 void * mapFile (const string &fileName, uint64_t size, bool bOutput);
@@ -59,5 +60,13 @@ void unmapFile (void * pAddress, uint64_t size);
 // Copies file content into memory; use free after use
 void * copyFile (const string &fileName, uint64_t size);
 
+// Maps a named shared memory segment holding the file content, read-only; the first process creates
+// and loads it, the rest attach to it. If hugePagesPath is not empty, the segment is created in that
+// hugetlbfs mount point instead of in /dev/shm. Use unmapSharedFile after use; the segment persists
+// until it is explicitly removed, so that later processes do not need to load the file again, and it
+// is replaced if the file size or modification time change
+void * mapSharedFile (const string &fileName, uint64_t size, const string &segmentName, const string &hugePagesPath);
+void unmapSharedFile (void * pAddress, uint64_t size, const string &hugePagesPath);
+
 
 #endif
\ No newline at end of file
@@ -1,6 +1,10 @@
 
 #include <nlohmann/json.hpp>
+#include <thread>
+#include <algorithm>
+#include <sys/time.h>
 #include "executor_client.hpp"
+#include "timer.hpp"
 
 using namespace std;
 using json = nlohmann::json;
@@ -26,17 +30,13 @@ void ExecutorClient::waitForThread (void)
     pthread_join(t, NULL);
 }
 
-bool ExecutorClient::ProcessBatch (void)
+void ExecutorClient::buildProcessBatchRequest (::executor::v1::ProcessBatchRequest &request)
 {
-    TimerStart(EXECUTOR_CLIENT_PROCESS_BATCH);
-
     if (config.inputFile.size() == 0)
     {
-        cerr << "Error: ExecutorClient::ProcessBatch() found config.inputFile empty" << endl;
+        cerr << "Error: ExecutorClient::buildProcessBatchRequest() found config.inputFile empty" << endl;
         exit(-1);
     }
-    ::grpc::ClientContext context;
-    ::executor::v1::ProcessBatchRequest request;
     Input input(fr);
     json inputJson;
     file2json(config.inputFile, inputJson);
@@ -46,11 +46,15 @@ bool ExecutorClient::ProcessBatch (void)
     bool update_merkle_tree = true;
 
     request.set_batch_num(input.publicInputs.batchNum);
-    request.set_coinbase(input.publicInputs.sequencerAddr);
-    request.set_batch_l2_data(string2ba(input.batchL2Data));
-    request.set_old_state_root(string2ba(input.publicInputs.oldStateRoot));
-    request.set_old_local_exit_root(string2ba(input.publicInputs.oldLocalExitRoot));
-    request.set_global_exit_root(string2ba(input.globalExitRoot));
+    request.set_coinbase(NormalizeTo0xNFormat(input.publicInputs.sequencerAddr.get_str(16), 40));
+    request.set_batch_l2_data(input.batchL2Data);
+    uint8_t root[32];
+    scalar2bytesBE(input.publicInputs.oldStateRoot, root, 32);
+    request.set_old_state_root(root, 32);
+    scalar2bytesBE(input.publicInputs.oldLocalExitRoot, root, 32);
+    request.set_old_local_exit_root(root, 32);
+    scalar2bytesBE(input.globalExitRoot, root, 32);
+    request.set_global_exit_root(root, 32);
     request.set_eth_timestamp(input.publicInputs.timestamp);
     request.set_update_merkle_tree(update_merkle_tree);
 
@@ -81,6 +85,15 @@ bool ExecutorClient::ProcessBatch (void)
         }
         (*request.mutable_contracts_bytecode())[key] = value;
     }    
+}
+
+bool ExecutorClient::ProcessBatch (void)
+{
+    TimerStart(EXECUTOR_CLIENT_PROCESS_BATCH);
+
+    ::grpc::ClientContext context;
+    ::executor::v1::ProcessBatchRequest request;
+    buildProcessBatchRequest(request);
 
     ::executor::v1::ProcessBatchResponse response;
     std::unique_ptr<grpc::ClientReaderWriter<executor::v1::ProcessBatchRequest, executor::v1::ProcessBatchResponse>> readerWriter;
@@ -93,6 +106,84 @@ bool ExecutorClient::ProcessBatch (void)
     return true;
 }
 
+void ExecutorClient::runLoadTest (void)
+{
+    ::executor::v1::ProcessBatchRequest request;
+    buildProcessBatchRequest(request);
+
+    uint64_t nThreads = config.executorClientLoadThreads;
+    uint64_t nRequests = config.executorClientLoadRequests;
+    vector<vector<uint64_t>> latencies(nThreads); // Microseconds, per thread
+    vector<uint64_t> busy(nThreads, 0);
+    vector<uint64_t> errors(nThreads, 0);
+
+    cout << "ExecutorClient::runLoadTest() sending " << nRequests << " requests from each of " << nThreads << " threads" << endl;
+
+    struct timeval t0;
+    gettimeofday(&t0, NULL);
+
+    vector<thread> threads;
+    for (uint64_t t=0; t<nThreads; t++)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (uint64_t i=0; i<nRequests; i++)
+            {
+                ::grpc::ClientContext context;
+                ::executor::v1::ProcessBatchResponse response;
+                struct timeval start;
+                gettimeofday(&start, NULL);
+                ::grpc::Status status = stub->ProcessBatch(&context, request, &response);
+                uint64_t elapsed = TimeDiff(start);
+                if (status.ok())
+                {
+                    latencies[t].push_back(elapsed);
+                }
+                else if (status.error_code() == grpc::StatusCode::RESOURCE_EXHAUSTED)
+                {
+                    busy[t]++;
+                }
+                else
+                {
+                    errors[t]++;
+                }
+            }
+        });
+    }
+    for (uint64_t t=0; t<nThreads; t++)
+    {
+        threads[t].join();
+    }
+
+    uint64_t totalTime = TimeDiff(t0);
+
+    // Merge the per-thread results and calculate the percentiles
+    vector<uint64_t> all;
+    uint64_t totalBusy = 0;
+    uint64_t totalErrors = 0;
+    for (uint64_t t=0; t<nThreads; t++)
+    {
+        all.insert(all.end(), latencies[t].begin(), latencies[t].end());
+        totalBusy += busy[t];
+        totalErrors += errors[t];
+    }
+    sort(all.begin(), all.end());
+
+    cout << "ExecutorClient::runLoadTest() done in " << totalTime/1000 << " ms:"
+         << " succeeded=" << all.size()
+         << " busy=" << totalBusy
+         << " errors=" << totalErrors
+         << " throughput=" << (totalTime == 0 ? 0 : double(all.size())*1000000/totalTime) << " batches/s" << endl;
+    if (all.size() > 0)
+    {
+        cout << "ExecutorClient::runLoadTest() latency (ms):"
+             << " min=" << double(all.front())/1000
+             << " p50=" << double(all[(all.size()-1)*50/100])/1000
+             << " p99=" << double(all[(all.size()-1)*99/100])/1000
+             << " max=" << double(all.back())/1000 << endl;
+    }
+}
+
 void* executorClientThread(void* arg)
 {
     cout << "executorClientThread() started" << endl;
@@ -103,7 +194,15 @@ void* executorClientThread(void* arg)
     sleep(1);
 
     // Execute should block and succeed
-    cout << "executorClientThread() calling Execute()" << endl;
-    pClient->ProcessBatch();
+    if (pClient->config.executorClientLoadThreads > 0)
+    {
+        cout << "executorClientThread() calling runLoadTest()" << endl;
+        pClient->runLoadTest();
+    }
+    else
+    {
+        cout << "executorClientThread() calling Execute()" << endl;
+        pClient->ProcessBatch();
+    }
     return NULL;
 }
\ No newline at end of file
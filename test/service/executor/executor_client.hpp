@@ -24,6 +24,13 @@ public:
     void runThread (void);
     void waitForThread (void);
     bool ProcessBatch (void);
+
+    // Sends config.executorClientLoadRequests copies of the input file batch from each of
+    // config.executorClientLoadThreads parallel threads, and reports the latency percentiles
+    void runLoadTest (void);
+
+private:
+    void buildProcessBatchRequest (::executor::v1::ProcessBatchRequest &request);
 };
 
 void* executorClientThread (void* arg);
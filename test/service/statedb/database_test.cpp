@@ -0,0 +1,277 @@
+#include <iostream>
+#include <cstdlib>
+#include <random>
+#include <array>
+#include <unistd.h>
+#include "database_test.hpp"
+#include "database.hpp"
+#include "smt.hpp"
+#include "statedb_utils.hpp"
+#include "scalar.hpp"
+#include "utils.hpp"
+
+using namespace std;
+
+// Several databases of the same process, e.g. the StateDB server and the local StateDB client of the
+// executor, must be able to use the same node store directory
+uint64_t DatabaseTestSharedNodeStore (Goldilocks &fr, const Config &config)
+{
+    uint64_t numberOfErrors = 0;
+
+    char directory[] = "/tmp/database_test_XXXXXX";
+    if (mkdtemp(directory) == NULL)
+    {
+        cerr << "Error: DatabaseTestSharedNodeStore() failed calling mkdtemp()" << endl;
+        return 1;
+    }
+
+    Config storeConfig = config;
+    storeConfig.databaseURL = string("file://") + directory;
+    storeConfig.dbNodeStoreCommitPeriod = 0;
+
+    string key = "0x1111111111111111111111111111111111111111111111111111111111111111";
+    vector<Goldilocks::Element> value;
+    for (uint64_t i=0; i<12; i++) value.push_back(fr.fromU64(i + 1));
+
+    Database * pDatabase1 = new Database(fr);
+    Database * pDatabase2 = new Database(fr);
+    pDatabase1->init(storeConfig);
+    pDatabase2->init(storeConfig);
+
+    // A node written by one database can be read by the other one
+    if (pDatabase1->write(key, value, true) != ZKR_SUCCESS)
+    {
+        cerr << "Error: DatabaseTestSharedNodeStore() failed writing the node" << endl;
+        numberOfErrors++;
+    }
+    pDatabase1->flush();
+    vector<Goldilocks::Element> readValue;
+    if ((pDatabase2->read(key, readValue) != ZKR_SUCCESS) || (readValue.size() != value.size()) || !fr.equal(readValue[11], value[11]))
+    {
+        cerr << "Error: DatabaseTestSharedNodeStore() failed reading the node from the second database" << endl;
+        numberOfErrors++;
+    }
+
+    // The store must stay open until the last database using it is destroyed
+    delete pDatabase1;
+    readValue.clear();
+    if ((pDatabase2->read(key, readValue) != ZKR_SUCCESS) || (readValue.size() != value.size()))
+    {
+        cerr << "Error: DatabaseTestSharedNodeStore() failed reading the node after destroying the first database" << endl;
+        numberOfErrors++;
+    }
+    delete pDatabase2;
+
+    // Once closed, the directory can be opened again, with the node persisted
+    Database database3(fr);
+    database3.init(storeConfig);
+    readValue.clear();
+    if ((database3.read(key, readValue) != ZKR_SUCCESS) || (readValue.size() != value.size()) || !fr.equal(readValue[0], value[0]))
+    {
+        cerr << "Error: DatabaseTestSharedNodeStore() failed reading the node after reopening the store" << endl;
+        numberOfErrors++;
+    }
+
+    return numberOfErrors;
+}
+
+// Smt::setBatch must get the same root, and the same tree, as setting the keys one by one with Smt::set,
+// for random batches of insertions, updates and deletions; in one out of three trees the keys differ
+// only in their lowest bits, so they share long paths, and deletions collapse deep branches
+uint64_t DatabaseTestSmtSetBatch (Goldilocks &fr, const Config &config)
+{
+    uint64_t numberOfErrors = 0;
+
+    Config localConfig = config;
+    localConfig.databaseURL = "local";
+    localConfig.dbCacheSnapshotFile = "";
+
+    Smt smt(fr);
+    mt19937_64 gen(1);
+
+    for (uint64_t tree=0; tree<100; tree++)
+    {
+        Database batchDatabase(fr);
+        Database sequentialDatabase(fr);
+        batchDatabase.init(localConfig);
+        sequentialDatabase.init(localConfig);
+
+        Goldilocks::Element batchRoot[4] = {fr.zero(), fr.zero(), fr.zero(), fr.zero()};
+        Goldilocks::Element sequentialRoot[4] = {fr.zero(), fr.zero(), fr.zero(), fr.zero()};
+
+        // Pool of keys used by the batches of this tree
+        bool bSharedPaths = ((tree % 3) == 0);
+        uint64_t numberOfKeys = 1 + gen()%40;
+        vector< array<uint64_t, 4> > keys(numberOfKeys);
+        for (uint64_t i=0; i<numberOfKeys; i++)
+        {
+            for (uint64_t j=0; j<4; j++) keys[i][j] = bSharedPaths ? (gen() % 8) : (gen() >> 2);
+        }
+
+        for (uint64_t batch=0; batch<4; batch++)
+        {
+            // Random entries, with repeated keys, and one out of three of them deleting its key
+            vector<SmtBatchEntry> entries(1 + gen()%30);
+            for (uint64_t i=0; i<entries.size(); i++)
+            {
+                array<uint64_t, 4> &key = keys[gen() % numberOfKeys];
+                for (uint64_t j=0; j<4; j++) entries[i].key[j] = fr.fromU64(key[j]);
+                entries[i].value = ((gen() % 3) == 0) ? 0 : (gen() % 1000);
+            }
+
+            Goldilocks::Element newRoot[4];
+            if (smt.setBatch(batchDatabase, batchRoot, entries, true, newRoot) != ZKR_SUCCESS)
+            {
+                cerr << "Error: DatabaseTestSmtSetBatch() failed calling Smt::setBatch() tree=" << tree << " batch=" << batch << endl;
+                numberOfErrors++;
+                break;
+            }
+            for (uint64_t j=0; j<4; j++) batchRoot[j] = newRoot[j];
+
+            for (uint64_t i=0; i<entries.size(); i++)
+            {
+                SmtSetResult setResult;
+                if (smt.set(sequentialDatabase, sequentialRoot, entries[i].key, entries[i].value, true, setResult) != ZKR_SUCCESS)
+                {
+                    cerr << "Error: DatabaseTestSmtSetBatch() failed calling Smt::set() tree=" << tree << " batch=" << batch << endl;
+                    numberOfErrors++;
+                    break;
+                }
+                for (uint64_t j=0; j<4; j++) sequentialRoot[j] = setResult.newRoot[j];
+            }
+
+            if (fea2string(fr, batchRoot) != fea2string(fr, sequentialRoot))
+            {
+                cerr << "Error: DatabaseTestSmtSetBatch() found different roots tree=" << tree << " batch=" << batch << " setBatch=" << fea2string(fr, batchRoot) << " set=" << fea2string(fr, sequentialRoot) << endl;
+                numberOfErrors++;
+                break;
+            }
+
+            // Every key must be readable from the tree written by setBatch, with the same value
+            for (uint64_t i=0; i<numberOfKeys; i++)
+            {
+                Goldilocks::Element key[4];
+                for (uint64_t j=0; j<4; j++) key[j] = fr.fromU64(keys[i][j]);
+                SmtGetResult batchResult;
+                SmtGetResult sequentialResult;
+                if ((smt.get(batchDatabase, batchRoot, key, batchResult) != ZKR_SUCCESS) ||
+                    (smt.get(sequentialDatabase, sequentialRoot, key, sequentialResult) != ZKR_SUCCESS) ||
+                    (batchResult.value != sequentialResult.value))
+                {
+                    cerr << "Error: DatabaseTestSmtSetBatch() found a different value tree=" << tree << " batch=" << batch << " key=" << i << endl;
+                    numberOfErrors++;
+                }
+            }
+        }
+
+        // Deleting all the keys must get the empty tree
+        vector<SmtBatchEntry> entries(numberOfKeys);
+        for (uint64_t i=0; i<numberOfKeys; i++)
+        {
+            for (uint64_t j=0; j<4; j++) entries[i].key[j] = fr.fromU64(keys[i][j]);
+            entries[i].value = 0;
+        }
+        Goldilocks::Element newRoot[4];
+        if ((smt.setBatch(batchDatabase, batchRoot, entries, true, newRoot) != ZKR_SUCCESS) ||
+            !fr.isZero(newRoot[0]) || !fr.isZero(newRoot[1]) || !fr.isZero(newRoot[2]) || !fr.isZero(newRoot[3]))
+        {
+            cerr << "Error: DatabaseTestSmtSetBatch() failed deleting all the keys tree=" << tree << endl;
+            numberOfErrors++;
+        }
+    }
+
+    return numberOfErrors;
+}
+
+// The packed nodes of GetNodes and PutNodes must be unpacked into the same keys, normalized as database
+// keys, and values; truncated buffers must be rejected
+uint64_t DatabaseTestNodePacking (Goldilocks &fr)
+{
+    uint64_t numberOfErrors = 0;
+
+    vector<string> keys = { "0x0123456789ABCDEF0123456789abcdef0123456789abcdef0123456789ABCDEF", "1f", "ffffffff00000000ffffffff00000000ffffffff00000000ffffffff00000000" };
+    vector<string> normalizedKeys;
+    for (uint64_t i=0; i<keys.size(); i++) normalizedKeys.push_back(stringToLower(NormalizeToNFormat(keys[i], 64)));
+    vector< vector<Goldilocks::Element> > values(keys.size());
+    for (uint64_t i=0; i<12; i++) values[0].push_back(fr.fromU64(0xFFFFFFFF00000000ULL + i));
+    for (uint64_t i=0; i<8; i++) values[1].push_back(fr.fromU64(i*i));
+    // values[2] is empty, as the nodes not found by GetNodes
+
+    string packed;
+    for (uint64_t i=0; i<keys.size(); i++) node2grpc(fr, keys[i], values[i], packed);
+
+    uint64_t offset = 0;
+    for (uint64_t i=0; i<keys.size(); i++)
+    {
+        string key;
+        vector<Goldilocks::Element> value;
+        if (!grpc2node(fr, packed, offset, key, value) || (key != normalizedKeys[i]) || (value.size() != values[i].size()))
+        {
+            cerr << "Error: DatabaseTestNodePacking() failed unpacking node " << i << " key=" << key << endl;
+            numberOfErrors++;
+            return numberOfErrors;
+        }
+        for (uint64_t j=0; j<value.size(); j++)
+        {
+            if (!fr.equal(value[j], values[i][j]))
+            {
+                cerr << "Error: DatabaseTestNodePacking() found a different value in node " << i << " element " << j << endl;
+                numberOfErrors++;
+            }
+        }
+    }
+    if (offset != packed.size())
+    {
+        cerr << "Error: DatabaseTestNodePacking() found offset=" << offset << " != packed.size()=" << packed.size() << endl;
+        numberOfErrors++;
+    }
+
+    // Keys alone, as sent by GetNodes
+    string packedKeys;
+    for (uint64_t i=0; i<keys.size(); i++) key2grpc(keys[i], packedKeys);
+    offset = 0;
+    for (uint64_t i=0; i<keys.size(); i++)
+    {
+        string key;
+        if (!grpc2key(packedKeys, offset, key) || (key != normalizedKeys[i]))
+        {
+            cerr << "Error: DatabaseTestNodePacking() failed unpacking key " << i << " key=" << key << endl;
+            numberOfErrors++;
+        }
+    }
+    string key;
+    if (grpc2key(packedKeys, offset, key))
+    {
+        cerr << "Error: DatabaseTestNodePacking() unpacked a key after the end" << endl;
+        numberOfErrors++;
+    }
+
+    // Every truncation of a packed node must fail
+    string node;
+    node2grpc(fr, keys[0], values[0], node);
+    for (uint64_t size=0; size<node.size(); size++)
+    {
+        vector<Goldilocks::Element> value;
+        offset = 0;
+        if (grpc2node(fr, node.substr(0, size), offset, key, value))
+        {
+            cerr << "Error: DatabaseTestNodePacking() unpacked a node truncated to size=" << size << endl;
+            numberOfErrors++;
+        }
+    }
+
+    return numberOfErrors;
+}
+
+uint64_t DatabaseTest (Goldilocks &fr, const Config &config)
+{
+    cout << "DatabaseTest starting..." << endl;
+
+    uint64_t numberOfErrors = 0;
+    numberOfErrors += DatabaseTestSharedNodeStore(fr, config);
+    numberOfErrors += DatabaseTestSmtSetBatch(fr, config);
+    numberOfErrors += DatabaseTestNodePacking(fr);
+
+    cout << "DatabaseTest done with " << numberOfErrors << " errors" << endl;
+    return numberOfErrors;
+}
@@ -0,0 +1,10 @@
+#ifndef DATABASE_TEST_HPP
+#define DATABASE_TEST_HPP
+
+#include "config.hpp"
+#include "goldilocks_base_field.hpp"
+
+// Tests the StateDB database backends and the SMT on top of them, without any server; returns the number of errors
+uint64_t DatabaseTest (Goldilocks &fr, const Config &config);
+
+#endif
@@ -1,7 +1,54 @@
 #ifndef STATEDB_TEST_PERF_HPP
 #define STATEDB_TEST_PERF_HPP
 
+#include <string>
+#include <nlohmann/json.hpp>
 #include "config.hpp"
+#include "goldilocks_base_field.hpp"
+
+using namespace std;
+using json = nlohmann::json;
+
+/*
+    StateDB performance test: sets treeSize keys into an empty tree, and then executes a number
+    of get and set operations on it from several client threads, measuring their latency
+
+    Key distributions of the measured operations:
+    - uniform: any of the tree keys, with the same probability
+    - zipf: any of the tree keys, the first ones much more likely, as in real hot accounts
+    - sequential: the tree keys in order, every thread starting at a different offset
+    - new: keys not present in the tree, so every set is an insertion
+*/
+
+class StateDBPerfWorkload
+{
+public:
+    uint64_t treeSize; // Number of keys set into the tree before measuring
+    uint64_t operations; // Number of measured operations, among all threads
+    uint64_t threads; // Number of client threads
+    double readRatio; // Ratio of get operations, from 0 (only sets) to 1 (only gets)
+    string keyDistribution; // uniform, zipf, sequential or new
+    double zipfExponent;
+    bool persistent; // Persistent flag of the set operations
+    uint64_t seed; // Seed of the random generators, for reproducible runs
+    string stateDBURL; // "local" or the StateDB server URL; if empty, config.stateDBURL is used
+
+    StateDBPerfWorkload() :
+        treeSize(10000),
+        operations(50000),
+        threads(1),
+        readRatio(0.5),
+        keyDistribution("uniform"),
+        zipfExponent(0.99),
+        persistent(true),
+        seed(1) {};
+
+    void load (const json &workload);
+    void toJson (json &workload) const;
+};
+
+// Runs the workload and fills result with its throughput and latency percentiles
+void stateDBPerfTest (Goldilocks &fr, const Config &config, const StateDBPerfWorkload &workload, json &result);
 
 void runStateDBPerfTest (const Config& config);
 void* stateDBPerfTestThread (const Config& config);
@@ -0,0 +1,237 @@
+#include <iostream>
+#include <gmpxx.h>
+#include "main_sm_test.hpp"
+#include "eval_command.hpp"
+#include "scalar.hpp"
+#include "rlp.hpp"
+#include "counters.hpp"
+#include "sm/pols_generated/commit_pols.hpp"
+#include "sm/binary/binary_defines.hpp"
+
+using namespace std;
+
+// Previous GMP implementation of the sqrtFpEc ROM command, kept as the reference that the RawFec
+// based one must match for any input; note that s starts at 1, so for secp256k1 (p-1 = 2*odd) it
+// ends up being 2, and the general branch is taken, which returns the root not greater than p/2
+mpz_class MainSMTestPow (const mpz_class &x, const mpz_class &n, const mpz_class &p)
+{
+    if (n == 0) return 1;
+    if ((n & 1) == 1) {
+        return (MainSMTestPow(x, n-1, p) * x) % p;
+    }
+    mpz_class x2 = MainSMTestPow(x, n/2, p);
+    return (x2 * x2) % p;
+}
+
+mpz_class MainSMTestSqrtTonelliShanks (const mpz_class &n, const mpz_class &p)
+{
+    mpz_class s = 1;
+    mpz_class q = p - 1;
+    while ((q & 1) == 0) {
+        q = q / 2;
+        ++s;
+    }
+    if (s == 1) {
+        mpz_class r = MainSMTestPow(n, (p+1)/4, p);
+        if ((r * r) % p == n) return r;
+        return 0;
+    }
+
+    mpz_class z = 1;
+    while (MainSMTestPow(++z, (p - 1)/2, p) != (p - 1));
+    mpz_class c = MainSMTestPow(z, q, p);
+    mpz_class r = MainSMTestPow(n, (q+1)/2, p);
+    mpz_class t = MainSMTestPow(n, q, p);
+    mpz_class m = s;
+    while (t != 1) {
+        mpz_class tt = t;
+        mpz_class i = 0;
+        while (tt != 1) {
+            tt = (tt * tt) % p;
+            ++i;
+            if (i == m) return 0;
+        }
+        mpz_class b = MainSMTestPow(c, MainSMTestPow(2, m-i-1, p-1), p);
+        mpz_class b2 = (b * b) % p;
+        r = (r * b) % p;
+        t = (t * b2) % p;
+        c = b2;
+        m = i;
+    }
+    if (((r * r) % p) == n)
+    {
+        r = r % p;
+        if (r > (p/2)) r = p - r;
+        return r;
+    }
+    return 0;
+}
+
+uint64_t MainSMTestSqrtFpEc (void)
+{
+    uint64_t numberOfErrors = 0;
+    RawFec fec;
+    gmp_randclass rand(gmp_randinit_default);
+    rand.seed(1);
+
+    // Quadratic residues, random values (about half of them non-residues), and inputs >= p
+    vector<mpz_class> inputs = { 0, 1, 4, FecP - 1, FecP, FecP + 1, FecP + 4, 2*FecP, TwoTo256 - 1 };
+    for (uint64_t i=0; i<100; i++)
+    {
+        mpz_class x = rand.get_z_range(FecP);
+        inputs.push_back((x * x) % FecP);
+        inputs.push_back(rand.get_z_range(FecP));
+        inputs.push_back(FecP + (x * x) % FecP);
+        inputs.push_back(FecP + rand.get_z_range(TwoTo256 - FecP));
+    }
+
+    uint64_t numberOfRoots = 0;
+    for (uint64_t i=0; i<inputs.size(); i++)
+    {
+        mpz_class expected = MainSMTestSqrtTonelliShanks(inputs[i], FecP);
+        mpz_class r;
+        sqrtFpEc(fec, inputs[i], r);
+        if (r != expected)
+        {
+            cerr << "Error: MainSMTestSqrtFpEc() a=" << inputs[i].get_str(16) << " r=" << r.get_str(16) << " expected=" << expected.get_str(16) << endl;
+            numberOfErrors++;
+        }
+        if (expected != 0) numberOfRoots++;
+    }
+
+    // Make sure both branches were covered
+    if ((numberOfRoots == 0) || (numberOfRoots == inputs.size()))
+    {
+        cerr << "Error: MainSMTestSqrtFpEc() found " << numberOfRoots << " roots of " << inputs.size() << " inputs" << endl;
+        numberOfErrors++;
+    }
+
+    return numberOfErrors;
+}
+
+// Checks the split of batchL2Data into transactions, as used to execute a prefix of the batch
+uint64_t MainSMTestBatchTxsEnds (void)
+{
+    uint64_t numberOfErrors = 0;
+    string signature(65, '\x01');
+
+    struct TestCase
+    {
+        string name;
+        string data;
+        bool bValid;
+        vector<uint64_t> ends;
+    };
+    vector<TestCase> testCases;
+
+    // Two transactions: a short list of 3 bytes, and a list of 64 bytes using a 1-byte length
+    testCases.push_back({"two txs", string("\xc3", 1) + string(3, '\x02') + signature + string("\xf8\x40", 2) + string(64, '\x03') + signature, true, {69, 200}});
+
+    // A list of 256 bytes, using a 2-byte length
+    testCases.push_back({"long form", string("\xf9\x01\x00", 3) + string(256, '\x04') + signature, true, {324}});
+
+    // Empty batch
+    testCases.push_back({"empty", "", true, {}});
+
+    // List shorter than its length, or missing part of the signature
+    testCases.push_back({"truncated list", string("\xc5", 1) + string(3, '\x02'), false, {}});
+    testCases.push_back({"truncated signature", string("\xc3", 1) + string(3, '\x02') + signature.substr(0, 64), false, {}});
+    testCases.push_back({"truncated length", string("\xf9\x01", 2), false, {}});
+
+    // 8-byte length of 2^64-65, which must not wrap around to 0 when the signature size is added, and
+    // then take the next transaction as if it was part of this one
+    testCases.push_back({"huge length", string("\xff\xff\xff\xff\xff\xff\xff\xff\xbf", 9) + string("\xc3", 1) + string(3, '\x02') + signature, false, {}});
+
+    // Not a list
+    testCases.push_back({"not a list", string("\x80", 1) + signature, false, {}});
+
+    for (uint64_t i=0; i<testCases.size(); i++)
+    {
+        vector<uint64_t> ends;
+        bool bValid = getBatchTxsEnds(testCases[i].data, ends);
+        if ((bValid != testCases[i].bValid) || (bValid && (ends != testCases[i].ends)))
+        {
+            cerr << "Error: MainSMTestBatchTxsEnds() failed test case " << testCases[i].name << " bValid=" << bValid << " ends.size()=" << ends.size() << endl;
+            numberOfErrors++;
+        }
+    }
+
+    return numberOfErrors;
+}
+
+// Checks that every counter limit is the number of operations that fit in its state machine
+uint64_t MainSMTestCountersLimits (void)
+{
+    uint64_t numberOfErrors = 0;
+
+    Counters limits;
+    getCountersLimits(limits);
+
+    struct TestCase
+    {
+        string name;
+        uint64_t limit;
+        uint64_t evaluations; // per operation
+        uint64_t degree;
+    };
+    vector<TestCase> testCases = {
+        {"arith", limits.arith, 32, ArithCommitPols::pilDegree()},
+        {"memAlign", limits.memAlign, 32, MemAlignCommitPols::pilDegree()},
+        {"binary", limits.binary, LATCH_SIZE, BinaryCommitPols::pilDegree()},
+        {"poseidonG", limits.poseidonG, 31, PoseidonGCommitPols::pilDegree()},
+        {"paddingPG", limits.paddingPG, 56, PaddingPGCommitPols::pilDegree()} };
+
+    for (uint64_t i=0; i<testCases.size(); i++)
+    {
+        const TestCase &t = testCases[i];
+        if ((t.limit == 0) || (t.limit*t.evaluations > t.degree) || ((t.limit + 1)*t.evaluations <= t.degree))
+        {
+            cerr << "Error: MainSMTestCountersLimits() found invalid " << t.name << " limit=" << t.limit << " degree=" << t.degree << endl;
+            numberOfErrors++;
+        }
+    }
+
+    // Keccak-f blocks are hashed 9 at a time, in slots of 158418 evaluations
+    if ((limits.keccakF == 0) || (limits.keccakF % 9 != 0) || ((limits.keccakF/9)*158418 > PaddingKKCommitPols::pilDegree()))
+    {
+        cerr << "Error: MainSMTestCountersLimits() found invalid keccakF limit=" << limits.keccakF << endl;
+        numberOfErrors++;
+    }
+
+    // The last step must be before the last evaluation of the main state machine
+    if (limits.steps != MainCommitPols::pilDegree() - 1)
+    {
+        cerr << "Error: MainSMTestCountersLimits() found invalid steps limit=" << limits.steps << endl;
+        numberOfErrors++;
+    }
+
+    // A counter exceeds its limit only when it is greater than it
+    Counters counters = limits;
+    string counterName;
+    if (counters.exceeds(limits, counterName))
+    {
+        cerr << "Error: MainSMTestCountersLimits() found counters equal to the limits exceed them" << endl;
+        numberOfErrors++;
+    }
+    counters.binary++;
+    if (!counters.exceeds(limits, counterName) || (counterName != "binary"))
+    {
+        cerr << "Error: MainSMTestCountersLimits() found binary counter over the limit does not exceed it" << endl;
+        numberOfErrors++;
+    }
+
+    return numberOfErrors;
+}
+
+uint64_t MainSMTest (Goldilocks &fr, const Config &config)
+{
+    cout << "MainSMTest starting..." << endl;
+
+    uint64_t numberOfErrors = 0;
+    numberOfErrors += MainSMTestSqrtFpEc();
+    numberOfErrors += MainSMTestBatchTxsEnds();
+    numberOfErrors += MainSMTestCountersLimits();
+
+    cout << "MainSMTest done with " << numberOfErrors << " errors" << endl;
+    return numberOfErrors;
+}
@@ -0,0 +1,9 @@
+#ifndef MAIN_SM_TEST_HPP
+#define MAIN_SM_TEST_HPP
+
+#include "config.hpp"
+#include "goldilocks_base_field.hpp"
+
+uint64_t MainSMTest (Goldilocks &fr, const Config &config);
+
+#endif
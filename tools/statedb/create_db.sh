@@ -15,6 +15,8 @@ sudo -u postgres psql -c 'grant all privileges on database '$1' to '$2';'
 echo "Creating table state.merkletree..."
 PGPASSWORD=$3 psql -U $2 -h 127.0.0.1 -p 5432 -d $1 -c 'create schema state;'
 PGPASSWORD=$3 psql -U $2 -h 127.0.0.1 -p 5432 -d $1 -c 'create table state.merkletree (hash bytea primary key, data bytea not null);'
+echo "Creating table state.program..."
+PGPASSWORD=$3 psql -U $2 -h 127.0.0.1 -p 5432 -d $1 -c 'create table state.program (hash bytea primary key, data bytea not null);'
 echo "Done."
 echo "Example of connection string to use in the config.json file:"
 echo "  \"databaseURL\": \"postgresql://$2:$3@127.0.0.1:5432/$1\""